@@ -1,15 +1,24 @@
 #pragma warning(push)
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <span>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <mmio/mmio.hpp>
@@ -23,37 +32,287 @@ struct Pair
 	std::uint64_t offset;
 };
 
-int main(int a_argc, char* a_argv[])
+// "ADDRLIB\0", which can never be mistaken for the mapping count of a v1 database
+inline constexpr std::uint64_t MAGIC = 0x0042494C52444441;
+
+struct Header
 {
-	try {
-		mmio::mapped_file_source input;
-		std::ofstream output;
+	enum Flag : std::uint32_t
+	{
+		kNone = 0,
+		kDense = 1u << 0,
+	};
 
-		for (int i = 1; i < a_argc; ++i) {
-			std::filesystem::path filename = a_argv[static_cast<std::size_t>(i)];
-			if (!input.open(filename.string())) {
-				throw std::runtime_error("failed to open: "s + filename.string());
+	std::uint64_t magic;
+	std::uint32_t format;
+	std::uint32_t flags;
+	std::uint64_t count;
+	std::uint64_t idLimit;
+	std::uint64_t packedSize;
+};
+static_assert(sizeof(Header) == 0x28);
+
+[[nodiscard]] std::uint64_t read_varint(std::span<const std::uint8_t>& a_data)
+{
+	std::uint64_t result = 0;
+	for (std::uint32_t shift = 0; shift < 64 && !a_data.empty(); shift += 7) {
+		const auto byte = a_data.front();
+		a_data = a_data.subspan(1);
+		result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return result;
+		}
+	}
+	throw std::runtime_error("packed mappings are malformed"s);
+}
+
+// returns the mappings sorted by id, decoding them into a_buf if they can not be used in place
+[[nodiscard]] std::span<const Pair> read_mappings(const mmio::mapped_file_source& a_input, std::vector<Pair>& a_buf)
+{
+	if (a_input.size() < sizeof(std::uint64_t)) {
+		throw std::runtime_error("database is truncated"s);
+	}
+
+	if (a_input.size() < sizeof(Header) ||
+		reinterpret_cast<const Header*>(a_input.data())->magic != MAGIC) {
+		std::span data(
+			reinterpret_cast<const Pair*>(a_input.data() + sizeof(std::uint64_t)),
+			*reinterpret_cast<const std::uint64_t*>(a_input.data()));
+		if (data.size_bytes() > a_input.size() - sizeof(std::uint64_t)) {
+			throw std::runtime_error("database is truncated"s);
+		}
+		return data;
+	}
+
+	const auto& header = *reinterpret_cast<const Header*>(a_input.data());
+	if (header.format != 2) {
+		throw std::runtime_error("unsupported database format: "s + std::to_string(header.format));
+	} else if (header.packedSize > a_input.size() - sizeof(Header)) {
+		throw std::runtime_error("database is truncated"s);
+	}
+
+	std::span packed(
+		reinterpret_cast<const std::uint8_t*>(a_input.data() + sizeof(Header)),
+		static_cast<std::size_t>(header.packedSize));
+	a_buf.clear();
+	a_buf.reserve(static_cast<std::size_t>(header.count));
+	std::uint64_t offset = 0;
+	for (std::uint64_t i = 0; i < header.count; ++i) {
+		offset += read_varint(packed);
+		const auto id = read_varint(packed);
+		a_buf.push_back({ id, offset });
+	}
+
+	std::sort(
+		a_buf.begin(),
+		a_buf.end(),
+		[](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.id != a_rhs.id ?
+                       a_lhs.id < a_rhs.id :
+                       a_lhs.offset < a_rhs.offset;
+		});
+	return a_buf;
+}
+
+// formatted output is staged here, and only handed to the stream once it has grown large
+class OutputBuffer
+{
+public:
+	static constexpr std::size_t FLUSH_SIZE = 1u << 20;
+
+	explicit OutputBuffer(std::ostream& a_stream) noexcept :
+		_stream(std::addressof(a_stream))
+	{}
+
+	OutputBuffer(const OutputBuffer&) = delete;
+	OutputBuffer(OutputBuffer&&) = delete;
+
+	~OutputBuffer() = default;
+
+	OutputBuffer& operator=(const OutputBuffer&) = delete;
+	OutputBuffer& operator=(OutputBuffer&&) = delete;
+
+	template <class... Args>
+	void print(fmt::format_string<Args...> a_fmt, Args&&... a_args)
+	{
+		fmt::format_to(std::back_inserter(_buf), a_fmt, std::forward<Args>(a_args)...);
+		if (_buf.size() >= FLUSH_SIZE) {
+			flush();
+		}
+	}
+
+	void flush()
+	{
+		_stream->write(_buf.data(), static_cast<std::streamsize>(_buf.size()));
+		_buf.clear();
+	}
+
+	void reset(std::ostream& a_stream) noexcept { _stream = std::addressof(a_stream); }
+
+private:
+	fmt::memory_buffer _buf;
+	std::ostream* _stream;
+};
+
+[[nodiscard]] std::size_t id_width(std::span<const Pair> a_data)
+{
+	return a_data.empty() ? 0 : fmt::formatted_size(FMT_STRING("{}"), a_data.back().id);
+}
+
+// writes the mappings of a_filename to the same path, with a .txt extension
+void decode(std::filesystem::path a_filename, std::vector<Pair>& a_buf, OutputBuffer& a_out)
+{
+	mmio::mapped_file_source input;
+	if (!input.open(a_filename.string())) {
+		throw std::runtime_error("failed to open: "s + a_filename.string());
+	}
+
+	a_filename.replace_extension(".txt");
+	std::ofstream output(a_filename.c_str(), std::ios::out | std::ios::trunc);
+	if (!output.is_open()) {
+		throw std::runtime_error("failed to open: "s + a_filename.string());
+	}
+
+	a_out.reset(output);
+	const auto data = read_mappings(input, a_buf);
+	const auto width = id_width(data);
+	for (const auto& elem : data) {
+		a_out.print(FMT_STRING("{: >{}}\t{:0>7X}\n"), elem.id, width, elem.offset);
+	}
+	a_out.flush();
+}
+
+// decodes every file on a pool of workers, each with its own buffers
+void decode_all(std::span<const std::filesystem::path> a_filenames)
+{
+	std::atomic_size_t next{ 0 };
+	std::mutex lock;
+	std::exception_ptr error;
+	const auto worker = [&]() {
+		std::vector<Pair> buf;
+		std::ostringstream discard;
+		OutputBuffer out{ discard };
+		for (auto i = next++; i < a_filenames.size(); i = next++) {
+			try {
+				decode(a_filenames[i], buf, out);
+			} catch (...) {
+				const std::lock_guard l{ lock };
+				if (!error) {
+					error = std::current_exception();
+				}
+				next = a_filenames.size();
 			}
+		}
+	};
+
+	const auto count = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, a_filenames.size());
+	{
+		std::vector<std::jthread> workers;
+		workers.reserve(count - 1);
+		for (std::size_t i = 1; i < count; ++i) {
+			workers.emplace_back(worker);
+		}
+		worker();
+	}
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
 
-			filename.replace_extension(".txt");
-			output.open(filename.c_str(), std::ios::out | std::ios::trunc);
-			if (!output.is_open()) {
-				throw std::runtime_error("failed to open: "s + filename.string());
+// merges the id sorted tables of two databases, and prints the ids which were added to b,
+// removed from a, or moved to a different offset
+void diff(const std::filesystem::path& a_lhs, const std::filesystem::path& a_rhs)
+{
+	mmio::mapped_file_source lfile;
+	mmio::mapped_file_source rfile;
+	for (const auto& [file, path] : { std::make_pair(&lfile, &a_lhs), std::make_pair(&rfile, &a_rhs) }) {
+		if (!file->open(path->string())) {
+			throw std::runtime_error("failed to open: "s + path->string());
+		}
+	}
+
+	std::vector<Pair> lbuf;
+	std::vector<Pair> rbuf;
+	const auto lhs = read_mappings(lfile, lbuf);
+	const auto rhs = read_mappings(rfile, rbuf);
+	const auto width = (std::max)(id_width(lhs), id_width(rhs));
+
+	// every id may map to several offsets, so compare whole runs of them
+	const auto run = [](std::span<const Pair> a_data, std::size_t a_pos) {
+		auto end = a_pos + 1;
+		while (end < a_data.size() && a_data[end].id == a_data[a_pos].id) {
+			++end;
+		}
+		return a_data.subspan(a_pos, end - a_pos);
+	};
+
+	// v1 tables are only sorted by id, so a run's offsets can come in any order
+	std::vector<std::uint64_t> loffsets;
+	std::vector<std::uint64_t> roffsets;
+	const auto sorted_offsets = [](std::span<const Pair> a_run, std::vector<std::uint64_t>& a_buf) -> const std::vector<std::uint64_t>& {
+		a_buf.clear();
+		for (const auto& elem : a_run) {
+			a_buf.push_back(elem.offset);
+		}
+		std::sort(a_buf.begin(), a_buf.end());
+		return a_buf;
+	};
+
+	OutputBuffer out{ std::cout };
+	std::size_t added = 0;
+	std::size_t removed = 0;
+	std::size_t moved = 0;
+	std::size_t l = 0;
+	std::size_t r = 0;
+	while (l < lhs.size() || r < rhs.size()) {
+		if (r == rhs.size() || (l < lhs.size() && lhs[l].id < rhs[r].id)) {
+			const auto elems = run(lhs, l);
+			out.print(FMT_STRING("-\t{: >{}}\t{:0>7X}\n"), elems.front().id, width, elems.front().offset);
+			++removed;
+			l += elems.size();
+		} else if (l == lhs.size() || rhs[r].id < lhs[l].id) {
+			const auto elems = run(rhs, r);
+			out.print(FMT_STRING("+\t{: >{}}\t{:0>7X}\n"), elems.front().id, width, elems.front().offset);
+			++added;
+			r += elems.size();
+		} else {
+			const auto lelems = run(lhs, l);
+			const auto relems = run(rhs, r);
+			const auto& lsorted = sorted_offsets(lelems, loffsets);
+			const auto& rsorted = sorted_offsets(relems, roffsets);
+			if (lsorted != rsorted) {
+				out.print(FMT_STRING("~\t{: >{}}\t{:0>7X}\t{:0>7X}\n"), lelems.front().id, width, lsorted.front(), rsorted.front());
+				++moved;
 			}
+			l += lelems.size();
+			r += relems.size();
+		}
+	}
+	out.flush();
+	std::cout.flush();
 
-			std::span data(
-				reinterpret_cast<const Pair*>(input.data() + sizeof(std::uint64_t)),
-				*reinterpret_cast<const std::uint64_t*>(input.data()));
-			if (!data.empty()) {
-				const auto width = fmt::format(FMT_STRING("{}"), data.back().id);
-				const auto format = fmt::format(FMT_STRING("{{: >{}}}\t{{:0>7X}}\n"), width.length());
-				for (const auto& elem : data) {
-					output << fmt::format(fmt::runtime(format), elem.id, elem.offset);
+	std::cerr << "added: "sv << added << ", removed: "sv << removed << ", moved: "sv << moved << std::endl;
+}
+
+int main(int a_argc, char* a_argv[])
+{
+	try {
+		std::vector<std::filesystem::path> filenames;
+		for (int i = 1; i < a_argc; ++i) {
+			const std::string_view arg = a_argv[static_cast<std::size_t>(i)];
+			if (arg == "--diff"sv) {
+				if (a_argc != 4 || i != 1) {
+					throw std::runtime_error("usage: --diff a.bin b.bin"s);
 				}
+				diff(a_argv[2], a_argv[3]);
+				return EXIT_SUCCESS;
 			}
+			filenames.emplace_back(a_argv[static_cast<std::size_t>(i)]);
+		}
 
-			input.close();
-			output.close();
+		if (!filenames.empty()) {
+			decode_all(filenames);
 		}
 	} catch (const std::exception& e) {
 		std::cerr << e.what() << std::endl;
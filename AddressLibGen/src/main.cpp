@@ -2,23 +2,31 @@
 #pragma warning(disable: 4702)  // unreachable code
 #include <algorithm>
 #include <array>
-#include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
-#include <set>
-#include <sstream>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <mmio/mmio.hpp>
 #include <robin_hood.h>
 #include <srell.hpp>
 #pragma warning(pop)
@@ -84,189 +92,876 @@ private:
 [[nodiscard]] constexpr bool operator>(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) > 0; }
 [[nodiscard]] constexpr bool operator>=(const Version& a_lhs, const Version& a_rhs) noexcept { return a_lhs.compare(a_rhs) >= 0; }
 
-class Mapping
+// mappings linked across versions share an id, so every connected set of them is
+// tracked as one tree, and the id is only assigned to its root
+class DisjointSet
 {
 public:
-	[[nodiscard]] constexpr bool assigned() const noexcept { return static_cast<bool>(_id); }
+	using index_type = std::uint32_t;
 
-	void assign(std::uint64_t a_id) noexcept
+	[[nodiscard]] index_type make()
 	{
-		_id = a_id;
-		for (auto& link : _links) {
-			if (!link->assigned()) {
-				link->assign(a_id);
-			}
+		const auto index = size();
+		if (index == (std::numeric_limits<index_type>::max)()) {
+			throw std::overflow_error("too many mappings"s);
+		}
+
+		_parents.push_back(index);
+		_ranks.push_back(0);
+		return index;
+	}
+
+	[[nodiscard]] index_type find(index_type a_index) noexcept
+	{
+		while (_parents[a_index] != a_index) {
+			_parents[a_index] = _parents[_parents[a_index]];  // path halving
+			a_index = _parents[a_index];
 		}
+		return a_index;
 	}
 
-	[[nodiscard]] constexpr std::uint64_t id() const noexcept
+	void unite(index_type a_lhs, index_type a_rhs) noexcept
 	{
-		assert(assigned());
-		return *_id;
+		a_lhs = find(a_lhs);
+		a_rhs = find(a_rhs);
+		if (a_lhs == a_rhs) {
+			return;
+		}
+
+		if (_ranks[a_lhs] < _ranks[a_rhs]) {
+			std::swap(a_lhs, a_rhs);
+		}
+		_parents[a_rhs] = a_lhs;
+		if (_ranks[a_lhs] == _ranks[a_rhs]) {
+			++_ranks[a_lhs];
+		}
 	}
 
-	void link(Mapping* a_mapping) { _links.insert(a_mapping); }
+	[[nodiscard]] index_type size() const noexcept { return static_cast<index_type>(_parents.size()); }
 
 private:
-	std::set<Mapping*> _links;
-	std::optional<std::uint64_t> _id;
+	std::vector<index_type> _parents;
+	std::vector<std::uint8_t> _ranks;
 };
 
-using files_t = std::vector<std::tuple<Version, Version, std::filesystem::path>>;
+class Stopwatch
+{
+public:
+	void lap(std::string_view a_phase)
+	{
+		const auto now = clock::now();
+		std::cout
+			<< a_phase << ": "sv
+			<< std::fixed << std::setprecision(1)
+			<< std::chrono::duration<double, std::milli>(now - _last).count() << "ms"sv
+			<< std::endl;
+		_last = now;
+	}
 
-[[nodiscard]] files_t get_files(const std::filesystem::path& a_root)
+private:
+	using clock = std::chrono::steady_clock;
+
+	clock::time_point _last{ clock::now() };
+};
+
+using file_t = std::tuple<Version, Version, std::filesystem::path>;
+using files_t = std::vector<file_t>;
+
+// X.Y.Z_X.Y.Z.txt holds the mappings from the left version to the right one
+[[nodiscard]] std::optional<file_t> parse_filename(const std::filesystem::path& a_path)
 {
-	files_t results;
-	srell::wregex regex(L"(\\d+)\\.(\\d+)\\.(\\d+)_(\\d+)\\.(\\d+)\\.(\\d+)\\.txt"s, srell::regex::ECMAScript);
-	for (const auto& entry : std::filesystem::directory_iterator(a_root)) {
-		if (entry.is_regular_file()) {
-			const auto filename = entry.path().filename();
-			srell::wsmatch matches;
-			if (srell::regex_match(filename.native(), matches, regex) && matches.size() == 7) {
-				results.emplace_back();
-				auto& [lversion, rversion, path] = results.back();
+	static const srell::wregex regex(L"(\\d+)\\.(\\d+)\\.(\\d+)_(\\d+)\\.(\\d+)\\.(\\d+)\\.txt"s, srell::regex::ECMAScript);
 
-				const auto extract = [&]<std::size_t I>(std::in_place_index_t<I>) {
-					return static_cast<std::uint16_t>(std::stoull(matches[I]));
-				};
+	const auto filename = a_path.filename();
+	srell::wsmatch matches;
+	if (!srell::regex_match(filename.native(), matches, regex) || matches.size() != 7) {
+		return std::nullopt;
+	}
 
-				lversion[0] = extract(std::in_place_index<1>);
-				lversion[1] = extract(std::in_place_index<2>);
-				lversion[2] = extract(std::in_place_index<3>);
+	file_t result;
+	auto& [lversion, rversion, path] = result;
 
-				rversion[0] = extract(std::in_place_index<4>);
-				rversion[1] = extract(std::in_place_index<5>);
-				rversion[2] = extract(std::in_place_index<6>);
+	const auto extract = [&]<std::size_t I>(std::in_place_index_t<I>) {
+		return static_cast<std::uint16_t>(std::stoull(matches[I]));
+	};
+
+	lversion[0] = extract(std::in_place_index<1>);
+	lversion[1] = extract(std::in_place_index<2>);
+	lversion[2] = extract(std::in_place_index<3>);
 
-				path = entry.path();
+	rversion[0] = extract(std::in_place_index<4>);
+	rversion[1] = extract(std::in_place_index<5>);
+	rversion[2] = extract(std::in_place_index<6>);
+
+	path = a_path;
+	return result;
+}
+
+[[nodiscard]] files_t get_files(const std::filesystem::path& a_root)
+{
+	files_t results;
+	for (const auto& entry : std::filesystem::directory_iterator(a_root)) {
+		if (entry.is_regular_file()) {
+			if (auto file = parse_filename(entry.path()); file) {
+				results.push_back(std::move(*file));
 			}
 		}
 	}
 	return results;
 }
 
-using offset_map = robin_hood::unordered_node_map<std::uint64_t, Mapping>;
-//using offset_map = std::unordered_map<std::uint64_t, Mapping>;
+// ids are handed out in the iteration order of these maps, so they must stay node maps
+// which are filled in file order to keep the output stable
+using offset_map = robin_hood::unordered_node_map<std::uint64_t, DisjointSet::index_type>;
+//using offset_map = std::unordered_map<std::uint64_t, DisjointSet::index_type>;
 using version_map = std::map<Version, offset_map>;
+using pairs_t = std::vector<std::pair<std::uint64_t, std::uint64_t>>;
+
+struct Mappings
+{
+	version_map versions;
+	DisjointSet links;
+	std::vector<std::uint64_t> ids;  // indexed by mapping
+};
 
-[[nodiscard]] version_map load_mappings(const files_t& a_files)
+// parses a hex address the way std::stoull(a_field, 0, 16) does, up to the first non-hex digit
+[[nodiscard]] std::uint64_t parse_address(std::string_view a_field)
 {
-	version_map map;
-	std::ifstream file;
-	std::stringstream ss;
-	std::string line;
-	std::string lbuf;
-	std::string rbuf;
-
-	const auto find_or_emplace_version = [&map](const Version& a_version) -> offset_map& {
-		auto it = map.find(a_version);
-		if (it == map.end()) {
-			it = map.emplace(a_version, offset_map()).first;
+	const auto digit = [](char a_char) -> int {
+		if (a_char >= '0' && a_char <= '9') {
+			return a_char - '0';
+		} else if (a_char >= 'a' && a_char <= 'f') {
+			return a_char - 'a' + 10;
+		} else if (a_char >= 'A' && a_char <= 'F') {
+			return a_char - 'A' + 10;
+		} else {
+			return -1;
 		}
-		return it->second;
 	};
 
-	const auto find_or_emplace_address = [](offset_map& a_map, std::string a_address) -> Mapping& {
-		auto address = static_cast<std::uint64_t>(std::stoull(a_address, 0, 16));
-		address -= 0x140000000;
-		auto it = a_map.find(address);
-		if (it == a_map.end()) {
-			it = a_map.emplace(address, Mapping()).first;
+	auto it = a_field.begin();
+	const auto end = a_field.end();
+	while (it != end && (*it == ' ' || (*it >= '\t' && *it <= '\r'))) {
+		++it;
+	}
+	if (end - it > 2 && it[0] == '0' && (it[1] == 'x' || it[1] == 'X') && digit(it[2]) >= 0) {
+		it += 2;
+	}
+
+	std::uint64_t result = 0;
+	const auto first = it;
+	for (; it != end && digit(*it) >= 0; ++it) {
+		if ((result >> 60) != 0) {
+			throw std::out_of_range("address is out of range: "s + std::string(a_field));
 		}
-		return it->second;
+		result = (result << 4) | static_cast<std::uint64_t>(digit(*it));
+	}
+
+	if (it == first) {
+		throw std::invalid_argument("invalid address: "s + std::string(a_field));
+	}
+
+	return result - 0x140000000;
+}
+
+// each line holds the tab separated addresses of one mapping, in the left and right versions
+[[nodiscard]] pairs_t parse_file(const std::filesystem::path& a_path)
+{
+	mmio::mapped_file_source file;
+	if (!file.open(a_path)) {
+		throw std::runtime_error("failed to open file for read"s);
+	}
+
+	const std::string_view data{ reinterpret_cast<const char*>(file.data()), file.size() };
+	auto next_line = [&, pos = std::size_t{ 0 }]() mutable -> std::optional<std::string_view> {
+		if (pos >= data.size()) {
+			return std::nullopt;
+		}
+
+		const auto eol = data.find('\n', pos);
+		const auto line = data.substr(pos, eol == std::string_view::npos ? std::string_view::npos : eol - pos);
+		pos = eol == std::string_view::npos ? data.size() : eol + 1;
+		return line;
 	};
 
-	for (const auto& [lver, rver, path] : a_files) {
-		file.open(path);
-		if (!file.is_open()) {
-			throw std::runtime_error("failed to open file for read"s);
+	for (std::size_t i = 0; i < 18; ++i) {
+		(void)next_line();  // skip header
+	}
+
+	pairs_t results;
+	results.reserve(data.size() / 20);
+	while (const auto line = next_line()) {
+		const auto ltab = line->find('\t');
+		if (ltab == std::string_view::npos) {
+			continue;
 		}
-		for (std::size_t i = 0; i < 18; ++i) {
-			std::getline(file, line);  // skip header
+
+		const auto lbuf = line->substr(0, ltab);
+		const auto rbuf = line->substr(ltab + 1, line->find('\t', ltab + 1) - (ltab + 1));
+		if (!lbuf.empty() && !rbuf.empty()) {
+			results.emplace_back(parse_address(lbuf), parse_address(rbuf));
 		}
+	}
 
-		auto& laddr = find_or_emplace_version(lver);
-		auto& raddr = find_or_emplace_version(rver);
+	return results;
+}
 
-		while (std::getline(file, line)) {
-			ss.str(line);
-			ss.clear();
-			std::getline(ss, lbuf, '\t');
-			std::getline(ss, rbuf, '\t');
-			if (ss && !lbuf.empty() && !rbuf.empty()) {
-				auto& lmap = find_or_emplace_address(laddr, lbuf);
-				auto& rmap = find_or_emplace_address(raddr, rbuf);
-				lmap.link(std::addressof(rmap));
-				rmap.link(std::addressof(lmap));
-			}
+[[nodiscard]] std::vector<pairs_t> parse_files(const files_t& a_files)
+{
+	std::vector<std::future<pairs_t>> tasks;
+	tasks.reserve(a_files.size());
+	for (const auto& [lver, rver, path] : a_files) {
+		tasks.push_back(std::async(std::launch::async, parse_file, std::cref(path)));
+	}
+
+	std::vector<pairs_t> results;
+	results.reserve(tasks.size());
+	for (auto& task : tasks) {
+		results.push_back(task.get());
+	}
+	return results;
+}
+
+// links the parsed files in their original order, since that decides the iteration order of the version maps
+[[nodiscard]] Mappings link_mappings(const files_t& a_files, const std::vector<pairs_t>& a_pairs)
+{
+	Mappings mappings;
+	const auto find_or_emplace_address = [&](offset_map& a_map, std::uint64_t a_address) {
+		const auto [it, inserted] = a_map.try_emplace(a_address, mappings.links.size());
+		if (inserted) {
+			(void)mappings.links.make();
 		}
+		return it->second;
+	};
 
-		file.close();
+	for (std::size_t i = 0; i < a_files.size(); ++i) {
+		const auto& [lver, rver, path] = a_files[i];
+		auto& laddr = mappings.versions[lver];
+		auto& raddr = mappings.versions[rver];
+		for (const auto& [lbuf, rbuf] : a_pairs[i]) {
+			const auto lmap = find_or_emplace_address(laddr, lbuf);
+			const auto rmap = find_or_emplace_address(raddr, rbuf);
+			mappings.links.unite(lmap, rmap);
+		}
 	}
 
-	return map;
+	return mappings;
 }
 
-void assign_ids(version_map& a_versionMap)
+void assign_ids(Mappings& a_mappings)
 {
+	constexpr auto unassigned = (std::numeric_limits<std::uint64_t>::max)();
+
+	auto& links = a_mappings.links;
+	auto& ids = a_mappings.ids;
+	ids.assign(links.size(), unassigned);
+
 	std::uint64_t id = 0;
-	for (auto& [ver, offsetMap] : a_versionMap) {
-		for (auto& [offset, mapping] : offsetMap) {
-			if (!mapping.assigned()) {
-				mapping.assign(id++);
+	for (const auto& [ver, offsetMap] : a_mappings.versions) {
+		for (const auto& [offset, mapping] : offsetMap) {
+			auto& elem = ids[links.find(mapping)];
+			if (elem == unassigned) {
+				elem = id++;
 			}
 		}
 	}
+
+	for (DisjointSet::index_type i = 0; i < links.size(); ++i) {
+		ids[i] = ids[links.find(i)];
+	}
 }
 
-void write_binaries(version_map& a_versionMap)
+// "ADDRLIB\0", which can never be mistaken for the mapping count of a v1 database
+inline constexpr std::uint64_t MAGIC = 0x0042494C52444441;
+
+struct Header
 {
-	std::ofstream file;
-	const auto binary_write = [&file](auto&& a_data) {
-		file.write(
-			reinterpret_cast<const char*>(std::addressof(a_data)),
-			sizeof(std::remove_reference_t<decltype(a_data)>));
+	enum Flag : std::uint32_t
+	{
+		kNone = 0,
+		kDense = 1u << 0,
 	};
 
-	std::string filename;
-	std::vector<std::pair<std::uint64_t, Mapping>> mappings;
-	for (const auto& [ver, offsetMap] : a_versionMap) {
-		filename = "version-"sv;
-		filename += ver.string();
-		filename += ".bin"sv;
-		file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+	std::uint64_t magic{ MAGIC };
+	std::uint32_t format{ 2 };
+	std::uint32_t flags{ kNone };
+	std::uint64_t count{ 0 };
+	std::uint64_t idLimit{ 0 };
+	std::uint64_t packedSize{ 0 };
+};
+static_assert(sizeof(Header) == 0x28);
+
+void write_varint(std::vector<std::uint8_t>& a_buf, std::uint64_t a_value)
+{
+	while (a_value >= 0x80) {
+		a_buf.push_back(static_cast<std::uint8_t>(a_value | 0x80));
+		a_value >>= 7;
+	}
+	a_buf.push_back(static_cast<std::uint8_t>(a_value));
+}
+
+// v1: u64 count, followed by {u64 id, u64 offset} sorted by id
+void write_v1(std::ofstream& a_file, std::span<const std::pair<std::uint64_t, std::uint64_t>> a_mappings)
+{
+	const auto binary_write = [&](std::uint64_t a_data) {
+		a_file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+	};
+
+	binary_write(static_cast<std::uint64_t>(a_mappings.size()));
+	for (const auto& [id, offset] : a_mappings) {
+		binary_write(id);
+		binary_write(offset);
+	}
+}
+
+// v2: header, followed by {varint offset delta, varint id} sorted by offset,
+// followed by an optional u32 offset per id, aligned to 4 bytes
+void write_v2(
+	std::ofstream& a_file,
+	std::span<const std::pair<std::uint64_t, std::uint64_t>> a_mappings,
+	std::span<const std::pair<std::uint64_t, std::uint64_t>> a_byOffset)
+{
+	constexpr auto invalid = (std::numeric_limits<std::uint32_t>::max)();
+	constexpr std::size_t denseSpread = 4;  // sizeof({u64, u64}) / sizeof(u32)
+
+	Header header;
+	header.count = a_mappings.size();
+	header.idLimit = a_mappings.empty() ? 0 : a_mappings.back().first + 1;
+
+	std::vector<std::uint8_t> packed;
+	packed.reserve(a_byOffset.size() * 5);
+	std::uint64_t prev = 0;
+	for (const auto& [id, offset] : a_byOffset) {
+		write_varint(packed, offset - prev);
+		write_varint(packed, id);
+		prev = offset;
+	}
+	header.packedSize = packed.size();
+
+	std::vector<std::uint32_t> dense;
+	const bool fits = std::all_of(
+		a_mappings.begin(),
+		a_mappings.end(),
+		[](auto&& a_elem) { return a_elem.second < invalid; });
+	if (fits && header.idLimit > 0 && header.idLimit <= a_mappings.size() * denseSpread) {
+		header.flags |= Header::kDense;
+		dense.resize(static_cast<std::size_t>(header.idLimit), invalid);
+		for (const auto& [id, offset] : a_mappings) {
+			// the runtime sorts packed mappings by id, then offset, so a search finds the lowest
+			auto& elem = dense[static_cast<std::size_t>(id)];
+			elem = (std::min)(elem, static_cast<std::uint32_t>(offset));
+		}
+	}
+
+	a_file.write(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+	a_file.write(reinterpret_cast<const char*>(packed.data()), static_cast<std::streamsize>(packed.size()));
+	if (!dense.empty()) {
+		constexpr std::array<char, 4> padding{};
+		const auto misalign = (sizeof(header) + packed.size()) % sizeof(std::uint32_t);
+		if (misalign != 0) {
+			a_file.write(padding.data(), static_cast<std::streamsize>(sizeof(std::uint32_t) - misalign));
+		}
+		a_file.write(reinterpret_cast<const char*>(dense.data()), static_cast<std::streamsize>(dense.size() * sizeof(std::uint32_t)));
+	}
+}
+
+// "ADDROFS\0"
+inline constexpr std::uint64_t OFFSETS_MAGIC = 0x0053464F52444441;
+
+struct OffsetsHeader
+{
+	std::uint64_t magic{ OFFSETS_MAGIC };
+	std::uint32_t format{ 2 };
+	std::uint32_t pad0C{ 0 };
+	std::uint64_t count{ 0 };
+	std::uint64_t sourceSize{ 0 };
+	std::uint64_t sourceHash{ 0 };
+};
+static_assert(sizeof(OffsetsHeader) == 0x28);
+
+// must match REL::IDDatabase::source_hash, which the runtime checks before it trusts an index
+[[nodiscard]] std::uint64_t source_hash(std::span<const std::byte> a_bytes) noexcept
+{
+	constexpr std::uint64_t prime = 0x100000001B3;
+	std::uint64_t hash = 0xCBF29CE484222325;
+	for (std::size_t i = 0; i < a_bytes.size(); i += sizeof(std::uint64_t)) {
+		std::uint64_t word = 0;
+		std::memcpy(std::addressof(word), a_bytes.data() + i, (std::min)(sizeof(word), a_bytes.size() - i));
+		hash = (hash ^ word) * prime;
+	}
+	return hash;
+}
+
+// offset index: header, followed by {u64 id, u64 offset} sorted by offset, then id,
+// which the runtime maps as is instead of sorting the database itself. a_source is
+// the database it was sorted from, which the header identifies
+void write_offsets(
+	std::ofstream& a_file,
+	std::span<const std::pair<std::uint64_t, std::uint64_t>> a_byOffset,
+	const std::filesystem::path& a_source)
+{
+	const auto binary_write = [&](std::uint64_t a_data) {
+		a_file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+	};
+
+	mmio::mapped_file_source source;
+	if (!source.open(a_source)) {
+		throw std::runtime_error("failed to open: "s + a_source.string());
+	}
+
+	OffsetsHeader header;
+	header.count = a_byOffset.size();
+	header.sourceSize = source.size();
+	header.sourceHash = source_hash({ reinterpret_cast<const std::byte*>(source.data()), source.size() });
+	a_file.write(reinterpret_cast<const char*>(std::addressof(header)), sizeof(header));
+	for (const auto& [id, offset] : a_byOffset) {
+		binary_write(id);
+		binary_write(offset);
+	}
+}
+
+// the {id, offset} pairs of every version, sorted by id
+using tables_t = std::map<Version, pairs_t>;
+
+// sorted by id alone, from the order of the version maps, so offsets which share an id keep
+// the order they have always been written in
+[[nodiscard]] tables_t make_tables(const Mappings& a_mappings)
+{
+	tables_t results;
+	for (const auto& [ver, offsetMap] : a_mappings.versions) {
+		auto& table = results[ver];
+		table.reserve(offsetMap.size());
+		for (const auto& [offset, mapping] : offsetMap) {
+			table.emplace_back(a_mappings.ids[mapping], offset);
+		}
+		std::sort(
+			table.begin(),
+			table.end(),
+			[](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.first < a_rhs.first;
+			});
+	}
+	return results;
+}
+
+void write_binary(const Version& a_version, const pairs_t& a_mappings, std::uint32_t a_format)
+{
+	std::ofstream file;
+	const auto filename = [&](std::string_view a_suffix) {
+		auto result = "version-"s;
+		result += a_version.string();
+		result += a_suffix;
+		return result;
+	};
+	const auto open = [&](std::string_view a_suffix) {
+		file.open(filename(a_suffix), std::ios::out | std::ios::binary | std::ios::trunc);
 		if (!file.is_open()) {
 			throw std::runtime_error("failed to open file for write"s);
 		}
+	};
+
+	auto byOffset = a_mappings;
+	std::sort(
+		byOffset.begin(),
+		byOffset.end(),
+		[](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.second != a_rhs.second ?
+                       a_lhs.second < a_rhs.second :
+                       a_lhs.first < a_rhs.first;
+		});
+
+	open(".bin"sv);
+	if (a_format == 1) {
+		write_v1(file, a_mappings);
+	} else {
+		write_v2(file, a_mappings, byOffset);
+	}
+	file.close();
 
-		mappings.clear();
-		mappings.reserve(offsetMap.size());
-		for (const auto& [first, second] : offsetMap) {
-			mappings.emplace_back(first, second);
+	open(".offsets.bin"sv);
+	write_offsets(file, byOffset, filename(".bin"sv));
+	file.close();
+}
+
+void write_binaries(const tables_t& a_tables, std::uint32_t a_format)
+{
+	for (const auto& [ver, table] : a_tables) {
+		write_binary(ver, table, a_format);
+	}
+}
+
+// "ADDRSTA\0"
+inline constexpr std::uint64_t STATE_MAGIC = 0x0041545352444441;
+
+// the id assignment state, which lets new versions be added without a full rebuild
+struct StateHeader
+{
+	std::uint64_t magic{ STATE_MAGIC };
+	std::uint32_t format{ 1 };
+	std::uint32_t versions{ 0 };
+	std::uint64_t nextID{ 0 };
+};
+static_assert(sizeof(StateHeader) == 0x18);
+
+struct State
+{
+	tables_t tables;
+	std::uint64_t nextID{ 0 };
+};
+
+[[nodiscard]] std::uint64_t next_id(const tables_t& a_tables) noexcept
+{
+	std::uint64_t result = 0;
+	for (const auto& [ver, table] : a_tables) {
+		if (!table.empty()) {
+			result = (std::max)(result, table.back().first + 1);
 		}
+	}
+	return result;
+}
+
+// state: header, followed by every version as {u16[4] version, u64 count, u64 packed size},
+// and its mappings as {varint offset delta, varint id} sorted by offset
+void write_state(const std::filesystem::path& a_path, const State& a_state)
+{
+	std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file for write"s);
+	}
+
+	const auto binary_write = [&]<class T>(const T& a_data) {
+		file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+	};
+
+	StateHeader header;
+	header.versions = static_cast<std::uint32_t>(a_state.tables.size());
+	header.nextID = a_state.nextID;
+	binary_write(header);
+
+	pairs_t byOffset;
+	std::vector<std::uint8_t> packed;
+	for (const auto& [ver, table] : a_state.tables) {
+		byOffset.assign(table.begin(), table.end());
 		std::sort(
-			mappings.begin(),
-			mappings.end(),
+			byOffset.begin(),
+			byOffset.end(),
 			[](auto&& a_lhs, auto&& a_rhs) {
-				return a_lhs.second.id() < a_rhs.second.id();
+				return a_lhs.second != a_rhs.second ?
+                           a_lhs.second < a_rhs.second :
+                           a_lhs.first < a_rhs.first;
 			});
 
-		binary_write(static_cast<std::uint64_t>(mappings.size()));
-		for (const auto& [offset, mapped] : mappings) {
-			binary_write(mapped.id());
-			binary_write(offset);
+		packed.clear();
+		std::uint64_t prev = 0;
+		for (const auto& [id, offset] : byOffset) {
+			write_varint(packed, offset - prev);
+			write_varint(packed, id);
+			prev = offset;
 		}
 
-		file.close();
+		for (std::size_t i = 0; i < 4; ++i) {
+			binary_write(ver[i]);
+		}
+		binary_write(static_cast<std::uint64_t>(table.size()));
+		binary_write(static_cast<std::uint64_t>(packed.size()));
+		file.write(reinterpret_cast<const char*>(packed.data()), static_cast<std::streamsize>(packed.size()));
 	}
 }
 
-int main()
+[[nodiscard]] State read_state(const std::filesystem::path& a_path)
+{
+	mmio::mapped_file_source file;
+	if (!file.open(a_path)) {
+		throw std::runtime_error("failed to open state for read: "s + a_path.string());
+	}
+
+	auto it = reinterpret_cast<const std::uint8_t*>(file.data());
+	const auto end = it + file.size();
+	const auto binary_read = [&]<class T>(std::in_place_type_t<T>) {
+		if (static_cast<std::size_t>(end - it) < sizeof(T)) {
+			throw std::runtime_error("state is truncated"s);
+		}
+		T result;
+		std::memcpy(std::addressof(result), it, sizeof(T));
+		it += sizeof(T);
+		return result;
+	};
+	const auto read_varint = [&]() {
+		std::uint64_t result = 0;
+		for (std::uint32_t shift = 0; shift < 64; shift += 7) {
+			if (it == end) {
+				throw std::runtime_error("state is truncated"s);
+			}
+			const auto byte = *it++;
+			result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) {
+				return result;
+			}
+		}
+		throw std::runtime_error("state is malformed"s);
+	};
+
+	const auto header = binary_read(std::in_place_type<StateHeader>);
+	if (header.magic != STATE_MAGIC || header.format != 1) {
+		throw std::runtime_error("unsupported state: "s + a_path.string());
+	}
+
+	State result;
+	result.nextID = header.nextID;
+	for (std::uint32_t i = 0; i < header.versions; ++i) {
+		Version ver;
+		for (std::size_t j = 0; j < 4; ++j) {
+			ver[j] = binary_read(std::in_place_type<Version::value_type>);
+		}
+		const auto count = binary_read(std::in_place_type<std::uint64_t>);
+		(void)binary_read(std::in_place_type<std::uint64_t>);  // packed size
+
+		auto& table = result.tables[ver];
+		table.reserve(static_cast<std::size_t>(count));
+		std::uint64_t offset = 0;
+		for (std::uint64_t j = 0; j < count; ++j) {
+			offset += read_varint();
+			const auto id = read_varint();
+			table.emplace_back(id, offset);
+		}
+		std::sort(table.begin(), table.end());
+	}
+
+	return result;
+}
+
+// links the new mappings the same way a full rebuild would, so that offsets which are new
+// to the right version get fresh ids in the order a full rebuild would hand them out
+[[nodiscard]] pairs_t assign_incremental(const pairs_t& a_known, const pairs_t& a_pairs, std::uint64_t& a_nextID)
+{
+	constexpr auto unassigned = (std::numeric_limits<std::uint64_t>::max)();
+
+	robin_hood::unordered_flat_map<std::uint64_t, std::uint64_t> known;
+	known.reserve(a_known.size());
+	for (const auto& [id, offset] : a_known) {
+		known.try_emplace(offset, id);
+	}
+
+	offset_map laddr;
+	offset_map raddr;
+	DisjointSet links;
+	const auto find_or_emplace_address = [&](offset_map& a_map, std::uint64_t a_address) {
+		const auto [it, inserted] = a_map.try_emplace(a_address, links.size());
+		if (inserted) {
+			(void)links.make();
+		}
+		return it->second;
+	};
+
+	for (const auto& [lbuf, rbuf] : a_pairs) {
+		const auto lmap = find_or_emplace_address(laddr, lbuf);
+		const auto rmap = find_or_emplace_address(raddr, rbuf);
+		links.unite(lmap, rmap);
+	}
+
+	std::vector<std::uint64_t> ids(links.size(), unassigned);
+	std::size_t merged = 0;
+	for (const auto& [offset, mapping] : laddr) {
+		const auto it = known.find(offset);
+		if (it == known.end()) {
+			continue;
+		}
+
+		auto& elem = ids[links.find(mapping)];
+		if (elem != unassigned && elem != it->second) {
+			++merged;
+		}
+		elem = (std::min)(elem, it->second);
+	}
+
+	if (merged > 0) {  // a full rebuild would renumber these, so keep the lowest id instead
+		std::cerr << "warning: "sv << merged << " existing ids are linked together by the new mappings"sv << std::endl;
+	}
+
+	pairs_t results;
+	results.reserve(raddr.size());
+	for (const auto& [offset, mapping] : raddr) {
+		auto& elem = ids[links.find(mapping)];
+		if (elem == unassigned) {
+			elem = a_nextID++;
+		}
+		results.emplace_back(elem, offset);
+	}
+	std::sort(results.begin(), results.end());
+	return results;
+}
+
+[[nodiscard]] tables_t rebuild()
+{
+	Stopwatch stopwatch;
+	const auto files = get_files("mappings"sv);
+	stopwatch.lap("scan"sv);
+	const auto pairs = parse_files(files);
+	stopwatch.lap("parse"sv);
+	auto mappings = link_mappings(files, pairs);
+	stopwatch.lap("link"sv);
+	assign_ids(mappings);
+	stopwatch.lap("assign"sv);
+	auto tables = make_tables(mappings);
+	stopwatch.lap("tabulate"sv);
+	return tables;
+}
+
+// checks what an incremental run guarantees. a full rebuild is no reference, since it links every version
+// at once, which merges components and renumbers the ids earlier versions shipped with. instead, offsets
+// in the new version share an id exactly when the mappings link them, directly or through a known id,
+// every offset linked to a known one keeps the lowest of those ids, and every other id is new
+void verify(const pairs_t& a_known, const pairs_t& a_pairs, const pairs_t& a_table, std::uint64_t a_firstNew)
+{
+	constexpr auto none = (std::numeric_limits<std::uint64_t>::max)();
+	const auto fail = [](std::string_view a_reason) {
+		throw std::runtime_error("verification failed: "s + std::string(a_reason));
+	};
+
+	robin_hood::unordered_flat_map<std::uint64_t, std::uint64_t> known;
+	for (const auto& [id, offset] : a_known) {
+		known.try_emplace(offset, id);
+	}
+
+	robin_hood::unordered_flat_map<std::uint64_t, std::uint64_t> assigned;
+	for (const auto& [id, offset] : a_table) {
+		if (!assigned.try_emplace(offset, id).second) {
+			fail("an offset has several ids"sv);
+		}
+	}
+
+	offset_map laddr;
+	offset_map raddr;
+	DisjointSet links;
+	const auto find_or_emplace_address = [&](offset_map& a_map, std::uint64_t a_address) {
+		const auto [it, inserted] = a_map.try_emplace(a_address, links.size());
+		if (inserted) {
+			(void)links.make();
+		}
+		return it->second;
+	};
+
+	for (const auto& [lbuf, rbuf] : a_pairs) {
+		links.unite(find_or_emplace_address(laddr, lbuf), find_or_emplace_address(raddr, rbuf));
+	}
+
+	if (raddr.size() != assigned.size()) {
+		fail("the new version does not hold exactly the offsets its mappings name"sv);
+	}
+
+	// the lowest known id linked to each component, and how many distinct ones it links
+	std::vector<std::uint64_t> lowest(links.size(), none);
+	std::vector<std::uint64_t> highest(links.size(), 0);
+	for (const auto& [offset, mapping] : laddr) {
+		if (const auto it = known.find(offset); it != known.end()) {
+			const auto root = links.find(mapping);
+			lowest[root] = (std::min)(lowest[root], it->second);
+			highest[root] = (std::max)(highest[root], it->second);
+		}
+	}
+
+	std::size_t kept = 0;
+	robin_hood::unordered_flat_map<std::uint64_t, DisjointSet::index_type> fresh;  // new id -> component
+	robin_hood::unordered_flat_set<DisjointSet::index_type> merged;
+	for (const auto& [offset, mapping] : raddr) {
+		const auto root = links.find(mapping);
+		const auto it = assigned.find(offset);
+		if (it == assigned.end()) {
+			fail("an offset of the new version has no id"sv);
+		}
+
+		const auto id = it->second;
+		if (lowest[root] != none) {
+			if (id != lowest[root]) {
+				fail("an offset linked to a known id did not keep it"sv);
+			}
+			++kept;
+			if (highest[root] != lowest[root]) {
+				merged.insert(root);
+			}
+		} else if (id < a_firstNew) {
+			fail("an unlinked offset reuses an existing id"sv);
+		} else if (const auto [elem, inserted] = fresh.try_emplace(id, root); !inserted && elem->second != root) {
+			fail("offsets which are not linked share a new id"sv);
+		}
+	}
+
+	std::cout
+		<< "verified "sv << raddr.size() << " offsets: "sv
+		<< kept << " keep a known id, "sv
+		<< (raddr.size() - kept) << " have "sv << fresh.size() << " new ids"sv << std::endl;
+	if (!merged.empty()) {
+		std::cout << merged.size() << " components link several known ids, and keep the lowest"sv << std::endl;
+	}
+}
+
+int main(int a_argc, char* a_argv[])
 {
 	try {
-		auto mappings = load_mappings(get_files("mappings"sv));
-		assign_ids(mappings);
-		write_binaries(mappings);
+		std::uint32_t format = 2;
+		std::filesystem::path state = "addresslib.state"sv;
+		std::optional<std::filesystem::path> incremental;
+		bool verifying = false;
+		for (int i = 1; i < a_argc; ++i) {
+			const std::string_view arg = a_argv[static_cast<std::size_t>(i)];
+			if (arg == "--format"sv && i + 1 < a_argc) {
+				format = static_cast<std::uint32_t>(std::stoul(a_argv[static_cast<std::size_t>(++i)]));
+			} else if (arg == "--state"sv && i + 1 < a_argc) {
+				state = a_argv[static_cast<std::size_t>(++i)];
+			} else if (arg == "--incremental"sv && i + 1 < a_argc) {
+				incremental = a_argv[static_cast<std::size_t>(++i)];
+			} else if (arg == "--verify"sv) {
+				verifying = true;
+			} else {
+				throw std::runtime_error("unrecognized argument: "s + std::string(arg));
+			}
+		}
+
+		if (format != 1 && format != 2) {
+			throw std::runtime_error("unsupported format: "s + std::to_string(format));
+		} else if (verifying && !incremental) {
+			throw std::runtime_error("--verify requires --incremental"s);
+		}
+
+		if (!incremental) {
+			const auto tables = rebuild();
+			Stopwatch stopwatch;
+			write_binaries(tables, format);
+			write_state(state, { tables, next_id(tables) });
+			stopwatch.lap("write"sv);
+			return EXIT_SUCCESS;
+		}
+
+		const auto file = parse_filename(*incremental);
+		if (!file) {
+			throw std::runtime_error("not a mapping file: "s + incremental->string());
+		}
+
+		const auto& [lver, rver, path] = *file;
+		Stopwatch stopwatch;
+		auto current = read_state(state);
+		stopwatch.lap("load state"sv);
+		const auto known = current.tables.find(lver);
+		if (known == current.tables.end()) {
+			throw std::runtime_error("unknown version: "s + lver.string());
+		} else if (current.tables.contains(rver)) {
+			throw std::runtime_error("version already exists: "s + rver.string());
+		}
+
+		const auto pairs = parse_file(path);
+		stopwatch.lap("parse"sv);
+		const auto firstNew = current.nextID;
+		const auto& table = current.tables[rver] = assign_incremental(known->second, pairs, current.nextID);
+		stopwatch.lap("assign"sv);
+
+		if (verifying) {  // before anything is written, so a failure leaves the outputs untouched
+			verify(known->second, pairs, table, firstNew);
+			stopwatch.lap("verify"sv);
+		}
+
+		write_binary(rver, table, format);
+		write_state(state, current);
+		stopwatch.lap("write"sv);
 	} catch (const std::exception& e) {
 		std::cerr << e.what() << std::endl;
 		return EXIT_FAILURE;
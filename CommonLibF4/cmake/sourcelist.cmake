@@ -111,6 +111,7 @@ set(SOURCES
 	include/RE/Bethesda/BSDevices/BSInterfaceDevice.h
 	include/RE/Bethesda/BSDevices/XPrefSettings.h
 	include/RE/Bethesda/BSExtraData.h
+	include/RE/Bethesda/BSExtraDataAlg.h
 	include/RE/Bethesda/BSGeometry.h
 	include/RE/Bethesda/BSGraphics/BSGraphics.h
 	include/RE/Bethesda/BSGraphics/BSGraphicsHandles.h
@@ -401,10 +402,12 @@ set(SOURCES
 	include/RE/Bethesda/ControlMap.h
 	include/RE/Bethesda/CreateNS.h
 	include/RE/Bethesda/DrawWorld.h
+	include/RE/Bethesda/EventDispatcher.h
 	include/RE/Bethesda/Events.h
 	include/RE/Bethesda/FavoritesManager.h
 	include/RE/Bethesda/FormComponents.h
 	include/RE/Bethesda/FormFactory.h
+	include/RE/Bethesda/FormLookupCache.h
 	include/RE/Bethesda/FormUtil.h
 	include/RE/Bethesda/GamePlayFormulas.h
 	include/RE/Bethesda/GameScript.h
@@ -432,6 +435,7 @@ set(SOURCES
 	include/RE/Bethesda/PipboyManager.h
 	include/RE/Bethesda/PlayerCharacter.h
 	include/RE/Bethesda/PlayerControls.h
+	include/RE/Bethesda/PluginCatalog.h
 	include/RE/Bethesda/PowerArmor.h
 	include/RE/Bethesda/PowerUtils.h
 	include/RE/Bethesda/ProcessLists.h
@@ -968,6 +972,7 @@ set(SOURCES
 	include/RE/NetImmerse/NiUpdateData.h
 	include/RE/NiRTTI_IDs.h
 	include/RE/RTTI.h
+	include/RE/RTTICache.h
 	include/RE/RTTI_IDs.h
 	include/RE/Scaleform/GFx/GFx_AS3.h
 	include/RE/Scaleform/GFx/GFx_ASMovieRootBase.h
@@ -1327,10 +1332,12 @@ set(SOURCES
 	include/RE/Shared/Water/BGSWaterAudio.h
 	include/RE/Shared/Water/BGSWaterCollisionManager.h
 	include/RE/Shared/Water/TESWater.h
+	include/RE/SnapshotDomain.h
 	include/RE/VTABLE_IDs.h
 	include/RE/msvc/functional.h
 	include/RE/msvc/memory.h
 	include/RE/msvc/typeinfo.h
+	include/REL/IDList.h
 	include/REL/Relocation.h
 	src/F4SE/API.cpp
 	src/F4SE/Impl/PCH.cpp
@@ -1375,7 +1382,9 @@ set(SOURCES
 	src/RE/Bethesda/Calendar.cpp
 	src/RE/Bethesda/DrawWorld.cpp
 	src/RE/Bethesda/FormComponents.cpp
+	src/RE/Bethesda/FormLookupCache.cpp
 	src/RE/Bethesda/MenuCursor.cpp
+	src/RE/Bethesda/PluginCatalog.cpp
 	src/RE/Bethesda/TESBoundAnimObjects.cpp
 	src/RE/Bethesda/TESForms.cpp
 	src/RE/Bethesda/TESObjectREFRs.cpp
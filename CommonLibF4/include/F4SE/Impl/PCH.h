@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cassert>
+#include <cctype>
+#include <chrono>
 #include <cmath>
 #include <compare>
 #include <concepts>
@@ -12,6 +15,8 @@
 #include <cstdint>
 #include <cstring>
 #include <ctime>
+#include <cwctype>
+#include <deque>
 #include <execution>
 #include <filesystem>
 #include <functional>
@@ -20,6 +25,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <optional>
 #include <random>
@@ -29,6 +35,7 @@
 #include <stack>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
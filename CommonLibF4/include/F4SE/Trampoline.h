@@ -36,11 +36,34 @@ namespace F4SE
 		}
 	}
 
+	// the os pages beneath a trampoline, which can be swapped out to drive one outside of the game
+	class PageAllocator
+	{
+	public:
+		virtual ~PageAllocator() = default;
+
+		// commits at least a_size bytes of executable memory, no further than a_range bytes from a_address
+		[[nodiscard]] virtual void* allocate(std::uintptr_t a_address, std::size_t a_range, std::size_t a_size) = 0;
+		virtual void deallocate(void* a_mem, std::size_t a_size) noexcept = 0;
+
+		// the alignment and size of allocations
+		[[nodiscard]] virtual std::size_t granularity() const noexcept = 0;
+
+		[[nodiscard]] static PageAllocator& get() noexcept;
+	};
+
 	class Trampoline
 	{
 	public:
 		using deleter_type = std::function<void(void* a_mem, std::size_t a_size)>;
 
+		struct hook_t
+		{
+			std::uintptr_t src;
+			std::uintptr_t dst;
+			std::size_t size;  // bytes of trampoline the hook took, or 0 if it shares another hook's branch
+		};
+
 		Trampoline() noexcept = default;
 		Trampoline(const Trampoline&) = delete;
 
@@ -50,6 +73,11 @@ namespace F4SE
 			_name(a_name)
 		{}
 
+		Trampoline(std::string_view a_name, PageAllocator& a_pages) :
+			_name(a_name),
+			_pages(std::addressof(a_pages))
+		{}
+
 		~Trampoline() noexcept { release(); }
 
 		Trampoline& operator=(const Trampoline&) = delete;
@@ -75,15 +103,17 @@ namespace F4SE
 				a_module = text.pointer<std::byte>() + text.size();
 			}
 
-			auto mem = do_create(a_size, reinterpret_cast<std::uintptr_t>(a_module));
+			auto& pages = get_pages();
+			auto mem = pages.allocate(reinterpret_cast<std::uintptr_t>(a_module), BRANCH_RANGE, a_size);
 			if (!mem) {
 				stl::report_and_fail("failed to create trampoline"sv);
 			}
 
 			set_trampoline(mem, a_size,
-				[](void* a_mem, std::size_t) {
-					WinAPI::VirtualFree(a_mem, 0, (WinAPI::MEM_RELEASE));
+				[&pages](void* a_mem, std::size_t a_size) {
+					pages.deallocate(a_mem, a_size);
 				});
+			_origin = reinterpret_cast<std::uintptr_t>(a_module);
 		}
 
 		void set_trampoline(void* a_trampoline, std::size_t a_size) { set_trampoline(a_trampoline, a_size, {}); }
@@ -98,17 +128,27 @@ namespace F4SE
 
 			release();
 
-			_deleter = std::move(a_deleter);
-			_data = trampoline;
-			_capacity = a_size;
-			_size = 0;
+			if (trampoline) {
+				_regions.push_back({ std::move(a_deleter), trampoline, a_size, 0 });
+			}
+			_origin = reinterpret_cast<std::uintptr_t>(trampoline);
 
 			log_stats();
 		}
 
+		// allocations which do not fit in any region grow the trampoline with a new one,
+		// within branch range of the first region
 		[[nodiscard]] void* allocate(std::size_t a_size)
 		{
-			auto result = do_allocate(a_size);
+			auto result = do_allocate(a_size, 0);
+			log_stats();
+			return result;
+		}
+
+		// allocates in whichever region is nearest to a_near, and still in branch range of it
+		[[nodiscard]] void* allocate(std::size_t a_size, std::uintptr_t a_near)
+		{
+			auto result = do_allocate(a_size, a_near);
 			log_stats();
 			return result;
 		}
@@ -123,10 +163,51 @@ namespace F4SE
 			return static_cast<T*>(allocate(sizeof(T)));
 		}
 
-		[[nodiscard]] constexpr std::size_t empty() const noexcept { return _capacity == 0; }
-		[[nodiscard]] constexpr std::size_t capacity() const noexcept { return _capacity; }
-		[[nodiscard]] constexpr std::size_t allocated_size() const noexcept { return _size; }
-		[[nodiscard]] constexpr std::size_t free_size() const noexcept { return _capacity - _size; }
+		[[nodiscard]] std::size_t empty() const noexcept { return capacity() == 0; }
+
+		[[nodiscard]] std::size_t capacity() const noexcept
+		{
+			std::size_t result = 0;
+			for (const auto& region : _regions) {
+				result += region.capacity;
+			}
+			return result;
+		}
+
+		[[nodiscard]] std::size_t allocated_size() const noexcept
+		{
+			std::size_t result = 0;
+			for (const auto& region : _regions) {
+				result += region.size;
+			}
+			return result;
+		}
+
+		[[nodiscard]] std::size_t free_size() const noexcept { return capacity() - allocated_size(); }
+
+		[[nodiscard]] std::size_t region_count() const noexcept { return _regions.size(); }
+
+		[[nodiscard]] double utilisation() const noexcept
+		{
+			const auto total = capacity();
+			return total > 0 ?
+                       static_cast<double>(allocated_size()) / static_cast<double>(total) :
+                       0.0;
+		}
+
+		// every branch and call written through this trampoline, in order. space taken directly
+		// through allocate, such as xbyak code, belongs to no hook and is only in allocated_size
+		[[nodiscard]] std::span<const hook_t> hooks() const noexcept { return _hooks; }
+
+		// the trampoline bytes taken by the branches and calls from a_src
+		[[nodiscard]] std::size_t hook_size(std::uintptr_t a_src) const noexcept
+		{
+			std::size_t result = 0;
+			for (const auto& hook : _hooks) {
+				result += hook.src == a_src ? hook.size : 0;
+			}
+			return result;
+		}
 
 		template <std::size_t N>
 		std::uintptr_t write_branch(std::uintptr_t a_src, std::uintptr_t a_dst)
@@ -179,7 +260,16 @@ namespace F4SE
 		}
 
 	private:
-		[[nodiscard]] static void* do_create(std::size_t a_size, std::uintptr_t a_address);
+		struct region_t
+		{
+			deleter_type deleter;
+			std::byte* data;
+			std::size_t capacity;
+			std::size_t size;
+		};
+
+		// how far a new region may be placed from the address it serves
+		static constexpr std::size_t BRANCH_RANGE = static_cast<std::size_t>(1) << 31;
 
 		[[nodiscard]] static bool in_range(std::ptrdiff_t a_disp)
 		{
@@ -189,18 +279,69 @@ namespace F4SE
 			return min <= a_disp && a_disp <= max;
 		}
 
-		[[nodiscard]] void* do_allocate(std::size_t a_size)
+		// whether every byte of [a_mem, a_mem + a_size) can be reached from a_near with a rel32
+		[[nodiscard]] static bool in_range(std::uintptr_t a_near, const std::byte* a_mem, std::size_t a_size)
 		{
-			if (a_size > free_size()) {
-				stl::report_and_fail("Failed to handle allocation request"sv);
+			const auto first = reinterpret_cast<std::intptr_t>(a_mem) - static_cast<std::intptr_t>(a_near);
+			return in_range(first) && in_range(first + static_cast<std::intptr_t>(a_size));
+		}
+
+		[[nodiscard]] PageAllocator& get_pages() const noexcept { return _pages ? *_pages : PageAllocator::get(); }
+
+		[[nodiscard]] void* do_allocate(std::size_t a_size, std::uintptr_t a_near)
+		{
+			// with no preference, stay in reach of the module the trampoline was created for
+			const auto near = a_near != 0 ? a_near : _origin;
+			region_t* best = nullptr;
+			std::size_t bestDistance = 0;
+			for (auto& region : _regions) {
+				const auto mem = region.data + region.size;
+				if (a_size > region.capacity - region.size) {
+					continue;
+				} else if (near == 0) {  // nothing to be near, so fill regions in order
+					best = std::addressof(region);
+					break;
+				} else if (in_range(near, mem, a_size)) {
+					const auto address = reinterpret_cast<std::uintptr_t>(mem);
+					const auto distance = address < near ? near - address : address - near;
+					if (!best || distance < bestDistance) {
+						best = std::addressof(region);
+						bestDistance = distance;
+					}
+				}
+			}
+
+			if (!best) {
+				best = grow(a_size, near);
 			}
 
-			auto mem = _data + _size;
-			_size += a_size;
+			auto mem = best->data + best->size;
+			best->size += a_size;
 
 			return mem;
 		}
 
+		[[nodiscard]] region_t* grow(std::size_t a_size, std::uintptr_t a_near)
+		{
+			auto& pages = get_pages();
+			const auto size = detail::roundup(
+				(std::max)(a_size, _regions.empty() ? 0 : _regions.front().capacity),
+				pages.granularity());
+			auto mem = static_cast<std::byte*>(pages.allocate(a_near, BRANCH_RANGE - size, size));
+			if (!mem || (a_near != 0 && !in_range(a_near, mem, size))) {
+				if (mem) {
+					pages.deallocate(mem, size);
+				}
+				stl::report_and_fail("Failed to handle allocation request"sv);
+			}
+
+			constexpr auto INT3 = static_cast<int>(0xCC);
+			std::memset(mem, INT3, size);
+
+			_regions.push_back({ [&pages](void* a_mem, std::size_t a_size) { pages.deallocate(a_mem, a_size); }, mem, size, 0 });
+			return std::addressof(_regions.back());
+		}
+
 		void write_5branch(std::uintptr_t a_src, std::uintptr_t a_dst, std::uint8_t a_opcode)
 		{
 #pragma pack(push, 1)
@@ -231,13 +372,18 @@ namespace F4SE
 			static_assert(sizeof(TrampolineAssembly) == 0xE);
 #pragma pack(pop)
 
+			const auto nextOp = a_src + sizeof(SrcAssembly);
 			TrampolineAssembly* mem = nullptr;
-			if (const auto it = _5branches.find(a_dst); it != _5branches.end()) {
+			std::size_t used = 0;
+			if (const auto it = _5branches.find(a_dst);
+				it != _5branches.end() && in_range(nextOp, it->second, sizeof(TrampolineAssembly))) {
 				mem = reinterpret_cast<TrampolineAssembly*>(it->second);
 			} else {
-				mem = allocate<TrampolineAssembly>();
-				_5branches.emplace(a_dst, reinterpret_cast<std::byte*>(mem));
+				mem = static_cast<TrampolineAssembly*>(allocate(sizeof(TrampolineAssembly), nextOp));
+				_5branches.insert_or_assign(a_dst, reinterpret_cast<std::byte*>(mem));
+				used = sizeof(TrampolineAssembly);
 			}
+			_hooks.push_back({ a_src, a_dst, used });
 
 			const auto disp =
 				reinterpret_cast<const std::byte*>(mem) -
@@ -273,13 +419,18 @@ namespace F4SE
 			static_assert(sizeof(Assembly) == 0x6);
 #pragma pack(pop)
 
+			const auto nextOp = a_src + sizeof(Assembly);
 			std::uintptr_t* mem = nullptr;
-			if (const auto it = _6branches.find(a_dst); it != _6branches.end()) {
+			std::size_t used = 0;
+			if (const auto it = _6branches.find(a_dst);
+				it != _6branches.end() && in_range(nextOp, it->second, sizeof(std::uintptr_t))) {
 				mem = reinterpret_cast<std::uintptr_t*>(it->second);
 			} else {
-				mem = allocate<std::uintptr_t>();
-				_6branches.emplace(a_dst, reinterpret_cast<std::byte*>(mem));
+				mem = static_cast<std::uintptr_t*>(allocate(sizeof(std::uintptr_t), nextOp));
+				_6branches.insert_or_assign(a_dst, reinterpret_cast<std::byte*>(mem));
+				used = sizeof(std::uintptr_t);
 			}
+			_hooks.push_back({ a_src, a_dst, used });
 
 			const auto disp =
 				reinterpret_cast<const std::byte*>(mem) -
@@ -317,43 +468,45 @@ namespace F4SE
 
 		void move_from(Trampoline&& a_rhs)
 		{
+			release();
+
 			_5branches = std::move(a_rhs._5branches);
 			_6branches = std::move(a_rhs._6branches);
+			_hooks = std::move(a_rhs._hooks);
 			_name = std::move(a_rhs._name);
 
-			_deleter = std::move(a_rhs._deleter);
-
-			_data = a_rhs._data;
-			a_rhs._data = nullptr;
+			_regions = std::move(a_rhs._regions);
+			a_rhs._regions.clear();
 
-			_capacity = a_rhs._capacity;
-			a_rhs._capacity = 0;
+			_pages = a_rhs._pages;
 
-			_size = a_rhs._size;
-			a_rhs._size = 0;
+			_origin = a_rhs._origin;
+			a_rhs._origin = 0;
 		}
 
 		void log_stats() const;
 
 		void release()
 		{
-			if (_data && _deleter) {
-				_deleter(_data, _capacity);
+			for (auto& region : _regions) {
+				if (region.data && region.deleter) {
+					region.deleter(region.data, region.capacity);
+				}
 			}
 
 			_5branches.clear();
 			_6branches.clear();
-			_data = nullptr;
-			_capacity = 0;
-			_size = 0;
+			_hooks.clear();
+			_regions.clear();
+			_origin = 0;
 		}
 
 		std::map<std::uintptr_t, std::byte*> _5branches;
 		std::map<std::uintptr_t, std::byte*> _6branches;
+		std::vector<hook_t> _hooks;
+		std::vector<region_t> _regions;
 		std::string _name{ "Default Trampoline"sv };
-		deleter_type _deleter;
-		std::byte* _data{ nullptr };
-		std::size_t _capacity{ 0 };
-		std::size_t _size{ 0 };
+		PageAllocator* _pages{ nullptr };
+		std::uintptr_t _origin{ 0 };
 	};
 }
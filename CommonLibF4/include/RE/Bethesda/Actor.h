@@ -303,13 +303,13 @@ namespace RE
 		EquippedWeapon()
 		{
 			typedef EquippedWeapon* func_t(EquippedWeapon*);
-			REL::Relocation<func_t> func{ REL::ID(1257653) };
+			static REL::Relocation<func_t> func{ REL::ID(1257653) };
 			func(this);
 		}
 		EquippedWeapon(EquippedWeapon& a_copy)
 		{
 			typedef EquippedWeapon* func_t(EquippedWeapon*, EquippedWeapon&);
-			REL::Relocation<func_t> func{ REL::ID(1062418) };
+			static REL::Relocation<func_t> func{ REL::ID(1062418) };
 			func(this, a_copy);
 		}
 
@@ -513,112 +513,112 @@ namespace RE
 		[[nodiscard]] bool GetAnimationGraphManager(BSTSmartPointer<BSAnimationGraphManager>& a_animGraphMgr) const
 		{
 			using func_t = decltype(&AIProcess::GetAnimationGraphManager);
-			REL::Relocation<func_t> func{ REL::ID(751660) };
+			static REL::Relocation<func_t> func{ REL::ID(751660) };
 			return func(this, a_animGraphMgr);
 		}
 
 		[[nodiscard]] bool GetCurrentActionComplete() const
 		{
 			using func_t = decltype(&AIProcess::GetCurrentActionComplete);
-			REL::Relocation<func_t> func{ REL::ID(1174072) };
+			static REL::Relocation<func_t> func{ REL::ID(1174072) };
 			return func(this);
 		}
 
 		[[nodiscard]] TESAmmo* GetCurrentAmmo(BGSEquipIndex a_equipIndex) const
 		{
 			using func_t = decltype(&AIProcess::GetCurrentAmmo);
-			REL::Relocation<func_t> func{ REL::ID(1154936) };
+			static REL::Relocation<func_t> func{ REL::ID(1154936) };
 			return func(this, a_equipIndex);
 		}
 
 		[[nodiscard]] std::uint32_t GetCurrentAmmoCount(BGSEquipIndex a_equipIndex) const
 		{
 			using func_t = decltype(&AIProcess::GetCurrentAmmoCount);
-			REL::Relocation<func_t> func{ REL::ID(184463) };
+			static REL::Relocation<func_t> func{ REL::ID(184463) };
 			return func(this, a_equipIndex);
 		}
 
 		[[nodiscard]] void GetCurrentEquipmentArray(Actor* a_actor, BSScrapArray<IKeywordFormBase*>& a_array) const
 		{
 			using func_t = decltype(&AIProcess::GetCurrentEquipmentArray);
-			REL::Relocation<func_t> func{ REL::ID(184463) };
+			static REL::Relocation<func_t> func{ REL::ID(184463) };
 			return func(this, a_actor, a_array);
 		}
 
 		[[nodiscard]] bool GetEquippedItemByIndex(BGSEquipIndex a_equipIndex, EquippedItem& a_item) const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedItemByIndex);
-			REL::Relocation<func_t> func{ REL::ID(4042) };
+			static REL::Relocation<func_t> func{ REL::ID(4042) };
 			return func(this, a_equipIndex, a_item);
 		}
 
 		[[nodiscard]] BGSObjectInstance GetEquippedItemBySlot(const BGSEquipSlot* a_slot) const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedItemBySlot);
-			REL::Relocation<func_t> func{ REL::ID(111648) };
+			static REL::Relocation<func_t> func{ REL::ID(111648) };
 			return func(this, a_slot);
 		}
 
 		[[nodiscard]] BSSpinLock* GetEquippedItemArrayLock() const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedItemArrayLock);
-			REL::Relocation<func_t> func{ REL::ID(1126369) };
+			static REL::Relocation<func_t> func{ REL::ID(1126369) };
 			return func(this);
 		}
 
 		[[nodiscard]] BSTArray<EquippedItem>* GetEquippedItemArray() const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedItemArray);
-			REL::Relocation<func_t> func{ REL::ID(421579) };
+			static REL::Relocation<func_t> func{ REL::ID(421579) };
 			return func(this);
 		}
 
 		bool GetEquippedWeaponByIndex(BGSEquipIndex a_equipIndex, EquippedWeapon& a_weapon) const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedWeaponByIndex);
-			REL::Relocation<func_t> func{ REL::ID(456256) };
+			static REL::Relocation<func_t> func{ REL::ID(456256) };
 			return func(this, a_equipIndex, a_weapon);
 		}
 
 		bool GetEquippedWeaponData(BGSEquipIndex a_equipIndex, NiPointer<EquippedWeaponData>& a_data) const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedWeaponData);
-			REL::Relocation<func_t> func{ REL::ID(1416254) };
+			static REL::Relocation<func_t> func{ REL::ID(1416254) };
 			return func(this, a_equipIndex, a_data);
 		}
 
 		std::uint32_t GetEquippedWeapons(BSTArray<EquippedWeapon>& a_weapons) const
 		{
 			using func_t = decltype(&AIProcess::GetEquippedWeapons);
-			REL::Relocation<func_t> func{ REL::ID(947344) };
+			static REL::Relocation<func_t> func{ REL::ID(947344) };
 			return func(this, a_weapons);
 		}
 
 		void GetItemsInSlot(BGSEquipSlot* a_slot, BSTArray<EquippedItem>& a_items) const
 		{
 			using func_t = decltype(&AIProcess::GetItemsInSlot);
-			REL::Relocation<func_t> func{ REL::ID(1573363) };
+			static REL::Relocation<func_t> func{ REL::ID(1573363) };
 			return func(this, a_slot, a_items);
 		}
 
 		void KnockExplosion(Actor* a_actor, const NiPoint3& a_location, float a_magnitude)
 		{
 			using func_t = decltype(&AIProcess::KnockExplosion);
-			REL::Relocation<func_t> func{ REL::ID(533106) };
+			static REL::Relocation<func_t> func{ REL::ID(533106) };
 			return func(this, a_actor, a_location, a_magnitude);
 		}
 
 		void SetActorsDetectionEvent(Actor* a_actor, const NiPoint3& a_location, std::int32_t a_soundLevel, TESObjectREFR* a_refr)
 		{
 			using func_t = decltype(&AIProcess::SetActorsDetectionEvent);
-			REL::Relocation<func_t> func{ REL::ID(1376336) };
+			static REL::Relocation<func_t> func{ REL::ID(1376336) };
 			return func(this, a_actor, a_location, a_soundLevel, a_refr);
 		}
 
 		void SetCurrentAmmo(BGSEquipIndex a_equipIndex, TESAmmo* a_ammo)
 		{
 			using func_t = decltype(&AIProcess::SetCurrentAmmo);
-			REL::Relocation<func_t> func{ REL::ID(795983) };
+			static REL::Relocation<func_t> func{ REL::ID(795983) };
 			return func(this, a_equipIndex, a_ammo);
 		}
 
@@ -691,14 +691,14 @@ namespace RE
 		[[nodiscard]] bool IsTakingHealthDamageFromActiveEffect()
 		{
 			using func_t = decltype(&MagicTarget::IsTakingHealthDamageFromActiveEffect);
-			REL::Relocation<func_t> func{ REL::ID(999442) };
+			static REL::Relocation<func_t> func{ REL::ID(999442) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool IsTakingRadDamageFromActiveEffect()
 		{
 			using func_t = decltype(&MagicTarget::IsTakingRadDamageFromActiveEffect);
-			REL::Relocation<func_t> func{ REL::ID(1079111) };
+			static REL::Relocation<func_t> func{ REL::ID(1079111) };
 			return func(this);
 		}
 
@@ -976,7 +976,7 @@ namespace RE
 		void AddPerk(BGSPerk* a_perk, std::uint8_t a_rank = 0)
 		{
 			using func_t = decltype(&Actor::AddPerk);
-			REL::Relocation<func_t> func{ REL::ID(187096) };
+			static REL::Relocation<func_t> func{ REL::ID(187096) };
 			return func(this, a_perk, a_rank);
 		}
 
@@ -988,14 +988,14 @@ namespace RE
 		[[nodiscard]] bool GetHostileToActor(Actor* a_actor)
 		{
 			using func_t = decltype(&Actor::GetHostileToActor);
-			REL::Relocation<func_t> func{ REL::ID(1148686) };
+			static REL::Relocation<func_t> func{ REL::ID(1148686) };
 			return func(this, a_actor);
 		}
 
 		[[nodiscard]] std::int16_t GetLevel()
 		{
 			using func_t = decltype(&Actor::GetLevel);
-			REL::Relocation<func_t> func{ REL::ID(661617) };
+			static REL::Relocation<func_t> func{ REL::ID(661617) };
 			return func(this);
 		}
 
@@ -1004,35 +1004,35 @@ namespace RE
 		[[nodiscard]] std::uint8_t GetPerkRank(BGSPerk* a_perk)
 		{
 			using func_t = decltype(&Actor::GetPerkRank);
-			REL::Relocation<func_t> func{ REL::ID(1368313) };
+			static REL::Relocation<func_t> func{ REL::ID(1368313) };
 			return func(this, a_perk);
 		}
 
 		[[nodiscard]] bool IsJumping()
 		{
 			using func_t = decltype(&Actor::IsJumping);
-			REL::Relocation<func_t> func{ REL::ID(1041558) };
+			static REL::Relocation<func_t> func{ REL::ID(1041558) };
 			return func(this);
 		}
 
 		void RemovePerk(BGSPerk* a_perk)
 		{
 			using func_t = decltype(&Actor::RemovePerk);
-			REL::Relocation<func_t> func{ REL::ID(1316475) };
+			static REL::Relocation<func_t> func{ REL::ID(1316475) };
 			return func(this, a_perk);
 		}
 
 		void Reset3D(bool a_reloadAll, std::uint32_t a_additionalFlags, bool a_queueReset, std::uint32_t a_excludeFlags)
 		{
 			using func_t = decltype(&Actor::Reset3D);
-			REL::Relocation<func_t> func{ REL::ID(302888) };
+			static REL::Relocation<func_t> func{ REL::ID(302888) };
 			return func(this, a_reloadAll, a_additionalFlags, a_queueReset, a_excludeFlags);
 		}
 
 		void RewardExperience(float a_amount, bool a_direct, TESObjectREFR* a_actionTarget, TESObjectREFR* a_killWeapon)
 		{
 			using func_t = decltype(&Actor::RewardExperience);
-			REL::Relocation<func_t> func{ REL::ID(262786) };
+			static REL::Relocation<func_t> func{ REL::ID(262786) };
 			return func(this, a_amount, a_direct, a_actionTarget, a_killWeapon);
 		}
 
@@ -1046,140 +1046,140 @@ namespace RE
 		void TrespassAlarm(TESObjectREFR* a_refr, TESForm* a_owner, std::int32_t a_crime)
 		{
 			using func_t = decltype(&Actor::TrespassAlarm);
-			REL::Relocation<func_t> func{ REL::ID(1109888) };
+			static REL::Relocation<func_t> func{ REL::ID(1109888) };
 			return func(this, a_refr, a_owner, a_crime);
 		}
 
 		void HandleDefaultAnimationSwitch()
 		{
 			using func_t = decltype(&Actor::HandleDefaultAnimationSwitch);
-			REL::Relocation<func_t> func{ REL::ID(1163130) };
+			static REL::Relocation<func_t> func{ REL::ID(1163130) };
 			return func(this);
 		}
 
 		void HandleItemEquip(bool bCullBone)
 		{
 			using func_t = decltype(&Actor::HandleItemEquip);
-			REL::Relocation<func_t> func{ REL::ID(164912) };
+			static REL::Relocation<func_t> func{ REL::ID(164912) };
 			return func(this, bCullBone);
 		}
 
 		bool PerformAction(BGSAction* a_action, TESObjectREFR* a_target)
 		{
 			using func_t = decltype(&Actor::PerformAction);
-			REL::Relocation<func_t> func{ REL::ID(1057231) };
+			static REL::Relocation<func_t> func{ REL::ID(1057231) };
 			return func(this, a_action, a_target);
 		}
 
 		void SetGunState(GUN_STATE gun_state, bool unk = true)
 		{
 			using func_t = decltype(&Actor::SetGunState);
-			REL::Relocation<func_t> func{ REL::ID(977675) };
+			static REL::Relocation<func_t> func{ REL::ID(977675) };
 			return func(this, gun_state, unk);
 		}
 
 		void GetAimVector(NiPoint3& out)
 		{
 			using func_t = decltype(&Actor::GetAimVector);
-			REL::Relocation<func_t> func{ REL::ID(554863) };
+			static REL::Relocation<func_t> func{ REL::ID(554863) };
 			return func(this, out);
 		}
 
 		uint32_t GetCurrentCollisionGroup()
 		{
 			using func_t = decltype(&Actor::GetCurrentCollisionGroup);
-			REL::Relocation<func_t> func{ REL::ID(410500) };
+			static REL::Relocation<func_t> func{ REL::ID(410500) };
 			return func(this);
 		}
 
 		CFilter GetCollisionFilter()
 		{
 			using func_t = decltype(&Actor::GetCollisionFilter);
-			REL::Relocation<func_t> func{ REL::ID(1474995) };
+			static REL::Relocation<func_t> func{ REL::ID(1474995) };
 			return func(this);
 		}
 
 		bool GetCurrentFireLocation(BGSEquipIndex index, NiPoint3& out)
 		{
 			using func_t = decltype(&Actor::GetCurrentFireLocation);
-			REL::Relocation<func_t> func{ REL::ID(663107) };
+			static REL::Relocation<func_t> func{ REL::ID(663107) };
 			return func(this, index, out);
 		}
 
 		float GetDesiredSpeed()
 		{
 			using func_t = decltype(&Actor::GetDesiredSpeed);
-			REL::Relocation<func_t> func{ REL::ID(106892) };
+			static REL::Relocation<func_t> func{ REL::ID(106892) };
 			return func(this);
 		}
 
 		NiAVObject* GetClosestBone(NiPoint3 pos, NiPoint3 dir)
 		{
 			using func_t = decltype(&Actor::GetClosestBone);
-			REL::Relocation<func_t> func{ REL::ID(1180004) };
+			static REL::Relocation<func_t> func{ REL::ID(1180004) };
 			return func(this, pos, dir);
 		}
 
 		bhkCharacterController* Move(float deltaTime, NiPoint3 deltaPos, bool unk)
 		{
 			using func_t = decltype(&Actor::Move);
-			REL::Relocation<func_t> func{ REL::ID(737625) };
+			static REL::Relocation<func_t> func{ REL::ID(737625) };
 			return func(this, deltaTime, deltaPos, unk);
 		}
 
 		void ExitCover()
 		{
 			using func_t = decltype(&Actor::ExitCover);
-			REL::Relocation<func_t> func{ REL::ID(770035) };
+			static REL::Relocation<func_t> func{ REL::ID(770035) };
 			return func(this);
 		}
 
 		TESCombatStyle* GetCombatStyle()
 		{
 			using func_t = decltype(&Actor::GetCombatStyle);
-			REL::Relocation<func_t> func{ REL::ID(1270929) };
+			static REL::Relocation<func_t> func{ REL::ID(1270929) };
 			return func(this);
 		}
 
 		bool IsCrippled()
 		{
 			using func_t = decltype(&Actor::IsCrippled);
-			REL::Relocation<func_t> func{ REL::ID(1238666) };
+			static REL::Relocation<func_t> func{ REL::ID(1238666) };
 			return func(this);
 		}
 
 		bool IsFollowing()
 		{
 			using func_t = decltype(&Actor::IsFollowing);
-			REL::Relocation<func_t> func{ REL::ID(629579) };
+			static REL::Relocation<func_t> func{ REL::ID(629579) };
 			return func(this);
 		}
 
 		bool IsPathValid()
 		{
 			using func_t = decltype(&Actor::IsPathValid);
-			REL::Relocation<func_t> func{ REL::ID(1522194) };
+			static REL::Relocation<func_t> func{ REL::ID(1522194) };
 			return func(this);
 		}
 
 		bool IsPathing()
 		{
 			using func_t = decltype(&Actor::IsPathing);
-			REL::Relocation<func_t> func{ REL::ID(989661) };
+			static REL::Relocation<func_t> func{ REL::ID(989661) };
 			return func(this);
 		}
 
 		bool IsPathingComplete()
 		{
 			using func_t = decltype(&Actor::IsPathingComplete);
-			REL::Relocation<func_t> func{ REL::ID(817283) };
+			static REL::Relocation<func_t> func{ REL::ID(817283) };
 			return func(this);
 		}
 
 		bool IsQuadruped()
 		{
 			using func_t = decltype(&Actor::IsQuadruped);
-			REL::Relocation<func_t> func{ REL::ID(1552322) };
+			static REL::Relocation<func_t> func{ REL::ID(1552322) };
 			return func(this);
 		}
 
@@ -1247,7 +1247,7 @@ namespace RE
 	public:
 		[[nodiscard]] static ActorEquipManager* GetSingleton()
 		{
-			REL::Relocation<ActorEquipManager**> singleton{ REL::ID(1174340) };
+			static REL::Relocation<ActorEquipManager**> singleton{ REL::ID(1174340) };
 			return *singleton;
 		}
 
@@ -1264,7 +1264,7 @@ namespace RE
 			bool a_locked)
 		{
 			using func_t = decltype(&ActorEquipManager::EquipObject);
-			REL::Relocation<func_t> func{ REL::ID(988029) };
+			static REL::Relocation<func_t> func{ REL::ID(988029) };
 			return func(this, a_actor, a_object, a_stackID, a_number, a_slot, a_queueEquip, a_forceEquip, a_playSounds, a_applyNow, a_locked);
 		}
 
@@ -1281,7 +1281,7 @@ namespace RE
 			const BGSEquipSlot* a_slotBeingReplaced)
 		{
 			using func_t = decltype(&ActorEquipManager::UnequipObject);
-			REL::Relocation<func_t> func{ REL::ID(1292493) };
+			static REL::Relocation<func_t> func{ REL::ID(1292493) };
 			return func(this, a_actor, a_object, a_number, a_slot, a_stackID, a_queueEquip, a_forceEquip, a_playSounds, a_applyNow, a_slotBeingReplaced);
 		}
 	};
@@ -58,7 +58,7 @@ namespace RE
 		[[nodiscard]] static ActorValue* GetSingleton()
 		{
 			using func_t = decltype(&ActorValue::GetSingleton);
-			REL::Relocation<func_t> func{ REL::ID(405390) };
+			static REL::Relocation<func_t> func{ REL::ID(405390) };
 			return func();
 		}
 
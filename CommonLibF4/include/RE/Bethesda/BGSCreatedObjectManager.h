@@ -53,21 +53,21 @@ namespace RE
 
 		[[nodiscard]] static BGSCreatedObjectManager* GetSingleton()
 		{
-			REL::Relocation<BGSCreatedObjectManager**> singleton{ REL::ID(1000678) };
+			static REL::Relocation<BGSCreatedObjectManager**> singleton{ REL::ID(1000678) };
 			return *singleton;
 		}
 
 		void DecrementRef(AlchemyItem* a_alchItem)
 		{
 			using func_t = decltype(&BGSCreatedObjectManager::DecrementRef);
-			REL::Relocation<func_t> func{ REL::ID(230928) };
+			static REL::Relocation<func_t> func{ REL::ID(230928) };
 			return func(this, a_alchItem);
 		}
 
 		void IncrementRef(AlchemyItem* a_alchItem)
 		{
 			using func_t = decltype(&BGSCreatedObjectManager::IncrementRef);
-			REL::Relocation<func_t> func{ REL::ID(1042515) };
+			static REL::Relocation<func_t> func{ REL::ID(1042515) };
 			return func(this, a_alchItem);
 		}
 
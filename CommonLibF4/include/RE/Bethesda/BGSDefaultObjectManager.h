@@ -430,7 +430,7 @@ namespace RE
 
 	[[nodiscard]] inline std::span<DEFAULT_OBJECT_DATA, 394> GetDefaultObjectData()
 	{
-		REL::Relocation<DEFAULT_OBJECT_DATA(*)[394]> data{ REL::ID(838886) };
+		static REL::Relocation<DEFAULT_OBJECT_DATA(*)[394]> data{ REL::ID(838886) };
 		return { *data };
 	}
 
@@ -446,7 +446,7 @@ namespace RE
 		[[nodiscard]] static BGSDefaultObjectManager* GetSingleton()
 		{
 			using func_t = decltype(&BGSDefaultObjectManager::GetSingleton);
-			REL::Relocation<func_t> func{ REL::ID(484974) };
+			static REL::Relocation<func_t> func{ REL::ID(484974) };
 			return func();
 		}
 
@@ -489,7 +489,7 @@ namespace RE
 
 		[[nodiscard]] static BSTArray<BGSDefaultObject*>* GetSingleton()
 		{
-			REL::Relocation<BSTArray<BGSDefaultObject*>**> singleton{ REL::ID(561749) };
+			static REL::Relocation<BSTArray<BGSDefaultObject*>**> singleton{ REL::ID(561749) };
 			return *singleton;
 		}
 
@@ -508,7 +508,7 @@ namespace RE
 		BGSDefaultObject* ctor(const char* a_name, ENUM_FORM_ID a_formType, const char* a_description)
 		{
 			using func_t = decltype(&BGSDefaultObject::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1144014) };
+			static REL::Relocation<func_t> func{ REL::ID(1144014) };
 			return func(this, a_name, a_formType, a_description);
 		}
 	};
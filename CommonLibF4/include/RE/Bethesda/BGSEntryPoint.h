@@ -172,7 +172,7 @@ namespace RE
 		inline void HandleEntryPoint(ENTRY_POINT a_entryPoint, Actor* a_perkOwner, Args... a_args)
 		{
 			using func_t = decltype(&BGSEntryPoint::HandleEntryPoint<Args...>);
-			REL::Relocation<func_t> func{ REL::ID(714336) };
+			static REL::Relocation<func_t> func{ REL::ID(714336) };
 			return func(a_entryPoint, a_perkOwner, a_args...);
 		}
 	}
@@ -130,7 +130,7 @@ namespace RE
 		bool FindAndWriteStackData(StackDataCompareFunctor& a_compareFunc, StackDataWriteFunctor& a_writeFunc, bool a_manualMerge, ObjectRefHandle a_owner)
 		{
 			using func_t = decltype(&BGSInventoryItem::FindAndWriteStackData);
-			REL::Relocation<func_t> func{ REL::ID(770140) };
+			static REL::Relocation<func_t> func{ REL::ID(770140) };
 			return func(this, a_compareFunc, a_writeFunc, a_manualMerge, a_owner);
 		}
 
@@ -148,21 +148,21 @@ namespace RE
 		[[nodiscard]] const char* GetDisplayFullName(std::uint32_t a_stackID)
 		{
 			using func_t = decltype(&BGSInventoryItem::GetDisplayFullName);
-			REL::Relocation<func_t> func{ REL::ID(277641) };
+			static REL::Relocation<func_t> func{ REL::ID(277641) };
 			return func(this, a_stackID);
 		}
 
 		[[nodiscard]] TBO_InstanceData* GetInstanceData(std::uint32_t a_stackID)
 		{
 			using func_t = decltype(&BGSInventoryItem::GetInstanceData);
-			REL::Relocation<func_t> func{ REL::ID(491493) };
+			static REL::Relocation<func_t> func{ REL::ID(491493) };
 			return func(this, a_stackID);
 		}
 
 		[[nodiscard]] std::int32_t GetInventoryValue(std::uint32_t a_stackID, bool a_scale) const
 		{
 			using func_t = decltype(&BGSInventoryItem::GetInventoryValue);
-			REL::Relocation<func_t> func{ REL::ID(430292) };
+			static REL::Relocation<func_t> func{ REL::ID(430292) };
 			return func(this, a_stackID, a_scale);
 		}
 
@@ -183,7 +183,7 @@ namespace RE
 		virtual void WriteDataImpl(TESBoundObject& a_baseObj, BGSInventoryItem::Stack& a_stack) override  // 01
 		{
 			using func_t = decltype(&ApplyChangesFunctor::WriteDataImpl);
-			REL::Relocation<func_t> func{ REL::ID(1291190) };
+			static REL::Relocation<func_t> func{ REL::ID(1291190) };
 			return func(this, a_baseObj, a_stack);
 		}
 
@@ -135,7 +135,7 @@ namespace RE::BGSMod
 	{
 		[[nodiscard]] inline BSTHashMap<const Mod*, TESObjectMISC*>& GetAllLooseMods()
 		{
-			REL::Relocation<BSTHashMap<const Mod*, TESObjectMISC*>*> mods{ REL::ID(1108112), -0x8 };
+			static REL::Relocation<BSTHashMap<const Mod*, TESObjectMISC*>*> mods{ REL::ID(1108112), -0x8 };
 			return *mods;
 		}
 
@@ -167,14 +167,14 @@ namespace RE::BGSMod
 			static void FindModsForLooseMod(TESObjectMISC* a_looseMod, BSScrapArray<BGSMod::Attachment::Mod*>& a_result)
 			{
 				using func_t = decltype(&Mod::FindModsForLooseMod);
-				REL::Relocation<func_t> func{ REL::ID(410363) };
+				static REL::Relocation<func_t> func{ REL::ID(410363) };
 				return func(a_looseMod, a_result);
 			}
 
 			void GetData(Data& a_data) const
 			{
 				using func_t = decltype(&Mod::GetData);
-				REL::Relocation<func_t> func{ REL::ID(33658) };
+				static REL::Relocation<func_t> func{ REL::ID(33658) };
 				return func(this, a_data);
 			}
 
@@ -237,7 +237,7 @@ namespace RE::BGSMod
 			static void CreateInstanceDataForObjectAndExtra(TESBoundObject& a_object, ExtraDataList& a_extra, const INSTANCE_FILTER* a_filter, bool a_useDefault)
 			{
 				using func_t = decltype(&Items::CreateInstanceDataForObjectAndExtra);
-				REL::Relocation<func_t> func{ REL::ID(147297) };
+				static REL::Relocation<func_t> func{ REL::ID(147297) };
 				return func(a_object, a_extra, a_filter, a_useDefault);
 			}
 
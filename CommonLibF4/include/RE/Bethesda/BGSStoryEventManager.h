@@ -17,14 +17,14 @@ namespace RE
 	public:
 		[[nodiscard]] static BGSStoryEventManager* GetSingleton()
 		{
-			REL::Relocation<BGSStoryEventManager**> singleton{ REL::ID(1160067) };
+			static REL::Relocation<BGSStoryEventManager**> singleton{ REL::ID(1160067) };
 			return *singleton;
 		}
 
 		std::uint32_t AddEvent(std::uint32_t a_index, const void* a_event)
 		{
 			using func_t = std::uint32_t (BGSStoryEventManager::*)(std::uint32_t, const void*);
-			REL::Relocation<func_t> func{ REL::ID(312533) };
+			static REL::Relocation<func_t> func{ REL::ID(312533) };
 			return func(this, a_index, a_event);
 		}
 
@@ -55,7 +55,7 @@ namespace RE
 
 		[[nodiscard]] static std::uint32_t EVENT_INDEX()
 		{
-			REL::Relocation<std::uint32_t*> eventIdx{ REL::ID(1382765) };
+			static REL::Relocation<std::uint32_t*> eventIdx{ REL::ID(1382765) };
 			return *eventIdx;
 		}
 
@@ -76,7 +76,7 @@ namespace RE
 
 		[[nodiscard]] static std::uint32_t EVENT_INDEX()
 		{
-			REL::Relocation<std::uint32_t*> eventIdx{ REL::ID(701969) };
+			static REL::Relocation<std::uint32_t*> eventIdx{ REL::ID(701969) };
 			return *eventIdx;
 		}
 
@@ -89,7 +89,7 @@ namespace RE
 		BGSPickLockEvent* ctor(TESObjectREFR* a_actor, TESObjectREFR* a_lockRef, bool a_isCrime)
 		{
 			using func_t = decltype(&BGSPickLockEvent::ctor);
-			REL::Relocation<func_t> func{ REL::ID(193329) };
+			static REL::Relocation<func_t> func{ REL::ID(193329) };
 			return func(this, a_actor, a_lockRef, a_isCrime);
 		}
 	};
@@ -27,14 +27,14 @@ namespace RE
 
 		[[nodiscard]] static BGSSynchronizedAnimationManager* GetSingleton()
 		{
-			REL::Relocation<BGSSynchronizedAnimationManager**> singleton{ REL::ID(1346879) };
+			static REL::Relocation<BGSSynchronizedAnimationManager**> singleton{ REL::ID(1346879) };
 			return *singleton;
 		}
 
 		[[nodiscard]] bool IsReferenceInSynchronizedScene(ObjectRefHandle a_ref)
 		{
 			using func_t = decltype(&BGSSynchronizedAnimationManager::IsReferenceInSynchronizedScene);
-			REL::Relocation<func_t> func{ REL::ID(915329) };
+			static REL::Relocation<func_t> func{ REL::ID(915329) };
 			return func(this, a_ref);
 		}
 
@@ -8,28 +8,28 @@ namespace RE
 		void lock_read()
 		{
 			using func_t = decltype(&BSReadWriteLock::lock_read);
-			REL::Relocation<func_t> func{ REL::ID(1573164) };
+			static REL::Relocation<func_t> func{ REL::ID(1573164) };
 			return func(this);
 		}
 
 		void lock_write()
 		{
 			using func_t = decltype(&BSReadWriteLock::lock_write);
-			REL::Relocation<func_t> func{ REL::ID(336186) };
+			static REL::Relocation<func_t> func{ REL::ID(336186) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool try_lock_read()
 		{
 			using func_t = decltype(&BSReadWriteLock::try_lock_read);
-			REL::Relocation<func_t> func{ REL::ID(1372435) };
+			static REL::Relocation<func_t> func{ REL::ID(1372435) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool try_lock_write()
 		{
 			using func_t = decltype(&BSReadWriteLock::try_lock_write);
-			REL::Relocation<func_t> func{ REL::ID(1279453) };
+			static REL::Relocation<func_t> func{ REL::ID(1279453) };
 			return func(this);
 		}
 
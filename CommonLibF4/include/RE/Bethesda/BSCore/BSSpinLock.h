@@ -13,21 +13,21 @@ namespace RE
 		bool IsLockedByUs()
 		{
 			using func_t = decltype(&BSSpinLock::IsLockedByUs);
-			REL::Relocation<func_t> func{ REL::ID(1477730) };
+			static REL::Relocation<func_t> func{ REL::ID(1477730) };
 			return func(this);
 		}
 
 		void lock(const char* a_id = nullptr)
 		{
 			using func_t = decltype(&BSSpinLock::lock);
-			REL::Relocation<func_t> func{ REL::ID(1425657) };
+			static REL::Relocation<func_t> func{ REL::ID(1425657) };
 			return func(this, a_id);
 		}
 
 		[[nodiscard]] bool try_lock()
 		{
 			using func_t = decltype(&BSSpinLock::try_lock);
-			REL::Relocation<func_t> func{ REL::ID(267930) };
+			static REL::Relocation<func_t> func{ REL::ID(267930) };
 			return func(this);
 		}
 
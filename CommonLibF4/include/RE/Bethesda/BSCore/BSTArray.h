@@ -1,11 +1,50 @@
 #pragma once
 
-#include "RE/Bethesda/BSCore/MemoryManager.h"
+#ifndef F4SE_TEST_SUITE
+#	include "RE/Bethesda/BSCore/MemoryManager.h"
+#endif
 
 namespace RE
 {
 	class ScrapHeap;
 
+	// types which can be moved to a new address with a plain memcpy, leaving nothing behind to destroy.
+	// specialize this for types which own resources through a pointer that nothing else refers back to
+	template <class T>
+	struct is_trivially_relocatable :
+		std::bool_constant<std::is_trivially_copyable_v<T>>
+	{};
+
+	template <class T>
+	inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+	namespace detail
+	{
+		template <class, bool>
+		class BSFixedString;
+	}
+
+	template <class, template <class> class>
+	class BSTSmartPointer;
+
+	template <class>
+	class NiPointer;
+
+	template <class CharT, bool CS>
+	struct is_trivially_relocatable<detail::BSFixedString<CharT, CS>> :
+		std::true_type
+	{};
+
+	template <class T, template <class> class RefManager>
+	struct is_trivially_relocatable<BSTSmartPointer<T, RefManager>> :
+		std::true_type
+	{};
+
+	template <class T>
+	struct is_trivially_relocatable<NiPointer<T>> :
+		std::true_type
+	{};
+
 	class BSTArrayHeapAllocator
 	{
 	public:
@@ -35,6 +74,7 @@ namespace RE
 		}
 
 		[[nodiscard]] void* allocate(uint32_t a_bytes) { return malloc(a_bytes); }
+		[[nodiscard]] void* reallocate(void* a_ptr, uint32_t a_bytes) { return realloc(a_ptr, a_bytes); }
 		void deallocate(void* a_ptr) { free(a_ptr); }
 
 		[[nodiscard]] void* data() noexcept { return _data; }
@@ -208,17 +248,55 @@ namespace RE
 		iterator insert(const_iterator a_pos, ForwardIt a_first, ForwardIt a_last)  //
 			requires(std::derived_from<typename std::iterator_traits<ForwardIt>::iterator_category, std::forward_iterator_tag>)
 		{
-			const auto distance = static_cast<size_type>(std::distance(a_first, a_last));
-			if (distance == 0) {
-				return decay_iterator(a_pos);
-			}
+			return insert_range(a_pos, std::ranges::subrange(a_first, a_last));
+		}
 
+		// the range may not refer into this array
+		template <std::ranges::forward_range R>
+		iterator insert_range(const_iterator a_pos, R&& a_range)  //
+			requires(std::constructible_from<value_type, std::ranges::range_reference_t<R>>)
+		{
 			const auto pos = static_cast<size_type>(std::distance(cbegin(), a_pos));
-			resize(size() + distance);
-			const auto iter = begin() + pos;
-			std::move_backward(iter, iter + distance, end());
-			std::copy(a_first, a_last, iter);
-			return iter;
+			const auto count = static_cast<size_type>(std::ranges::distance(a_range));
+			if (count == 0) {
+				return begin() + pos;
+			}
+
+			reserve_auto(size() + count);
+			const auto first = data() + pos;
+			const auto last = data() + size();
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				const auto tail = static_cast<size_type>(last - first);
+				relocate(first, tail, first + count);
+				try {
+					std::ranges::uninitialized_copy(a_range, std::span{ first, count });
+				} catch (...) {
+					relocate(first + count, tail, first);  // the copies made so far are already destroyed
+					throw;
+				}
+				_size += count;
+			} else {
+				std::ranges::uninitialized_copy(a_range, std::span{ last, count });
+				_size += count;
+				std::rotate(first, last, end());
+			}
+			return begin() + pos;
+		}
+
+		template <std::ranges::input_range R>
+		void append_range(R&& a_range)  //
+			requires(std::constructible_from<value_type, std::ranges::range_reference_t<R>>)
+		{
+			if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>) {
+				const auto count = static_cast<size_type>(std::ranges::distance(a_range));
+				reserve_auto(size() + count);
+				std::ranges::uninitialized_copy(a_range, std::span{ end(), count });
+				_size += count;
+			} else {
+				for (auto&& elem : a_range) {
+					emplace_back(std::forward<decltype(elem)>(elem));
+				}
+			}
 		}
 
 		template <class... Args>
@@ -248,17 +326,33 @@ namespace RE
 			}
 
 			assert(distance <= size());
-			std::move(last, end(), first);
-			std::destroy(end() - distance, end());
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				std::destroy(first, last);
+				relocate(last, static_cast<size_type>(end() - last), first);
+			} else {
+				std::move(last, end(), first);
+				std::destroy(end() - distance, end());
+			}
 			_size -= distance;
-			return end();
+			return first;
 		}
 
 		template <class... Args>
 		reference emplace_back(Args&&... a_args)  //
 			requires(std::constructible_from<value_type, Args&&...>)
 		{
-			return *emplace(end(), std::forward<Args>(a_args)...);
+			if (size() < capacity()) {
+				const auto elem = std::construct_at(data() + _size, std::forward<Args>(a_args)...);
+				_size += 1;
+				return *elem;
+			} else {
+				// the arguments may refer into the buffer about to be freed
+				value_type value(std::forward<Args>(a_args)...);
+				reserve_auto(size() + 1);
+				const auto elem = std::construct_at(data() + _size, std::move(value));
+				_size += 1;
+				return *elem;
+			}
 		}
 
 		void pop_back() { erase(std::prev(end())); }
@@ -279,11 +373,13 @@ namespace RE
 			return const_cast<pointer>(std::addressof(*a_iter));
 		}
 
+		// grows by half again, like msvc's vector, which leaves room for the freed blocks to be reused
 		void reserve_auto(size_type a_capacity)
 		{
 			if (a_capacity > capacity()) {
-				const auto grow = (std::max)(a_capacity, capacity() * 2);
-				reserve_exact(grow);
+				const auto max = static_cast<size_type>(max_size() / sizeof(value_type));
+				const auto grow = capacity() < max - capacity() / 2 ? capacity() + capacity() / 2 : max;
+				reserve_exact((std::max)(a_capacity, grow));
 			}
 		}
 
@@ -294,16 +390,52 @@ namespace RE
 				return;
 			}
 
-			const auto ndata =
-				static_cast<pointer>(
-					_allocator.allocate(a_capacity * sizeof(value_type)));
+			const auto bytes = a_capacity * static_cast<size_type>(sizeof(value_type));
+			if constexpr (is_trivially_relocatable_v<value_type> &&
+						  requires { _allocator.reallocate(nullptr, bytes); }) {
+				if (data() && a_capacity > 0) {
+					const auto ndata = _allocator.reallocate(data(), bytes);
+					if (!ndata) {
+						stl::report_and_fail("out of memory"sv);
+					}
+					_allocator.set_data(ndata);
+					_allocator.set_capacity(a_capacity, bytes);
+					return;
+				}
+			}
+
+			const auto ndata = static_cast<pointer>(_allocator.allocate(bytes));
+			if (!ndata && bytes > 0) {
+				stl::report_and_fail("out of memory"sv);
+			}
+
 			const auto odata = data();
-			if (ndata != odata) {
-				std::uninitialized_move_n(odata, size(), ndata);
-				std::destroy_n(odata, size());
+			if (ndata == odata) {
+				return;
+			}
+
+			// small arrays keep their heap pointer over the local buffer, so the elements move out first
+			if (odata) {
+				relocate(odata, size(), ndata);
 				_allocator.deallocate(odata);
-				_allocator.set_data(ndata);
-				_allocator.set_capacity(a_capacity, a_capacity * sizeof(value_type));
+			}
+			_allocator.set_data(ndata);
+			_allocator.set_capacity(a_capacity, bytes);
+		}
+
+		// moves a_count live elements to uninitialized storage, which may overlap them
+		static void relocate(pointer a_from, size_type a_count, pointer a_to)
+		{
+			if (a_count == 0 || a_from == a_to) {
+				return;
+			}
+
+			if constexpr (is_trivially_relocatable_v<value_type>) {
+				std::memmove(static_cast<void*>(a_to), static_cast<const void*>(a_from), a_count * sizeof(value_type));
+			} else {
+				assert(a_to + a_count <= a_from || a_from + a_count <= a_to);
+				std::uninitialized_move_n(a_from, a_count, a_to);
+				std::destroy_n(a_from, a_count);
 			}
 		}
 
@@ -334,6 +466,13 @@ namespace RE
 		allocator_type _allocator;  // 00
 		size_type _size{ 0 };       // ??
 	};
+	static_assert(sizeof(BSTArray<void*>) == 0x18);
+
+	// the heap allocator holds nothing but the pointer to its block
+	template <class T>
+	struct is_trivially_relocatable<BSTArray<T, BSTArrayHeapAllocator>> :
+		std::true_type
+	{};
 
 	namespace BSScript
 	{
@@ -39,6 +39,7 @@ namespace RE
 			}
 
 			[[nodiscard]] void* allocate(uint32_t a_bytes) { return aligned_alloc(N, a_bytes); }
+			[[nodiscard]] void* reallocate(void* a_ptr, uint32_t a_bytes) { return aligned_realloc(a_ptr, N, a_bytes); }
 			void deallocate(void* a_ptr) { aligned_free(a_ptr); }
 
 			[[nodiscard]] void* data() noexcept { return _data; }
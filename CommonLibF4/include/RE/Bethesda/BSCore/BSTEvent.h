@@ -231,7 +231,7 @@ namespace RE
 
 		[[nodiscard]] static BSTGlobalEvent* GetSingleton()
 		{
-			REL::Relocation<BSTGlobalEvent**> singleton{ REL::ID(1424022) };
+			static REL::Relocation<BSTGlobalEvent**> singleton{ REL::ID(1424022) };
 			return *singleton;
 		}
 
@@ -247,7 +247,7 @@ namespace RE
 
 		[[nodiscard]] static BSTGlobalEvent_OLD* GetSingleton()
 		{
-			REL::Relocation<BSTGlobalEvent_OLD**> singleton{ REL::ID(1424022) };
+			static REL::Relocation<BSTGlobalEvent_OLD**> singleton{ REL::ID(1424022) };
 			return *singleton;
 		}
 
@@ -6,6 +6,15 @@
 #	include "RE/Bethesda/CRC.h"
 #endif
 
+#if defined(_M_X64) || defined(__x86_64__)
+#	include <xmmintrin.h>
+#	define RE_SCATTER_TABLE_PREFETCH(a_address) _mm_prefetch(reinterpret_cast<const char*>(a_address), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+#	define RE_SCATTER_TABLE_PREFETCH(a_address) __builtin_prefetch(a_address)
+#else
+#	define RE_SCATTER_TABLE_PREFETCH(a_address) static_cast<void>(a_address)
+#endif
+
 namespace RE
 {
 	namespace detail
@@ -321,6 +330,26 @@ namespace RE
 
 		[[nodiscard]] bool contains(const key_type& a_key) const { return find(a_key) != end(); }
 
+		// a_results[i] receives find(a_keys[i]), but the buckets for a batch of keys are all hashed and
+		// prefetched before any chain is walked, so their cache misses overlap
+		void find_many(std::span<const key_type> a_keys, std::span<iterator> a_results) { do_find_many(a_keys, a_results); }
+		void find_many(std::span<const key_type> a_keys, std::span<const_iterator> a_results) const { do_find_many(a_keys, a_results); }
+
+		// sets bit i of a_results (and clears it otherwise) if a_keys[i] is in the table, and returns how many were
+		size_type contains_many(std::span<const key_type> a_keys, std::span<std::uint64_t> a_results) const
+		{
+			assert(a_results.size() * 64 >= a_keys.size());
+			std::fill_n(a_results.begin(), (a_keys.size() + 63) / 64, 0);
+			size_type found = 0;
+			for_each_batched(a_keys, [&](std::size_t a_idx, const entry_type* a_entry) {
+				if (a_entry) {
+					a_results[a_idx / 64] |= static_cast<std::uint64_t>(1) << (a_idx % 64);
+					++found;
+				}
+			});
+			return found;
+		}
+
 		void reserve(size_type a_count)
 		{
 			if (a_count <= _capacity) {
@@ -431,18 +460,59 @@ namespace RE
 				return make_iterator<Iter>();
 			}
 
-			auto entry = &get_entry_for(a_key);
-			if (entry->has_value()) {
+			const auto entry = find_in_chain(&get_entry_for(a_key), a_key);
+			return entry ? make_iterator<Iter>(entry) : make_iterator<Iter>();
+		}
+
+		template <class Iter>
+		void do_find_many(std::span<const key_type> a_keys, std::span<Iter> a_results) const
+		{
+			assert(a_results.size() >= a_keys.size());
+			for_each_batched(a_keys, [&](std::size_t a_idx, entry_type* a_entry) {
+				a_results[a_idx] = a_entry ? make_iterator<Iter>(a_entry) : make_iterator<Iter>();
+			});
+		}
+
+		// calls a_func(i, entry) for each key, where entry is nullptr if the key is missing
+		template <class F>
+		void for_each_batched(std::span<const key_type> a_keys, F a_func) const
+		{
+			// enough loads in flight to cover a miss, without evicting the first bucket before it is walked
+			constexpr std::size_t BATCH = 16;
+
+			if (empty()) {
+				for (std::size_t i = 0; i < a_keys.size(); ++i) {
+					a_func(i, nullptr);
+				}
+				return;
+			}
+
+			std::array<entry_type*, BATCH> buckets;
+			for (std::size_t first = 0; first < a_keys.size(); first += BATCH) {
+				const auto count = (std::min)(BATCH, a_keys.size() - first);
+				for (std::size_t i = 0; i < count; ++i) {
+					buckets[i] = &get_entry_for(a_keys[first + i]);
+					RE_SCATTER_TABLE_PREFETCH(buckets[i]);
+				}
+				for (std::size_t i = 0; i < count; ++i) {
+					a_func(first + i, find_in_chain(buckets[i], a_keys[first + i]));
+				}
+			}
+		}
+
+		[[nodiscard]] entry_type* find_in_chain(entry_type* a_entry, const key_type& a_key) const noexcept(noexcept(key_eq(a_key, a_key)))
+		{
+			if (a_entry->has_value()) {
 				do {  // follow chain
-					if (key_eq(unwrap_key(entry->value), a_key)) {
-						return make_iterator<Iter>(entry);
+					if (key_eq(unwrap_key(a_entry->value), a_key)) {
+						return a_entry;
 					} else {
-						entry = entry->next;
+						a_entry = a_entry->next;
 					}
-				} while (entry != _sentinel);
+				} while (a_entry != _sentinel);
 			}
 
-			return make_iterator<Iter>();
+			return nullptr;
 		}
 
 		template <class P>
@@ -670,3 +740,5 @@ namespace RE
 		std::byte* _entries{ nullptr };                                               // 08 (28)
 	};
 }
+
+#undef RE_SCATTER_TABLE_PREFETCH
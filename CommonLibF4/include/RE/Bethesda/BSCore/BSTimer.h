@@ -7,7 +7,7 @@ namespace RE
 	public:
 		static BSTimer& GetTimer()
 		{
-			REL::Relocation<BSTimer*> timer{ REL::ID(1256126) };
+			static REL::Relocation<BSTimer*> timer{ REL::ID(1256126) };
 			return *timer;
 		}
 
@@ -31,14 +31,14 @@ namespace RE
 			AutoScrapBuffer* Ctor()
 			{
 				using func_t = decltype(&AutoScrapBuffer::Ctor);
-				REL::Relocation<func_t> func{ REL::ID(1571567) };
+				static REL::Relocation<func_t> func{ REL::ID(1571567) };
 				return func(this);
 			}
 
 			void Dtor()
 			{
 				using func_t = decltype(&AutoScrapBuffer::Dtor);
-				REL::Relocation<func_t> func{ REL::ID(68625) };
+				static REL::Relocation<func_t> func{ REL::ID(68625) };
 				return func(this);
 			}
 		};
@@ -57,42 +57,42 @@ namespace RE
 		[[nodiscard]] static MemoryManager& GetSingleton()
 		{
 			using func_t = decltype(&MemoryManager::GetSingleton);
-			const REL::Relocation<func_t> func{ REL::ID(343176) };
+			static REL::Relocation<func_t> func{ REL::ID(343176) };
 			return func();
 		}
 
 		[[nodiscard]] void* Allocate(std::size_t a_size, std::uint32_t a_alignment, bool a_alignmentRequired)
 		{
 			using func_t = decltype(&MemoryManager::Allocate);
-			const REL::Relocation<func_t> func{ REL::ID(652767) };
+			static REL::Relocation<func_t> func{ REL::ID(652767) };
 			return func(this, a_size, a_alignment, a_alignmentRequired);
 		}
 
 		void Deallocate(void* a_mem, bool a_alignmentRequired)
 		{
 			using func_t = decltype(&MemoryManager::Deallocate);
-			const REL::Relocation<func_t> func{ REL::ID(1582181) };
+			static REL::Relocation<func_t> func{ REL::ID(1582181) };
 			return func(this, a_mem, a_alignmentRequired);
 		}
 
 		[[nodiscard]] ScrapHeap* GetThreadScrapHeap()
 		{
 			using func_t = decltype(&MemoryManager::GetThreadScrapHeap);
-			const REL::Relocation<func_t> func{ REL::ID(1495205) };
+			static REL::Relocation<func_t> func{ REL::ID(1495205) };
 			return func(this);
 		}
 
 		[[nodiscard]] void* Reallocate(void* a_oldMem, std::size_t a_newSize, std::uint32_t a_alignment, bool a_alignmentRequired)
 		{
 			using func_t = decltype(&MemoryManager::Reallocate);
-			const REL::Relocation<func_t> func{ REL::ID(1502917) };
+			static REL::Relocation<func_t> func{ REL::ID(1502917) };
 			return func(this, a_oldMem, a_newSize, a_alignment, a_alignmentRequired);
 		}
 
 		void RegisterMemoryManager()
 		{
 			using func_t = decltype(&MemoryManager::RegisterMemoryManager);
-			const REL::Relocation<func_t> func{ REL::ID(453212) };
+			static REL::Relocation<func_t> func{ REL::ID(453212) };
 			return func(this);
 		}
 
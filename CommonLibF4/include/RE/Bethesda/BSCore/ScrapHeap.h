@@ -56,14 +56,14 @@ namespace RE
 		void* Allocate(std::size_t a_size, std::size_t a_alignment)
 		{
 			using func_t = decltype(&ScrapHeap::Allocate);
-			REL::Relocation<func_t> func{ REL::ID(1085394) };
+			static REL::Relocation<func_t> func{ REL::ID(1085394) };
 			return func(this, a_size, a_alignment);
 		}
 
 		void Deallocate(void* a_mem)
 		{
 			using func_t = decltype(&ScrapHeap::Deallocate);
-			REL::Relocation<func_t> func{ REL::ID(923307) };
+			static REL::Relocation<func_t> func{ REL::ID(923307) };
 			return func(this, a_mem);
 		}
 
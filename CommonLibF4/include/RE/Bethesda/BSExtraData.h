@@ -1,6 +1,7 @@
 #pragma once
 
 #include "RE/Bethesda/BSSystem/BSFixedString.h"
+#include "RE/Bethesda/BSExtraDataAlg.h"
 #include "RE/Bethesda/BSLock.h"
 #include "RE/Bethesda/BSMain/BSPointerHandle.h"
 #include "RE/Bethesda/BSCore/BSTArray.h"
@@ -432,7 +433,7 @@ namespace RE
 		void AddMod(const BGSMod::Attachment::Mod& a_newMod, std::uint8_t a_attachIndex, std::uint8_t a_rank, bool a_removeInvalidMods)
 		{
 			using func_t = decltype(&BGSObjectInstanceExtra::AddMod);
-			REL::Relocation<func_t> func{ REL::ID(1191757) };
+			static REL::Relocation<func_t> func{ REL::ID(1191757) };
 			return func(this, a_newMod, a_attachIndex, a_rank, a_removeInvalidMods);
 		}
 
@@ -443,14 +444,14 @@ namespace RE
 		std::uint32_t RemoveInvalidMods(const BGSAttachParentArray* a_baseObjectParents)
 		{
 			using func_t = decltype(&BGSObjectInstanceExtra::RemoveInvalidMods);
-			REL::Relocation<func_t> func{ REL::ID(1548060) };
+			static REL::Relocation<func_t> func{ REL::ID(1548060) };
 			return func(this, a_baseObjectParents);
 		}
 
 		std::uint32_t RemoveMod(const BGSMod::Attachment::Mod* a_mod, std::uint8_t a_attachIndex)
 		{
 			using func_t = decltype(&BGSObjectInstanceExtra::RemoveMod);
-			REL::Relocation<func_t> func{ REL::ID(1136607) };
+			static REL::Relocation<func_t> func{ REL::ID(1136607) };
 			return func(this, a_mod, a_attachIndex);
 		}
 
@@ -462,7 +463,7 @@ namespace RE
 		BGSObjectInstanceExtra* ctor(const BGSMod::Template::Item* a_item, TESForm* a_parentForm, const INSTANCE_FILTER* a_filter)
 		{
 			using func_t = decltype(&BGSObjectInstanceExtra::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1222521) };
+			static REL::Relocation<func_t> func{ REL::ID(1222521) };
 			return func(this, a_item, a_parentForm, a_filter);
 		}
 	};
@@ -578,7 +579,7 @@ namespace RE
 		[[nodiscard]] const BSFixedStringCS& GetDisplayName(TESBoundObject* a_baseObject)
 		{
 			using func_t = decltype(&ExtraTextDisplayData::GetDisplayName);
-			REL::Relocation<func_t> func{ REL::ID(1523343) };
+			static REL::Relocation<func_t> func{ REL::ID(1523343) };
 			return func(this, a_baseObject);
 		}
 
@@ -664,6 +665,24 @@ namespace RE
 			return nullptr;
 		}
 
+		// fills a_result with the extra for each of a_types, or nullptr, in one walk of the list
+		void GetByTypes(std::span<const EXTRA_DATA_TYPE> a_types, std::span<BSExtraData*> a_result) const noexcept
+		{
+			detail::find_extras(_head, a_types, a_result, [this](EXTRA_DATA_TYPE a_type) { return HasType(a_type); });
+		}
+
+		// visits every extra in list order; return false to stop
+		template <class F>
+		void ForEachExtra(F a_func) const  //
+			requires(std::is_invocable_r_v<bool, F&, BSExtraData&>)
+		{
+			for (auto iter = _head; iter; iter = iter->next) {
+				if (!a_func(*iter)) {
+					break;
+				}
+			}
+		}
+
 		[[nodiscard]] bool HasType(EXTRA_DATA_TYPE a_type) const noexcept
 		{
 			assert(a_type < EXTRA_DATA_TYPE::kTotal);
@@ -774,7 +793,7 @@ namespace RE
 		stl::observer<TBO_InstanceData*> CreateInstanceData(TESBoundObject* a_object, bool a_generateName)
 		{
 			using func_t = decltype(&ExtraDataList::CreateInstanceData);
-			REL::Relocation<func_t> func{ REL::ID(1280130) };
+			static REL::Relocation<func_t> func{ REL::ID(1280130) };
 			return func(this, a_object, a_generateName);
 		}
 
@@ -790,10 +809,43 @@ namespace RE
 			return static_cast<T*>(GetByType(T::TYPE));
 		}
 
+		// one lock and one walk of the list for all of them, e.g.
+		// const auto [count, health] = list->GetByTypes<ExtraCount, ExtraHealth>();
+		template <detail::ExtraDataListConstraint... Ts>
+		[[nodiscard]] std::tuple<Ts*...> GetByTypes() const noexcept
+		{
+			const BSAutoReadLock l{ extraRWLock };
+			return GetByTypesImpl<Ts...>();
+		}
+
+		// calls a_visitor(list, Ts*...) for each non-null list, taking each list's lock once
+		template <detail::ExtraDataListConstraint... Ts, class F>
+		static void VisitByTypes(std::span<const ExtraDataList* const> a_lists, F a_visitor)  //
+			requires(std::invocable<F&, const ExtraDataList&, Ts*...>)
+		{
+			for (const auto list : a_lists) {
+				if (list) {
+					const BSAutoReadLock l{ list->extraRWLock };
+					std::apply(
+						[&](auto... a_extras) { a_visitor(*list, a_extras...); },
+						list->GetByTypesImpl<Ts...>());
+				}
+			}
+		}
+
+		// visits every extra under one read lock; return false to stop
+		template <class F>
+		void ForEachExtra(F a_func) const  //
+			requires(std::is_invocable_r_v<bool, F&, BSExtraData&>)
+		{
+			const BSAutoReadLock l{ extraRWLock };
+			extraData.ForEachExtra(std::move(a_func));
+		}
+
 		[[nodiscard]] BGSMod::Attachment::Mod* GetLegendaryMod()
 		{
 			using func_t = decltype(&ExtraDataList::GetLegendaryMod);
-			REL::Relocation<func_t> func{ REL::ID(178075) };
+			static REL::Relocation<func_t> func{ REL::ID(178075) };
 			return func(this);
 		}
 
@@ -824,20 +876,33 @@ namespace RE
 		void SetDisplayNameFromInstanceData(BGSObjectInstanceExtra* a_instExtra, TESBoundObject* a_object, const BSTSmartPointer<TBO_InstanceData>& a_data)
 		{
 			using func_t = decltype(&ExtraDataList::SetDisplayNameFromInstanceData);
-			REL::Relocation<func_t> func{ REL::ID(457340) };
+			static REL::Relocation<func_t> func{ REL::ID(457340) };
 			return func(this, a_instExtra, a_object, a_data);
 		}
 
 		void SetStartingWorldOrCell(TESForm* a_form)
 		{
 			using func_t = decltype(&ExtraDataList::SetStartingWorldOrCell);
-			REL::Relocation<func_t> func{ REL::ID(603621) };
+			static REL::Relocation<func_t> func{ REL::ID(603621) };
 			return func(this, a_form);
 		}
 
 		// members
 		BaseExtraList extraData;              // 08
 		mutable BSReadWriteLock extraRWLock;  // 20
+
+	private:
+		template <class... Ts>
+		[[nodiscard]] std::tuple<Ts*...> GetByTypesImpl() const noexcept
+		{
+			static_assert(sizeof...(Ts) > 0);
+			static constexpr std::array types{ Ts::TYPE... };
+			std::array<BSExtraData*, sizeof...(Ts)> extras{};
+			extraData.GetByTypes(types, extras);
+			return [&]<std::size_t... I>(std::index_sequence<I...>) {
+				return std::tuple<Ts*...>{ static_cast<Ts*>(extras[I])... };
+			}(std::index_sequence_for<Ts...>{});
+		}
 	};
 	static_assert(sizeof(ExtraDataList) == 0x28);
 }
@@ -0,0 +1,43 @@
+#pragma once
+
+namespace RE
+{
+	namespace detail
+	{
+		// looks up every type in one walk of an extra data list, instead of a walk per type. a_has is the
+		// list's presence check, so the walk ends once everything present has been found, and each node
+		// costs a single bit test unless it is one of the types asked for
+		template <class Node, class Type, class Has>
+		void find_extras(
+			Node* a_head,
+			std::span<const Type> a_types,
+			std::span<Node*> a_result,
+			Has a_has) noexcept
+		{
+			assert(a_types.size() == a_result.size());
+			std::ranges::fill(a_result, nullptr);
+
+			std::array<std::uint64_t, 4> wanted{};
+			std::size_t remaining = 0;
+			for (const auto type : a_types) {
+				assert(static_cast<std::size_t>(type) < 0x100);
+				if (a_has(type)) {
+					wanted[static_cast<std::size_t>(type) / 64] |= std::uint64_t{ 1 } << (static_cast<std::size_t>(type) % 64);
+					++remaining;
+				}
+			}
+
+			for (auto iter = a_head; iter && remaining > 0; iter = iter->next) {
+				const auto type = static_cast<std::size_t>(iter->GetExtraType());
+				if (type < 0x100 && (wanted[type / 64] >> (type % 64)) & 1) {
+					for (std::size_t i = 0; i < a_types.size(); ++i) {
+						if (a_types[i] == iter->GetExtraType() && !a_result[i]) {
+							a_result[i] = iter;
+							--remaining;
+						}
+					}
+				}
+			}
+		}
+	}
+}
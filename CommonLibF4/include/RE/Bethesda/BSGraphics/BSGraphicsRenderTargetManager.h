@@ -16,7 +16,7 @@ namespace RE
 		public:
 			[[nodiscard]] static RenderTargetManager& GetSingleton()
 			{
-				REL::Relocation<RenderTargetManager*> singleton{ REL::ID(1508457) };
+				static REL::Relocation<RenderTargetManager*> singleton{ REL::ID(1508457) };
 				return *singleton;
 			}
 
@@ -54,21 +54,21 @@ namespace RE
 			void CreateRenderTarget(std::uint32_t target, RenderTargetProperties& targetProps, TARGET_PERSISTENCY persist)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::CreateRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(43433) };
+				static REL::Relocation<func_t> func{ REL::ID(43433) };
 				return func(this, target, targetProps, persist);
 			}
 
 			void CreateDepthStencilTarget(std::uint32_t target, DepthStencilTargetProperties& depthProps, TARGET_PERSISTENCY persist)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::CreateDepthStencilTarget);
-				REL::Relocation<func_t> func{ REL::ID(1159619) };
+				static REL::Relocation<func_t> func{ REL::ID(1159619) };
 				return func(this, target, depthProps, persist);
 			}
 
 			void CreateCubeMapRenderTarget(std::uint32_t target, CubeMapRenderTargetProperties& cubeProps, TARGET_PERSISTENCY persist)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::CreateCubeMapRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(1397856) };
+				static REL::Relocation<func_t> func{ REL::ID(1397856) };
 				return func(this, target, cubeProps, persist);
 			}
 
@@ -96,14 +96,14 @@ namespace RE
 			void SetCurrentRenderTarget(std::int32_t shadowRenderTarget, std::int32_t renderTarget, SetRenderTargetMode targetMode)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetCurrentRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(1502425) };
+				static REL::Relocation<func_t> func{ REL::ID(1502425) };
 				return func(this, shadowRenderTarget, renderTarget, targetMode);
 			}
 
 			void SetCurrentDepthStencilTarget(std::int32_t depthStencilTarget, SetRenderTargetMode targetMode, std::int32_t depthStencilSliceIndex, [[maybe_unused]] bool a3)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetCurrentDepthStencilTarget);
-				REL::Relocation<func_t> func{ REL::ID(704517) };
+				static REL::Relocation<func_t> func{ REL::ID(704517) };
 				return func(this, depthStencilTarget, targetMode, depthStencilSliceIndex, a3);
 			}
 
@@ -114,14 +114,14 @@ namespace RE
 			void SetCurrentViewportForceToRenderTargetDimensions()
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetCurrentViewportForceToRenderTargetDimensions);
-				REL::Relocation<func_t> func{ REL::ID(1208720) };
+				static REL::Relocation<func_t> func{ REL::ID(1208720) };
 				return func(this);
 			}
 
 			void SetUseDynamicResolutionViewportAsDefaultViewport(bool a1)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetUseDynamicResolutionViewportAsDefaultViewport);
-				REL::Relocation<func_t> func{ REL::ID(676851) };
+				static REL::Relocation<func_t> func{ REL::ID(676851) };
 				return func(this, a1);
 			}
 
@@ -154,7 +154,7 @@ namespace RE
 					//Assert: Bad texture stage
 				}
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetTextureRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(1433009) };
+				static REL::Relocation<func_t> func{ REL::ID(1433009) };
 				return func(this, textureID, renderTargetID, copyView);
 			}
 
@@ -164,7 +164,7 @@ namespace RE
 					//Assert: Bad texture stage
 				}
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetTextureRenderTarget_2);
-				REL::Relocation<func_t> func{ REL::ID(1513035) };
+				static REL::Relocation<func_t> func{ REL::ID(1513035) };
 				return func(this, textureID, renderTargetID, texMode, copyView);
 			}
 
@@ -174,7 +174,7 @@ namespace RE
 					//Assert: Bad texture stage
 				}
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetTextureDepth);
-				REL::Relocation<func_t> func{ REL::ID(182949) };
+				static REL::Relocation<func_t> func{ REL::ID(182949) };
 				return func(this, textureID, depthStencilTargetID);
 			}
 
@@ -184,7 +184,7 @@ namespace RE
 					//Assert: Bad texture stage
 				}
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SetTextureDepth_2);
-				REL::Relocation<func_t> func{ REL::ID(1405563) };
+				static REL::Relocation<func_t> func{ REL::ID(1405563) };
 				return func(this, textureID, depthStencilTargetID, texMode);
 			}
 
@@ -203,56 +203,56 @@ namespace RE
 			void CopyRenderTargetToRenderTargetCopy(std::uint32_t target, std::uint32_t target2)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::CopyRenderTargetToRenderTargetCopy);
-				REL::Relocation<func_t> func{ REL::ID(591200) };
+				static REL::Relocation<func_t> func{ REL::ID(591200) };
 				return func(this, target, target2);
 			}
 
 			void AcquireRenderTarget(std::uint32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::AcquireDepthStencil);
-				REL::Relocation<func_t> func{ REL::ID(1468639) };
+				static REL::Relocation<func_t> func{ REL::ID(1468639) };
 				return func(this, target);
 			}
 
 			void ReleaseRenderTarget(std::uint32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::ReleaseRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(1374956) };
+				static REL::Relocation<func_t> func{ REL::ID(1374956) };
 				return func(this, target);
 			}
 
 			void AcquireDepthStencil(std::uint32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::AcquireDepthStencil);
-				REL::Relocation<func_t> func{ REL::ID(1015879) };
+				static REL::Relocation<func_t> func{ REL::ID(1015879) };
 				return func(this, target);
 			}
 
 			void ReleaseDepthStencil(std::uint32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::ReleaseDepthStencil);
-				REL::Relocation<func_t> func{ REL::ID(922599) };
+				static REL::Relocation<func_t> func{ REL::ID(922599) };
 				return func(this, target);
 			}
 
 			void AcquireCubemap(std::uint32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::AcquireCubemap);
-				REL::Relocation<func_t> func{ REL::ID(563587) };
+				static REL::Relocation<func_t> func{ REL::ID(563587) };
 				return func(this, target);
 			}
 
 			void ReleaseCubemap(std::uint32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::ReleaseCubemap);
-				REL::Relocation<func_t> func{ REL::ID(469959) };
+				static REL::Relocation<func_t> func{ REL::ID(469959) };
 				return func(this, target);
 			}
 
 			bool QIsAcquiredRenderTarget(std::int32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::QIsAcquiredRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(110930) };
+				static REL::Relocation<func_t> func{ REL::ID(110930) };
 				return func(this, target);
 			}
 
@@ -272,21 +272,21 @@ namespace RE
 			void CopyRenderTargetToClipboard(std::int32_t target)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::CopyRenderTargetToClipboard);
-				REL::Relocation<func_t> func{ REL::ID(1295596) };
+				static REL::Relocation<func_t> func{ REL::ID(1295596) };
 				return func(this, target);
 			}
 
 			void CopyRenderTargetToTexture(std::int32_t target, Texture* tex, bool a3, bool a4)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::CopyRenderTargetToTexture);
-				REL::Relocation<func_t> func{ REL::ID(1561984) };
+				static REL::Relocation<func_t> func{ REL::ID(1561984) };
 				return func(this, target, tex, a3, a4);
 			}
 
 			Texture* SaveRenderTargetToTexture(std::int32_t renderTargetID, bool srgb, bool a2, Usage use)
 			{
 				using func_t = decltype(&BSGraphics::RenderTargetManager::SaveRenderTargetToTexture);
-				REL::Relocation<func_t> func{ REL::ID(950217) };
+				static REL::Relocation<func_t> func{ REL::ID(950217) };
 				return func(this, renderTargetID, srgb, a2, use);
 			}
 
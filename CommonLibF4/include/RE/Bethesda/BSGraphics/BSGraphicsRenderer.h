@@ -13,7 +13,7 @@ namespace RE
 		public:
 			[[nodiscard]] static RendererData* GetSingleton()
 			{
-				REL::Relocation<RendererData**> singleton{ REL::ID(1235449) };
+				static REL::Relocation<RendererData**> singleton{ REL::ID(1235449) };
 				return *singleton;
 			}
 
@@ -56,122 +56,122 @@ namespace RE
 
 			[[nodiscard]] static Renderer& GetSingleton()
 			{
-				REL::Relocation<Renderer*> singleton{ REL::ID(1378294) };
+				static REL::Relocation<Renderer*> singleton{ REL::ID(1378294) };
 				return *singleton;
 			}
 
 			void Begin(std::uint32_t window) {
 				using func_t = decltype(&BSGraphics::Renderer::Begin);
-				REL::Relocation<func_t> func{ REL::ID(288964) };
+				static REL::Relocation<func_t> func{ REL::ID(288964) };
 				return func(this, window);
 			}
 
 			void End()
 			{
 				using func_t = decltype(&BSGraphics::Renderer::End);
-				REL::Relocation<func_t> func{ REL::ID(700869) };
+				static REL::Relocation<func_t> func{ REL::ID(700869) };
 				return func(this);
 			}
 
 			void IncRef(Buffer* vertexBuffer)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::IncRef);
-				REL::Relocation<func_t> func{ REL::ID(1337764) };
+				static REL::Relocation<func_t> func{ REL::ID(1337764) };
 				return func(this, vertexBuffer);
 			}
 
 			void DecRef(Buffer* vertexBuffer)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::DecRef);
-				REL::Relocation<func_t> func{ REL::ID(194808) };
+				static REL::Relocation<func_t> func{ REL::ID(194808) };
 				return func(this, vertexBuffer);
 			}
 
 			bool TryLock() {
 				using func_t = decltype(&BSGraphics::Renderer::TryLock);
-				REL::Relocation<func_t> func{ REL::ID(1259999) };
+				static REL::Relocation<func_t> func{ REL::ID(1259999) };
 				return func(this);
 			}
 
 			void Lock() {
 				using func_t = decltype(&BSGraphics::Renderer::Lock);
-				REL::Relocation<func_t> func{ REL::ID(1087134) };
+				static REL::Relocation<func_t> func{ REL::ID(1087134) };
 				return func(this);
 			}
 
 			void Unlock() {
 				using func_t = decltype(&BSGraphics::Renderer::Unlock);
-				REL::Relocation<func_t> func{ REL::ID(382332) };
+				static REL::Relocation<func_t> func{ REL::ID(382332) };
 				return func(this);
 			}
 
 			void ClearColor()
 			{
 				using func_t = decltype(&BSGraphics::Renderer::ClearColor);
-				REL::Relocation<func_t> func{ REL::ID(673185) };
+				static REL::Relocation<func_t> func{ REL::ID(673185) };
 				return func(this);
 			}
 
 			Texture* CreateEmptyTexture(std::uint32_t width, std::uint32_t height)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::CreateEmptyTexture);
-				REL::Relocation<func_t> func{ REL::ID(1024513) };
+				static REL::Relocation<func_t> func{ REL::ID(1024513) };
 				return func(this, width, height);
 			}
 
 			void DoZPrePass(NiCamera* cam1, NiCamera* cam2, float a1, float a2, float a3, float a4)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::DoZPrePass);
-				REL::Relocation<func_t> func{ REL::ID(1491502) };
+				static REL::Relocation<func_t> func{ REL::ID(1491502) };
 				return func(this, cam1, cam2, a1, a2, a3, a4);
 			}
 
 			void Flush()
 			{
 				using func_t = decltype(&BSGraphics::Renderer::Flush);
-				REL::Relocation<func_t> func{ REL::ID(952687) };
+				static REL::Relocation<func_t> func{ REL::ID(952687) };
 				return func(this);
 			}
 
 			bool MapTexture(BSGraphics::Texture* texture, Map mapType, TextureAccess& textureAccess)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::MapTexture);
-				REL::Relocation<func_t> func{ REL::ID(952687) };
+				static REL::Relocation<func_t> func{ REL::ID(952687) };
 				return func(this, texture, mapType, textureAccess);
 			}
 
 			void UnmapTexture(BSGraphics::Texture* texture)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::UnmapTexture);
-				REL::Relocation<func_t> func{ REL::ID(835184) };
+				static REL::Relocation<func_t> func{ REL::ID(835184) };
 				return func(this, texture);
 			}
 
 			void SetClearColor(float red, float green, float blue, float alpha)
 			{
 				using func_t = decltype(&BSGraphics::Renderer::SetClearColor);
-				REL::Relocation<func_t> func{ REL::ID(1391151) };
+				static REL::Relocation<func_t> func{ REL::ID(1391151) };
 				return func(this, red, green, blue, alpha);
 			}
 
 			void ResetZPrePass()
 			{
 				using func_t = decltype(&BSGraphics::Renderer::ResetZPrePass);
-				REL::Relocation<func_t> func{ REL::ID(1359409) };
+				static REL::Relocation<func_t> func{ REL::ID(1359409) };
 				return func(this);
 			}
 
 			void ResetState()
 			{
 				using func_t = decltype(&BSGraphics::Renderer::ResetState);
-				REL::Relocation<func_t> func{ REL::ID(405603) };
+				static REL::Relocation<func_t> func{ REL::ID(405603) };
 				return func(this);
 			}
 
 			void RestorePreviousClearColor()
 			{
 				using func_t = decltype(&BSGraphics::Renderer::RestorePreviousClearColor);
-				REL::Relocation<func_t> func{ REL::ID(593605) };
+				static REL::Relocation<func_t> func{ REL::ID(593605) };
 				return func(this);
 			}
 
@@ -48,14 +48,14 @@ namespace RE
 		public:
 			[[nodiscard]] static State& GetSingleton()
 			{
-				REL::Relocation<State*> singleton{ REL::ID(600795) };
+				static REL::Relocation<State*> singleton{ REL::ID(600795) };
 				return *singleton;
 			}
 
 			void SetCameraData(NiCamera* cam, bool a3, float a4, float a5)
 			{
 				using func_t = decltype(&BSGraphics::State::SetCameraData);
-				REL::Relocation<func_t> func{ REL::ID(185153) };
+				static REL::Relocation<func_t> func{ REL::ID(185153) };
 				return func(this, cam, a3, a4, a5);
 			}
 
@@ -51,42 +51,42 @@ namespace RE
 		void CopyMembers(bhkNPCollisionObject* from, NiCloningProcess& cp)
 		{
 			using func_t = decltype(&RE::bhkNPCollisionObject::CopyMembers);
-			REL::Relocation<func_t> func{ REL::ID(1558409) };
+			static REL::Relocation<func_t> func{ REL::ID(1558409) };
 			func(this, from, cp);
 		}
 
 		static bhkNPCollisionObject* Getbhk(bhkWorld* world, hknpBodyId& bodyId)
 		{
 			using func_t = decltype(&RE::bhkNPCollisionObject::Getbhk);
-			REL::Relocation<func_t> func{ REL::ID(730034) };
+			static REL::Relocation<func_t> func{ REL::ID(730034) };
 			return func(world, bodyId);
 		}
 
 		hknpShape* GetShape()
 		{
 			using func_t = decltype(&RE::bhkNPCollisionObject::GetShape);
-			REL::Relocation<func_t> func{ REL::ID(315427) };
+			static REL::Relocation<func_t> func{ REL::ID(315427) };
 			return func(this);
 		}
 
 		bool GetTransform(hkTransformf& transform)
 		{
 			using func_t = decltype(&RE::bhkNPCollisionObject::GetTransform);
-			REL::Relocation<func_t> func{ REL::ID(1508189) };
+			static REL::Relocation<func_t> func{ REL::ID(1508189) };
 			return func(this, transform);
 		}
 
 		void SetMotionType(hknpMotionPropertiesId::Preset type)
 		{
 			using func_t = decltype(&RE::bhkNPCollisionObject::SetMotionType);
-			REL::Relocation<func_t> func{ REL::ID(200912) };
+			static REL::Relocation<func_t> func{ REL::ID(200912) };
 			return func(this, type);
 		}
 
 		bool SetTransform(hkTransformf& transform)
 		{
 			using func_t = decltype(&RE::bhkNPCollisionObject::SetTransform);
-			REL::Relocation<func_t> func{ REL::ID(178085) };
+			static REL::Relocation<func_t> func{ REL::ID(178085) };
 			return func(this, transform);
 		}
 
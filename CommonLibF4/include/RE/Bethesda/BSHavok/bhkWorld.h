@@ -42,7 +42,7 @@ namespace RE
 		static bool RemoveObjects(NiAVObject* a_object, bool a_recurse, bool a_force)
 		{
 			using func_t = decltype(&RemoveObjects);
-			REL::Relocation<func_t> func{ REL::ID(1514984) };
+			static REL::Relocation<func_t> func{ REL::ID(1514984) };
 			return func(a_object, a_recurse, a_force);
 		}
 
@@ -77,28 +77,28 @@ namespace RE
 		void MarkForRead()
 		{
 			using func_t = decltype(&RE::hknpBSWorld::MarkForRead);
-			REL::Relocation<func_t> func{ REL::ID(1190448) };
+			static REL::Relocation<func_t> func{ REL::ID(1190448) };
 			return func(this);
 		}
 
 		void UnmarkForRead()
 		{
 			using func_t = decltype(&RE::hknpBSWorld::UnmarkForRead);
-			REL::Relocation<func_t> func{ REL::ID(485648) };
+			static REL::Relocation<func_t> func{ REL::ID(485648) };
 			return func(this);
 		}
 
 		void MarkForWrite()
 		{
 			using func_t = decltype(&RE::hknpBSWorld::MarkForWrite);
-			REL::Relocation<func_t> func{ REL::ID(1017544) };
+			static REL::Relocation<func_t> func{ REL::ID(1017544) };
 			return func(this);
 		}
 
 		void UnmarkForWrite()
 		{
 			using func_t = decltype(&RE::hknpBSWorld::UnmarkForWrite);
-			REL::Relocation<func_t> func{ REL::ID(312883) };
+			static REL::Relocation<func_t> func{ REL::ID(312883) };
 			return func(this);
 		}
 
@@ -118,70 +118,70 @@ namespace RE
 		bhkPickData()
 		{
 			typedef bhkPickData* func_t(bhkPickData*);
-			REL::Relocation<func_t> func{ REL::ID(526783) };
+			static REL::Relocation<func_t> func{ REL::ID(526783) };
 			func(this);
 		}
 
 		void SetStartEnd(const NiPoint3& start, const NiPoint3& end)
 		{
 			using func_t = decltype(&bhkPickData::SetStartEnd);
-			REL::Relocation<func_t> func{ REL::ID(747470) };
+			static REL::Relocation<func_t> func{ REL::ID(747470) };
 			return func(this, start, end);
 		}
 
 		void Reset()
 		{
 			using func_t = decltype(&bhkPickData::Reset);
-			REL::Relocation<func_t> func{ REL::ID(438299) };
+			static REL::Relocation<func_t> func{ REL::ID(438299) };
 			return func(this);
 		}
 
 		bool HasHit()
 		{
 			using func_t = decltype(&bhkPickData::HasHit);
-			REL::Relocation<func_t> func{ REL::ID(1181584) };
+			static REL::Relocation<func_t> func{ REL::ID(1181584) };
 			return func(this);
 		}
 
 		float GetHitFraction()
 		{
 			using func_t = decltype(&bhkPickData::GetHitFraction);
-			REL::Relocation<func_t> func{ REL::ID(476687) };
+			static REL::Relocation<func_t> func{ REL::ID(476687) };
 			return func(this);
 		}
 
 		int32_t GetAllCollectorRayHitSize()
 		{
 			using func_t = decltype(&bhkPickData::GetAllCollectorRayHitSize);
-			REL::Relocation<func_t> func{ REL::ID(1288513) };
+			static REL::Relocation<func_t> func{ REL::ID(1288513) };
 			return func(this);
 		}
 
 		bool GetAllCollectorRayHitAt(uint32_t i, hknpCollisionResult& res)
 		{
 			using func_t = decltype(&bhkPickData::GetAllCollectorRayHitAt);
-			REL::Relocation<func_t> func{ REL::ID(583997) };
+			static REL::Relocation<func_t> func{ REL::ID(583997) };
 			return func(this, i, res);
 		}
 
 		void SortAllCollectorHits()
 		{
 			using func_t = decltype(&bhkPickData::SortAllCollectorHits);
-			REL::Relocation<func_t> func{ REL::ID(1274842) };
+			static REL::Relocation<func_t> func{ REL::ID(1274842) };
 			return func(this);
 		}
 
 		NiAVObject* GetNiAVObject()
 		{
 			using func_t = decltype(&bhkPickData::GetNiAVObject);
-			REL::Relocation<func_t> func{ REL::ID(863406) };
+			static REL::Relocation<func_t> func{ REL::ID(863406) };
 			return func(this);
 		}
 
 		hknpBody* GetBody()
 		{
 			using func_t = decltype(&bhkPickData::GetBody);
-			REL::Relocation<func_t> func{ REL::ID(1223055) };
+			static REL::Relocation<func_t> func{ REL::ID(1223055) };
 			return func(this);
 		}
 
@@ -34,7 +34,7 @@ namespace RE
 		BSInputEventUser* ctor()
 		{
 			using func_t = decltype(&BSInputEventUser::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1240396), 0xC0 };
+			static REL::Relocation<func_t> func{ REL::ID(1240396), 0xC0 };
 			return func(this);
 		}
 	};
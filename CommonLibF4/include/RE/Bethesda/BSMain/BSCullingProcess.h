@@ -53,7 +53,7 @@ namespace RE
 		void SetAccumulator(NiAccumulator* accumulator)
 		{
 			using func_t = decltype(&BSCullingProcess::SetAccumulator);
-			REL::Relocation<func_t> func{ REL::ID(236955) };
+			static REL::Relocation<func_t> func{ REL::ID(236955) };
 			return func(this, accumulator);
 		}
 
@@ -71,7 +71,7 @@ namespace RE
 		BSCullingProcess* ctor(NiVisibleArray* a_array)
 		{
 			using func_t = decltype(&BSCullingProcess::ctor);
-			REL::Relocation<func_t> func{ REL::ID(423200) };
+			static REL::Relocation<func_t> func{ REL::ID(423200) };
 			return func(this, a_array);
 		};
 	};
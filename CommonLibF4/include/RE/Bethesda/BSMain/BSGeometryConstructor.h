@@ -14,7 +14,7 @@ namespace RE
 		bool IsEmpty()
 		{
 			using func_t = decltype(&BSGeometryConstructor::IsEmpty);
-			REL::Relocation<func_t> func{ REL::ID(1490431), 0x30 };
+			static REL::Relocation<func_t> func{ REL::ID(1490431), 0x30 };
 			return func(this);
 		}
 		//members
@@ -34,7 +34,7 @@ namespace RE
 
 			static BSResource::EntryDB<BSModelDB::DBTraits>* GetSingleton()
 			{
-				REL::Relocation<BSResource::EntryDB<BSModelDB::DBTraits>**> singleton{ REL::ID(45807) };
+				static REL::Relocation<BSResource::EntryDB<BSModelDB::DBTraits>**> singleton{ REL::ID(45807) };
 				return *singleton;
 			}
 		};
@@ -46,7 +46,7 @@ namespace RE
 			const DBTraits::ArgsType& a_args)
 		{
 			using func_t = BSResource::ErrorCode (*)(const char*, BSResource::RHandleType<BSResource::Entry<NiPointer<NiNode>, BSResource::EntryDBTraits<BSModelDB::DBTraits, BSResource::EntryDB<BSModelDB::DBTraits>>::CArgs>, BSResource::EntryDB<BSModelDB::DBTraits>>&, const DBTraits::ArgsType&);
-			REL::Relocation<func_t> func{ REL::ID(1066398) };
+			static REL::Relocation<func_t> func{ REL::ID(1066398) };
 			return func(a_name, a_result, a_args);
 		}*/
 
@@ -56,7 +56,7 @@ namespace RE
 			const DBTraits::ArgsType& a_args)
 		{
 			using func_t = BSResource::ErrorCode (*)(const char*, NiPointer<NiNode>*, const DBTraits::ArgsType&);
-			REL::Relocation<func_t> func{ REL::ID(1225688) };
+			static REL::Relocation<func_t> func{ REL::ID(1225688) };
 			return func(a_name, a_result, a_args);
 		}*/
 	}
@@ -41,28 +41,28 @@ namespace RE
 		BSVisitControl VisitSceneGraphAVObjects(NiAVObject* apAVObject, BSVisitControl (&visitor)(NiAVObject*))
 		{
 			using func_t = decltype(&VisitSceneGraphAVObjects);
-			REL::Relocation<func_t> func{ REL::ID(1449576) };
+			static REL::Relocation<func_t> func{ REL::ID(1449576) };
 			return func(apAVObject, visitor);
 		}
 
 		BSVisitControl VisitScenegraphGeometries_AVObject(NiAVObject* apAVObject, BSVisitControl (&visitor)(NiAVObject*))
 		{
 			using func_t = decltype(&VisitScenegraphGeometries_AVObject);
-			REL::Relocation<func_t> func{ REL::ID(298633) };
+			static REL::Relocation<func_t> func{ REL::ID(298633) };
 			return func(apAVObject, visitor);
 		}
 
 		BSVisitControl VisitScenegraphGeometries_Geometry(NiAVObject* apAVObject, BSVisitControl (&visitor)(BSGeometry*))
 		{
 			using func_t = decltype(&VisitScenegraphGeometries_Geometry);
-			REL::Relocation<func_t> func{ REL::ID(240214) };
+			static REL::Relocation<func_t> func{ REL::ID(240214) };
 			return func(apAVObject, visitor);
 		}
 
 		BSVisitControl VisitScenegraphNodes(NiAVObject* ap3D, BSVisitControl (&visitor)(NiAVObject*))
 		{
 			using func_t = decltype(&VisitScenegraphNodes);
-			REL::Relocation<func_t> func{ REL::ID(659184) };
+			static REL::Relocation<func_t> func{ REL::ID(659184) };
 			return func(ap3D, visitor);
 		}
 
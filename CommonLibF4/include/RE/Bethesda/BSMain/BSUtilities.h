@@ -12,7 +12,7 @@ namespace RE
 		inline NiAVObject* GetObjectByName(NiAVObject* a_object, const BSFixedString& a_name, bool tryInternal, bool dontAttach)
 		{
 			using func_t = decltype(&BSUtilities::GetObjectByName);
-			REL::Relocation<func_t> func{ REL::ID(843650) };
+			static REL::Relocation<func_t> func{ REL::ID(843650) };
 			return func(a_object, a_name, tryInternal, dontAttach);
 		}
 
@@ -20,7 +20,7 @@ namespace RE
 		{
 			const BSFixedString string(a_name);
 			using func_t = decltype(&BSUtilities::GetObjectByName);
-			REL::Relocation<func_t> func{ REL::ID(843650) };
+			static REL::Relocation<func_t> func{ REL::ID(843650) };
 			return func(a_object, string, tryInternal, dontAttach);
 		}
 	}
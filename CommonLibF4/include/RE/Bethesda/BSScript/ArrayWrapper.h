@@ -48,7 +48,7 @@ namespace RE
 			void ReplaceArray(BSScrapArray<Variable>& a_copy, IVirtualMachine& a_vm)
 			{
 				using func_t = decltype(&ArrayWrapper::ReplaceArray);
-				REL::Relocation<func_t> func{ REL::ID(445184) };
+				static REL::Relocation<func_t> func{ REL::ID(445184) };
 				return func(this, a_copy, a_vm);
 			}
 
@@ -142,6 +142,13 @@ namespace RE
 				std::optional<bool> a_taskletCallable = std::nullopt,
 				bool a_isLatent = false);
 
+			template <auto F>
+			void BindNativeMethod(
+				stl::zstring a_object,
+				stl::zstring a_function,
+				std::optional<bool> a_taskletCallable = std::nullopt,
+				bool a_isLatent = false);
+
 			void PostError(std::string_view a_msg, std::uint32_t a_stackID, ErrorLogger::Severity a_severity)
 			{
 				class ErrorImpl :
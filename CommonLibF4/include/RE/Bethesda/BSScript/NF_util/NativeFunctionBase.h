@@ -87,7 +87,7 @@ namespace RE
 				CallResult Call(const BSTSmartPointer<Stack>& a_stack, ErrorLogger& a_errorLogger, Internal::VirtualMachine& a_vm, bool a_inScriptTasklet) const override  // 0F
 				{
 					using func_t = decltype(&NativeFunctionBase::Call);
-					REL::Relocation<func_t> func{ REL::ID(571037) };
+					static REL::Relocation<func_t> func{ REL::ID(571037) };
 					return func(this, a_stack, a_errorLogger, a_vm, a_inScriptTasklet);
 				}
 
@@ -60,7 +60,7 @@ namespace RE
 			void BindObject(const BSTSmartPointer<Object>& a_obj, std::size_t a_objHandle)
 			{
 				using func_t = decltype(&ObjectBindPolicy::BindObject);
-				REL::Relocation<func_t> func{ REL::ID(709728) };
+				static REL::Relocation<func_t> func{ REL::ID(709728) };
 				return func(this, a_obj, a_objHandle);
 			}
 
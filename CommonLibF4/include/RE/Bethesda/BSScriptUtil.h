@@ -1,12 +1,16 @@
 #pragma once
 
-#include "RE/Bethesda/BSSystem/BSFixedString.h"
-#include "RE/Bethesda/BSScript.h"
-#include "RE/Bethesda/BSCore/BSTHashMap.h"
-#include "RE/Bethesda/GameScript.h"
-#include "RE/Bethesda/TESForms.h"
+#include "RE/SnapshotDomain.h"
 
-#include "F4SE/Logger.h"
+#ifndef F4SE_TEST_SUITE
+#	include "RE/Bethesda/BSSystem/BSFixedString.h"
+#	include "RE/Bethesda/BSScript.h"
+#	include "RE/Bethesda/BSCore/BSTHashMap.h"
+#	include "RE/Bethesda/GameScript.h"
+#	include "RE/Bethesda/TESForms.h"
+
+#	include "F4SE/Logger.h"
+#endif
 
 namespace RE::BSScript
 {
@@ -52,6 +56,61 @@ namespace RE::BSScript
 	private:
 		static constexpr stl::nttp::string _full = detail::make_structure_tag(Object, Structure);
 
+		// the member indices of one load of the structure's type. the type is held, so its address cannot
+		// be reused by a reloaded type while the layout is cached
+		struct layout_t
+		{
+		public:
+			explicit layout_t(BSTSmartPointer<StructTypeInfo> a_type) :
+				type(std::move(a_type))
+			{
+				for (const auto& [member, index] : type->varNameIndexMap) {
+					slots.emplace_back(static_cast<std::string_view>(member), index);
+				}
+			}
+
+			// papyrus names are case insensitive
+			[[nodiscard]] std::optional<std::uint32_t> find(std::string_view a_name) const noexcept
+			{
+				for (const auto& [member, index] : slots) {
+					if (member.size() == a_name.size() &&
+						_strnicmp(member.data(), a_name.data(), a_name.size()) == 0) {
+						return index;
+					}
+				}
+				return std::nullopt;
+			}
+
+			// members
+			BSTSmartPointer<StructTypeInfo> type;
+			std::vector<std::pair<std::string_view, std::uint32_t>> slots;
+		};
+
+		// calls a_func with the cached layout, rebuilding it whenever the vm hands out a different type for
+		// the structure. readers only pin the layout, and the one they replace is freed once none can see it
+		template <class F>
+		[[nodiscard]] static auto visit_layout(const BSTSmartPointer<StructTypeInfo>& a_type, F a_func)
+		{
+			{
+				const RE::detail::SnapshotDomain::reader_guard guard{ _domain };
+				const auto layout = _layout.load(std::memory_order_acquire);
+				if (layout && layout->type.get() == a_type.get()) {
+					return a_func(*layout);
+				}
+			}
+
+			const std::scoped_lock l{ _writeLock };
+			auto layout = _layout.load(std::memory_order_relaxed);
+			if (!layout || layout->type.get() != a_type.get()) {
+				layout = new layout_t(a_type);
+				const std::unique_ptr<const layout_t> old{ _layout.exchange(layout, std::memory_order_acq_rel) };
+				if (old) {
+					_domain.synchronize();
+				}
+			}
+			return a_func(*layout);  // only the lock's holder frees a layout
+		}
+
 	public:
 		static constexpr std::string_view name{ _full.data(), _full.length() };
 
@@ -61,7 +120,7 @@ namespace RE::BSScript
 				const auto game = GameVM::GetSingleton();
 				const auto vm = game ? game->GetVM() : nullptr;
 				if (!vm ||
-					!vm->CreateStruct(name, _proxy) ||
+					!vm->CreateStruct(fixed_literal<_full>::get(), _proxy) ||
 					!_proxy) {
 					F4SE::log::error(
 						FMT_STRING("failed to create structure of type \"{}\""),
@@ -71,16 +130,77 @@ namespace RE::BSScript
 			}
 		}
 
+		// fills many instances of the structure, resolving the members it writes once up front, e.g.
+		// const PluginInfo::builder make{ "index"sv, "name"sv };
+		// result.push_back(make(mod->GetCompileIndex(), mod->GetFilename()));
+		class builder
+		{
+		public:
+			template <class... Names>
+			explicit builder(Names... a_names)  //
+				requires((std::convertible_to<Names, std::string_view> && ...)) :
+				_names{ std::string_view{ a_names }... }
+			{
+				const auto game = GameVM::GetSingleton();
+				const auto vm = game ? game->GetVM() : nullptr;
+				BSTSmartPointer<StructTypeInfo> type;
+				if (vm && vm->GetScriptStructType(fixed_literal<_full>::get(), type) && type) {
+					_slots = visit_layout(type, [&](const layout_t& a_layout) { return resolve(a_layout); });
+					_type = std::move(type);
+				}
+			}
+
+			// each value is packed into the member named at the same position. nothing is written to the
+			// builder, so one may be shared between threads
+			template <class... Args>
+			[[nodiscard]] structure_wrapper operator()(Args&&... a_values) const
+			{
+				assert(sizeof...(Args) == _names.size());
+				structure_wrapper result;
+				const auto pack = [&](const std::vector<std::optional<std::uint32_t>>& a_slots) {
+					std::size_t i = 0;
+					(result.pack(a_slots[i++], std::forward<Args>(a_values)), ...);
+				};
+
+				if (result._proxy && result._proxy->type) {
+					if (_type && _type.get() == result._proxy->type.get()) {
+						pack(_slots);
+					} else {  // the vm has reloaded the type since, so this one is resolved on its own
+						pack(visit_layout(result._proxy->type, [&](const layout_t& a_layout) { return resolve(a_layout); }));
+					}
+				}
+				return result;
+			}
+
+		private:
+			[[nodiscard]] std::vector<std::optional<std::uint32_t>> resolve(const layout_t& a_layout) const
+			{
+				std::vector<std::optional<std::uint32_t>> slots;
+				slots.reserve(_names.size());
+				for (const auto member : _names) {
+					const auto slot = a_layout.find(member);
+					if (!slot) {
+						F4SE::log::warn(
+							FMT_STRING("failed to pack var \"{}\" on structure \"{}\""),
+							member,
+							name);
+					}
+					slots.push_back(slot);
+				}
+				return slots;
+			}
+
+			// members
+			std::vector<std::string_view> _names;
+			BSTSmartPointer<StructTypeInfo> _type;
+			std::vector<std::optional<std::uint32_t>> _slots;
+		};
+
 		template <class T>
 		std::optional<T> find(std::string_view a_name, bool a_quiet = false) const
 		{
-			if (_proxy && _proxy->type) {
-				const auto& mappings = _proxy->type->varNameIndexMap;
-				const auto it = mappings.find(a_name);
-				if (it != mappings.end()) {
-					const auto& var = _proxy->variables[it->second];
-					return detail::UnpackVariable<T>(var);
-				}
+			if (const auto var = lookup(a_name); var) {
+				return detail::UnpackVariable<T>(*var);
 			}
 
 			if (!a_quiet) {
@@ -96,14 +216,9 @@ namespace RE::BSScript
 		template <class T>
 		bool insert(std::string_view a_name, T&& a_val)
 		{
-			if (_proxy && _proxy->type) {
-				auto& mappings = _proxy->type->varNameIndexMap;
-				const auto it = mappings.find(a_name);
-				if (it != mappings.end()) {
-					auto& var = _proxy->variables[it->second];
-					detail::PackVariable(var, std::forward<T>(a_val));
-					return true;
-				}
+			if (const auto var = lookup(a_name); var) {
+				detail::PackVariable(*var, std::forward<T>(a_val));
+				return true;
 			}
 
 			F4SE::log::warn(
@@ -126,6 +241,31 @@ namespace RE::BSScript
 		[[nodiscard]] BSTSmartPointer<Struct> get_proxy() && { return std::move(_proxy); }
 
 	private:
+		[[nodiscard]] Variable* lookup(std::string_view a_name) const
+		{
+			if (!_proxy || !_proxy->type) {
+				return nullptr;
+			}
+
+			const auto index = visit_layout(_proxy->type, [&](const layout_t& a_layout) { return a_layout.find(a_name); });
+			return index ? std::addressof(_proxy->variables[*index]) : nullptr;
+		}
+
+		template <class T>
+		void pack(std::optional<std::uint32_t> a_slot, T&& a_val)
+		{
+			if (a_slot) {
+				detail::PackVariable(_proxy->variables[*a_slot], std::forward<T>(a_val));
+			}
+		}
+
+		// the last layout, and the type it holds, are never freed: by the time the dll's statics are
+		// destroyed the vm may already be gone, so nothing is released from a static destructor
+		static inline std::atomic<const layout_t*> _layout{ nullptr };
+		static inline RE::detail::SnapshotDomain _domain;
+		static inline std::mutex _writeLock;
+
+		// members
 		BSTSmartPointer<Struct> _proxy;
 	};
 
@@ -289,6 +429,15 @@ namespace RE::BSScript
 		};
 		// clang-format on
 
+		// a non-owning range, such as a span over a form's array, which can be returned in place of an
+		// array without first copying it into one
+		template <class T>
+		concept array_view =
+			std::ranges::view<T> &&
+			std::ranges::sized_range<T> &&
+			!string<T> &&
+			!array<T>;
+
 		template <class T>
 		concept wrapper = is_structure_wrapper_v<T>;
 
@@ -333,6 +482,7 @@ namespace RE::BSScript
 		template <class T>
 		concept valid_return =
 			valid_parameter<T> ||
+			array_view<T> ||
 			std::same_as<T, void>;
 
 		struct wrapper_accessor
@@ -406,7 +556,7 @@ namespace RE::BSScript
 	{
 		const auto game = GameVM::GetSingleton();
 		const auto vm = game ? game->GetVM() : nullptr;
-		REL::Relocation<RE::BSFixedString*> baseObjectName{ REL::ID(648543) };
+		static REL::Relocation<RE::BSFixedString*> baseObjectName{ REL::ID(648543) };
 		BSTSmartPointer<ObjectTypeInfo> typeInfo;
 		if (!vm ||
 			!vm->GetScriptObjectType(*baseObjectName, typeInfo) ||
@@ -462,6 +612,19 @@ namespace RE::BSScript
 		return typeInfo;
 	}
 
+	template <detail::array_view T>
+	[[nodiscard]] std::optional<TypeInfo> GetTypeInfo()
+	{
+		using value_type = detail::decay_t<std::ranges::range_value_t<T>>;
+
+		auto typeInfo = detail::GetTypeInfo<value_type>();
+		if (typeInfo) {
+			typeInfo->SetArray(true);
+		}
+
+		return typeInfo;
+	}
+
 	template <detail::wrapper T>
 	[[nodiscard]] std::optional<TypeInfo> GetTypeInfo()
 	{
@@ -499,6 +662,110 @@ namespace RE::BSScript
 		}
 	}
 
+	// an output iterator which packs each value assigned through it straight into the next element of a
+	// vm array, e.g. std::ranges::copy(a_forms, array_sink{ *array })
+	class array_sink
+	{
+	private:
+		class proxy
+		{
+		public:
+			explicit proxy(Variable& a_var) noexcept :
+				_var(a_var)
+			{}
+
+			template <class T>
+			const proxy& operator=(T&& a_val) const
+			{
+				detail::PackVariable(_var, std::forward<T>(a_val));
+				return *this;
+			}
+
+		private:
+			Variable& _var;
+		};
+
+	public:
+		using difference_type = std::ptrdiff_t;
+
+		array_sink() noexcept = default;
+
+		explicit array_sink(Array& a_array) noexcept :
+			_first(a_array.elements.data()),
+			_last(a_array.elements.data() + a_array.elements.size())
+		{}
+
+		[[nodiscard]] proxy operator*() const noexcept
+		{
+			assert(_first != _last);
+			return proxy{ *_first };
+		}
+
+		array_sink& operator++() noexcept
+		{
+			++_first;
+			return *this;
+		}
+
+		array_sink operator++(int) noexcept
+		{
+			auto tmp = *this;
+			++_first;
+			return tmp;
+		}
+
+		// the elements left unwritten
+		[[nodiscard]] std::size_t remaining() const noexcept { return static_cast<std::size_t>(_last - _first); }
+
+	private:
+		Variable* _first{ nullptr };
+		Variable* _last{ nullptr };
+	};
+
+	namespace detail
+	{
+		// creates the vm array at its final size and packs each element directly into it. an owning
+		// container passed as an rvalue gives up its elements, anything else is copied from
+		template <class T, class R>
+		void PackArray(Variable& a_var, R&& a_range)
+		{
+			const auto success = [&]() {
+				const auto game = GameVM::GetSingleton();
+				const auto vm = game ? game->GetVM() : nullptr;
+				const auto typeInfo = GetTypeInfo<T>();
+				const auto size = std::ranges::size(a_range);
+				BSTSmartPointer<Array> out;
+				if (!typeInfo ||
+					!vm ||
+					!vm->CreateArray(*typeInfo, static_cast<std::uint32_t>(size), out) ||
+					!out) {
+					return false;
+				}
+
+				array_sink sink{ *out };
+				if constexpr (std::is_lvalue_reference_v<R> || array_view<T>) {
+					for (auto&& elem : a_range) {
+						*sink++ = std::forward<decltype(elem)>(elem);
+					}
+				} else {
+					for (auto& elem : a_range) {
+						*sink++ = std::move(elem);
+					}
+				}
+				assert(sink.remaining() == 0);
+
+				a_var = std::move(out);
+				return true;
+			}();
+
+			if (!success) {
+				assert(false);
+				F4SE::log::error("failed to pack array"sv);
+				a_var = nullptr;
+			}
+		}
+	}
+
 	template <detail::object T>
 	void PackVariable(Variable& a_var, const volatile T* a_val)
 	{
@@ -643,40 +910,14 @@ namespace RE::BSScript
 	void PackVariable(Variable& a_var, T&& a_val)  //
 		requires(detail::array<std::remove_reference_t<T>>)
 	{
-		using value_type = detail::decay_t<typename std::remove_cvref_t<T>::value_type>;
-		using reference_type =
-			std::conditional_t<
-				std::is_lvalue_reference_v<T>,
-				typename std::remove_cvref_t<T>::value_type&,
-				typename std::remove_cvref_t<T>::value_type&&>;
-
-		const auto success = [&]() {
-			const auto game = GameVM::GetSingleton();
-			const auto vm = game ? game->GetVM() : nullptr;
-			const auto typeInfo = GetTypeInfo<std::remove_cvref_t<T>>();
-			const auto size = a_val.size();
-			BSTSmartPointer<Array> out;
-			if (!typeInfo ||
-				!vm ||
-				!vm->CreateArray(*typeInfo, static_cast<std::uint32_t>(size), out) ||
-				!out) {
-				return false;
-			}
-
-			std::uint32_t i = 0;
-			for (auto&& elem : std::forward<T>(a_val)) {
-				detail::PackVariable(out->elements[i++], static_cast<reference_type>(elem));
-			}
-
-			a_var = std::move(out);
-			return true;
-		}();
+		detail::PackArray<std::remove_cvref_t<T>>(a_var, std::forward<T>(a_val));
+	}
 
-		if (!success) {
-			assert(false);
-			F4SE::log::error("failed to pack array"sv);
-			a_var = nullptr;
-		}
+	template <class T>
+	void PackVariable(Variable& a_var, T&& a_val)  //
+		requires(detail::array_view<std::remove_cvref_t<T>>)
+	{
+		detail::PackArray<std::remove_cvref_t<T>>(a_var, std::forward<T>(a_val));
 	}
 
 	template <class T>
@@ -986,8 +1227,11 @@ namespace RE::BSScript
 			// Must be one of:
 			//	* `void`
 			//	* A valid parameter type
+			//	* A sized view, such as `std::span`, whose value type is a valid parameter type
 			if constexpr (std::same_as<T, void>) {
 				return true;
+			} else if constexpr (detail::array_view<T>) {
+				return ValidateParameter<std::ranges::range_value_t<T>>();
 			} else {
 				return ValidateParameter<T>();
 			}
@@ -1005,7 +1249,7 @@ namespace RE::BSScript
 			std::uint32_t a_stackID,
 			const StackFrame& a_stackFrame,
 			Stack& a_stack,
-			const std::function<F>& a_callback,
+			const F& a_callback,
 			std::index_sequence<I...>)
 		{
 			const auto self = [&]() -> S {
@@ -1054,6 +1298,49 @@ namespace RE::BSScript
 					args(std::in_place_type_t<Args>{}, I)...);
 			}
 		}
+
+		template <
+			bool LONG,
+			class R,
+			class S,
+			class... Args,
+			class F>
+		bool MarshallAndDispatch(
+			const F& a_callback,
+			Variable& a_self,
+			Internal::VirtualMachine& a_vm,
+			std::uint32_t a_stackID,
+			Variable& a_retVal,
+			const StackFrame& a_stackFrame)
+		{
+			a_retVal = nullptr;
+
+			const auto stack = a_stackFrame.parent;
+			if (!stack) {
+				assert(false);
+				F4SE::log::error("native function called without relevant stack"sv);
+				return false;
+			}
+
+			const auto invoke = [&]() {
+				return DispatchHelper<LONG, S, Args...>(
+					a_self,
+					a_vm,
+					a_stackID,
+					a_stackFrame,
+					*stack,
+					a_callback,
+					std::index_sequence_for<Args...>{});
+			};
+
+			if constexpr (!std::same_as<R, void>) {
+				BSScript::PackVariable(a_retVal, invoke());
+			} else {
+				invoke();
+			}
+
+			return true;
+		}
 	}
 
 	template <
@@ -1098,33 +1385,7 @@ namespace RE::BSScript
 
 		bool MarshallAndDispatch(Variable& a_self, Internal::VirtualMachine& a_vm, std::uint32_t a_stackID, Variable& a_retVal, const StackFrame& a_stackFrame) const override  // 16
 		{
-			a_retVal = nullptr;
-
-			const auto stack = a_stackFrame.parent;
-			if (!stack) {
-				assert(false);
-				F4SE::log::error("native function called without relevant stack"sv);
-				return false;
-			}
-
-			const auto invoke = [&]() {
-				return detail::DispatchHelper<LONG, S, Args...>(
-					a_self,
-					a_vm,
-					a_stackID,
-					a_stackFrame,
-					*stack,
-					_stub,
-					std::index_sequence_for<Args...>{});
-			};
-
-			if constexpr (!std::same_as<R, void>) {
-				PackVariable(a_retVal, invoke());
-			} else {
-				invoke();
-			}
-
-			return true;
+			return detail::MarshallAndDispatch<LONG, R, S, Args...>(_stub, a_self, a_vm, a_stackID, a_retVal, a_stackFrame);
 		}
 
 	private:
@@ -1155,6 +1416,116 @@ namespace RE::BSScript
 			S,
 			Args...>;
 
+	// binds a function known at compile time, either a function pointer or a captureless lambda, which is
+	// called directly rather than through a std::function
+	template <
+		auto Func,
+		bool LONG,
+		class R,
+		class S,
+		class... Args>
+	class NativeThunk :
+		public NF_util::NativeFunctionBase
+	{
+	private:
+		using super = NF_util::NativeFunctionBase;
+
+	public:
+		static_assert(detail::valid_self<S>, "invalid self type");
+
+		static_assert(detail::ValidateReturn<R>());
+		static_assert(((detail::ValidateParameter<Args>(), ...), true));
+
+		NativeThunk(std::string_view a_object, std::string_view a_function, bool a_isLatent) :
+			super(a_object, a_function, sizeof...(Args), detail::static_tag<S>, a_isLatent)
+		{
+			assert(super::descTable.paramCount == sizeof...(Args));
+			std::size_t i = 0;
+			((super::descTable.entries[i++].second = GetTypeInfo<detail::decay_t<Args>>().value_or(nullptr)), ...);
+			super::retType = GetTypeInfo<detail::decay_t<R>>().value_or(nullptr);
+		}
+
+		// override (NF_util::NativeFunctionBase)
+		bool HasStub() const override { return true; }  // 15
+
+		bool MarshallAndDispatch(Variable& a_self, Internal::VirtualMachine& a_vm, std::uint32_t a_stackID, Variable& a_retVal, const StackFrame& a_stackFrame) const override  // 16
+		{
+			return detail::MarshallAndDispatch<LONG, R, S, Args...>(Func, a_self, a_vm, a_stackID, a_retVal, a_stackFrame);
+		}
+	};
+
+	namespace detail
+	{
+		template <class>
+		struct native_signature;
+
+		template <class R, class... Args>
+		struct native_signature<R (*)(Args...)>
+		{
+			using type = R(Args...);
+		};
+
+		template <class R, class... Args>
+		struct native_signature<R (*)(Args...) noexcept> :
+			native_signature<R (*)(Args...)>
+		{};
+
+		template <class C, class R, class... Args>
+		struct native_signature<R (C::*)(Args...) const>
+		{
+			using type = R(Args...);
+		};
+
+		template <class C, class R, class... Args>
+		struct native_signature<R (C::*)(Args...) const noexcept> :
+			native_signature<R (C::*)(Args...) const>
+		{};
+
+		template <class F>
+			requires(std::is_class_v<F>)
+		struct native_signature<F> :
+			native_signature<decltype(&F::operator())>
+		{};
+
+		template <auto Func, class = typename native_signature<std::remove_cv_t<decltype(Func)>>::type>
+		struct native_thunk;
+
+		template <auto Func, class R, class S, class... Args>
+		struct native_thunk<Func, R(S, Args...)>
+		{
+			using type = NativeThunk<Func, false, R, S, Args...>;
+		};
+
+		template <auto Func, class R, class S, class... Args>
+		struct native_thunk<Func, R(IVirtualMachine&, std::uint32_t, S, Args...)>
+		{
+			using type = NativeThunk<Func, true, R, S, Args...>;
+		};
+
+		inline void BindNativeFunction(
+			IVirtualMachine& a_vm,
+			IFunction* a_function,
+			std::string_view a_object,
+			std::string_view a_name,
+			std::optional<bool> a_taskletCallable)
+		{
+			const auto success = a_vm.BindNativeMethod(a_function);
+			if (!success) {
+				F4SE::log::warn(
+					FMT_STRING("failed to register method \"{}\" on object \"{}\""),
+					a_name,
+					a_object);
+			}
+
+			if (success && a_taskletCallable) {
+				a_vm.SetCallableFromTasklets(a_object.data(), a_name.data(), *a_taskletCallable);
+			}
+		}
+	}
+
+	template <auto Func>
+	using native_thunk_t = typename detail::native_thunk<Func>::type;
+
 	template <class F>
 	void IVirtualMachine::BindNativeMethod(
 		stl::zstring a_object,
@@ -1163,21 +1534,33 @@ namespace RE::BSScript
 		std::optional<bool> a_taskletCallable,
 		bool a_isLatent)
 	{
-		const auto success =
-			BindNativeMethod(new NativeFunction(
+		detail::BindNativeFunction(
+			*this,
+			new NativeFunction(
 				a_object,
 				a_function,
 				std::move(a_func),
-				a_isLatent));
-		if (!success) {
-			F4SE::log::warn(
-				FMT_STRING("failed to register method \"{}\" on object \"{}\""),
-				a_function,
-				a_object);
-		}
+				a_isLatent),
+			a_object,
+			a_function,
+			a_taskletCallable);
+	}
 
-		if (success && a_taskletCallable) {
-			SetCallableFromTasklets(a_object.data(), a_function.data(), *a_taskletCallable);
-		}
+	template <auto F>
+	void IVirtualMachine::BindNativeMethod(
+		stl::zstring a_object,
+		stl::zstring a_function,
+		std::optional<bool> a_taskletCallable,
+		bool a_isLatent)
+	{
+		detail::BindNativeFunction(
+			*this,
+			new native_thunk_t<F>(
+				a_object,
+				a_function,
+				a_isLatent),
+			a_object,
+			a_function,
+			a_taskletCallable);
 	}
 }
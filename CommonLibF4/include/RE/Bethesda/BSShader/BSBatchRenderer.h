@@ -110,21 +110,21 @@ namespace RE
 		static bool BeginPass(std::uint32_t aTechnique, BSShader* aShader)
 		{
 			using func_t = decltype(&BSBatchRenderer::BeginPass);
-			REL::Relocation<func_t> func{ REL::ID(1519438) };
+			static REL::Relocation<func_t> func{ REL::ID(1519438) };
 			return func(aTechnique, aShader);
 		}
 
 		static bool RenderPassImmediately(BSRenderPass* aPass, std::uint32_t aTechnique, bool alpha)
 		{
 			using func_t = decltype(&BSBatchRenderer::RenderPassImmediately);
-			REL::Relocation<func_t> func{ REL::ID(244233) };
+			static REL::Relocation<func_t> func{ REL::ID(244233) };
 			return func(aPass, aTechnique, alpha);
 		}
 
 		static void EndPass()
 		{
 			using func_t = decltype(&BSBatchRenderer::EndPass);
-			REL::Relocation<func_t> func{ REL::ID(15937) };
+			static REL::Relocation<func_t> func{ REL::ID(15937) };
 			return func();
 		}
 
@@ -19,7 +19,7 @@ namespace RE
 		static BSDistantObjectInstanceRenderer& QInstance()
 		{
 			using func_t = decltype(&BSDistantObjectInstanceRenderer::QInstance);
-			REL::Relocation<func_t> func{ REL::ID(1094113) };
+			static REL::Relocation<func_t> func{ REL::ID(1094113) };
 			return func();
 		}
 
@@ -14,27 +14,27 @@ namespace RE
 		BSRenderPass()
 		{
 			typedef BSRenderPass* func_t(BSRenderPass*);
-			REL::Relocation<func_t> func{ REL::ID(1309529) };
+			static REL::Relocation<func_t> func{ REL::ID(1309529) };
 			func(this);
 		}
 		BSRenderPass(BSShader* aShader, BSShaderProperty* aProperty, BSGeometry* aGeom, std::uint32_t passEnum, std::uint8_t numLights, BSLight** lights)
 		{
 			typedef BSRenderPass* func_t(BSRenderPass*, BSShader*, BSShaderProperty*, BSGeometry*, std::uint32_t, std::uint8_t, BSLight**);
-			REL::Relocation<func_t> func{ REL::ID(1482704) };
+			static REL::Relocation<func_t> func{ REL::ID(1482704) };
 			func(this, aShader, aProperty, aGeom, passEnum, numLights, lights);
 		}
 
 		~BSRenderPass()
 		{
 			typedef void* func_t(BSRenderPass*);
-			REL::Relocation<func_t> func{ REL::ID(1514864) };
+			static REL::Relocation<func_t> func{ REL::ID(1514864) };
 			func(this);
 		}
 
 		[[nodiscard]] void* operator new(std::size_t a_count)
 		{
 			typedef void* func_t(std::size_t);
-			REL::Relocation<func_t> func{ REL::ID(657126) };
+			static REL::Relocation<func_t> func{ REL::ID(657126) };
 
 			const auto mem = func(a_count);
 			if (mem) {
@@ -47,7 +47,7 @@ namespace RE
 		[[nodiscard]] void* operator new[](std::size_t a_count)
 		{
 			typedef void* func_t(std::size_t);
-			REL::Relocation<func_t> func{ REL::ID(657126) };
+			static REL::Relocation<func_t> func{ REL::ID(657126) };
 
 			const auto mem = func(a_count);
 			if (mem) {
@@ -60,25 +60,25 @@ namespace RE
 		void operator delete(void* a_ptr)
 		{
 			typedef void func_t(void*, std::uint64_t);
-			REL::Relocation<func_t> func{ REL::ID(1268435) };
+			static REL::Relocation<func_t> func{ REL::ID(1268435) };
 			func(a_ptr, 0x58);
 		}
 		void operator delete[](void* a_ptr)
 		{
 			typedef void func_t(void*, std::uint64_t);
-			REL::Relocation<func_t> func{ REL::ID(1268435) };
+			static REL::Relocation<func_t> func{ REL::ID(1268435) };
 			func(a_ptr, 0x58);
 		}
 		void operator delete(void* a_ptr, std::size_t)
 		{
 			typedef void func_t(void*, std::uint64_t);
-			REL::Relocation<func_t> func{ REL::ID(1268435) };
+			static REL::Relocation<func_t> func{ REL::ID(1268435) };
 			func(a_ptr, 0x58);
 		}
 		void operator delete[](void* a_ptr, std::size_t)
 		{
 			typedef void func_t(void*, std::uint64_t);
-			REL::Relocation<func_t> func{ REL::ID(1268435) };
+			static REL::Relocation<func_t> func{ REL::ID(1268435) };
 			func(a_ptr, 0x58);
 		}
 
@@ -133,7 +133,7 @@ namespace RE
 
 		static BSShaderResourceManager &GetInstance()
 		{
-			REL::Relocation<BSShaderResourceManager*> singleton{ REL::ID(1416967) };
+			static REL::Relocation<BSShaderResourceManager*> singleton{ REL::ID(1416967) };
 			return *singleton;
 		}
 	};
@@ -33,48 +33,48 @@ namespace RE
 		void ClearActivePasses(bool clearLists)
 		{
 			using func_t = decltype(&BSShaderAccumulator::ClearActivePasses);
-			REL::Relocation<func_t> func{ REL::ID(596187) };
+			static REL::Relocation<func_t> func{ REL::ID(596187) };
 			return func(this, clearLists);
 		}
 
 		void ClearEffectPasses()
 		{
 			using func_t = decltype(&BSShaderAccumulator::ClearEffectPasses);
-			REL::Relocation<func_t> func{ REL::ID(1407520) };
+			static REL::Relocation<func_t> func{ REL::ID(1407520) };
 			return func(this);
 		}
 
 		void ClearGroupPasses(std::int32_t geomGroup, bool freePasses)
 		{
 			using func_t = decltype(&BSShaderAccumulator::ClearGroupPasses);
-			REL::Relocation<func_t> func{ REL::ID(226148) };
+			static REL::Relocation<func_t> func{ REL::ID(226148) };
 			return func(this, geomGroup, freePasses);
 		}
 
 		static bool RegisterObject_Standard(BSShaderAccumulator* a_accumulator, BSGeometry* a_geometry, BSShaderProperty* a_property) {
 			using func_t = decltype(&BSShaderAccumulator::RegisterObject_Standard);
-			REL::Relocation<func_t> func{ REL::ID(289935) };
+			static REL::Relocation<func_t> func{ REL::ID(289935) };
 			return func(a_accumulator, a_geometry, a_property);
 		}
 
 		void RenderBatches(std::int32_t passIndex, bool alpha, std::int32_t geometryGroup)
 		{
 			using func_t = decltype(&BSShaderAccumulator::RenderBatches);
-			REL::Relocation<func_t> func{ REL::ID(1048494) };
+			static REL::Relocation<func_t> func{ REL::ID(1048494) };
 			return func(this, passIndex, alpha, geometryGroup);
 		}
 
 		void RenderBlendedDecals()
 		{
 			using func_t = decltype(&BSShaderAccumulator::RenderBlendedDecals);
-			REL::Relocation<func_t> func{ REL::ID(761249) };
+			static REL::Relocation<func_t> func{ REL::ID(761249) };
 			return func(this);
 		}
 
 		void RenderOpaqueDecals()
 		{
 			using func_t = decltype(&BSShaderAccumulator::RenderOpaqueDecals);
-			REL::Relocation<func_t> func{ REL::ID(163409) };
+			static REL::Relocation<func_t> func{ REL::ID(163409) };
 			return func(this);
 		}
 
@@ -113,7 +113,7 @@ namespace RE
 		BSShaderAccumulator* ctor()
 		{
 			using func_t = decltype(&BSShaderAccumulator::ctor);
-			REL::Relocation<func_t> func{ REL::ID(690952) };
+			static REL::Relocation<func_t> func{ REL::ID(690952) };
 			return func(this);
 		}
 	};
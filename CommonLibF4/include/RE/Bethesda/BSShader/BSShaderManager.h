@@ -32,7 +32,7 @@ namespace RE
 
 		static NiCamera* GetCamera()
 		{
-			REL::Relocation<NiCamera**> singleton{ REL::ID(543218) };
+			static REL::Relocation<NiCamera**> singleton{ REL::ID(543218) };
 			return *singleton;
 		}
 
@@ -43,13 +43,13 @@ namespace RE
 
 		static NiCamera* GetMainCamera()
 		{
-			REL::Relocation<NiPointer<NiCamera>*> singleton{ REL::ID(175576) };
+			static REL::Relocation<NiPointer<NiCamera>*> singleton{ REL::ID(175576) };
 			return singleton.get()->get();
 		}
 
 		static NiPointer<NiCamera>& GetMainCameraPtr()
 		{
-			REL::Relocation<NiPointer<NiCamera>*> singleton{ REL::ID(175576) };
+			static REL::Relocation<NiPointer<NiCamera>*> singleton{ REL::ID(175576) };
 			return *singleton;
 		}
 
@@ -85,7 +85,7 @@ namespace RE
 		static BSShader* GetShader(std::uint32_t shaderIndex)
 		{
 			using func_t = decltype(&BSShaderManager::GetShader);
-			REL::Relocation<func_t> func{ REL::ID(918107) };
+			static REL::Relocation<func_t> func{ REL::ID(918107) };
 			return func(shaderIndex);
 		}
 
@@ -252,7 +252,7 @@ namespace RE
 		public:
 			[[nodiscard]] static State& GetSingleton()
 			{
-				REL::Relocation<State*> singleton{ REL::ID(1327069) };
+				static REL::Relocation<State*> singleton{ REL::ID(1327069) };
 				return *singleton;
 			}
 
@@ -379,7 +379,7 @@ namespace RE
 		static void GetTexture(const char* filepath, bool demandTex, NiPointer<NiTexture>& returnTex, bool environmentMap, bool normalMap, bool a6)
 		{
 			using func_t = decltype(&BSShaderManager::GetTexture);
-			REL::Relocation<func_t> func{ REL::ID(1375091) };
+			static REL::Relocation<func_t> func{ REL::ID(1375091) };
 			return func(filepath, demandTex, returnTex, environmentMap, normalMap, a6);
 		}
 
@@ -436,14 +436,14 @@ namespace RE
 		static void RegisterShaderLoader(const char* a_name, BSReloadShaderI* a_shader)
 		{
 			using func_t = decltype(&BSShaderManager::RegisterShaderLoader);
-			REL::Relocation<func_t> func{ REL::ID(1569773) };
+			static REL::Relocation<func_t> func{ REL::ID(1569773) };
 			return func(a_name, a_shader);
 		}
 
 		static void UnregisterShaderLoader(const char* a_name)
 		{
 			using func_t = decltype(&BSShaderManager::UnregisterShaderLoader);
-			REL::Relocation<func_t> func{ REL::ID(425866) };
+			static REL::Relocation<func_t> func{ REL::ID(425866) };
 			return func(a_name);
 		}
 		
@@ -452,14 +452,14 @@ namespace RE
 		static BSShaderAccumulator* GetCurrentAccumulator()
 		{
 			using func_t = decltype(&BSShaderManager::GetCurrentAccumulator);
-			REL::Relocation<func_t> func{ REL::ID(1555929) };
+			static REL::Relocation<func_t> func{ REL::ID(1555929) };
 			return func();
 		}
 
 		static void SetCurrentAccumulator(BSShaderAccumulator* a_accumulator)
 		{
 			using func_t = decltype(&BSShaderManager::SetCurrentAccumulator);
-			REL::Relocation<func_t> func{ REL::ID(412086) };
+			static REL::Relocation<func_t> func{ REL::ID(412086) };
 			return func(a_accumulator);
 		}
 		//...
@@ -480,7 +480,7 @@ namespace RE
 
 		static BSTHashMap<BSFixedString, BSReloadShaderI*>& GetShaderLoaderMap()
 		{
-			REL::Relocation<BSTHashMap<BSFixedString, BSReloadShaderI*>*> ShaderLoaderMap{ REL::ID(637314), 0x8 };
+			static REL::Relocation<BSTHashMap<BSFixedString, BSReloadShaderI*>*> ShaderLoaderMap{ REL::ID(637314), 0x8 };
 			return *ShaderLoaderMap;
 		}
 
@@ -40,7 +40,7 @@ namespace RE
 
 		static BSShaderMaterial* GetDefaultMaterial()
 		{
-			REL::Relocation<BSShaderMaterial**> singleton{ REL::ID(95118) };
+			static REL::Relocation<BSShaderMaterial**> singleton{ REL::ID(95118) };
 			return *singleton;
 		}
 
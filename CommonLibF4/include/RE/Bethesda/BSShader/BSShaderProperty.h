@@ -201,21 +201,21 @@ namespace RE
 		void ClearRenderPasses()
 		{
 			using func_t = decltype(&BSShaderProperty::ClearRenderPasses);
-			REL::Relocation<func_t> func{ REL::ID(1065016) };
+			static REL::Relocation<func_t> func{ REL::ID(1065016) };
 			return func(this);
 		}
 
 		void SetMaterial(BSShaderMaterial* a_material, bool a1)
 		{
 			using func_t = decltype(&BSShaderProperty::SetMaterial);
-			REL::Relocation<func_t> func{ REL::ID(706318) };
+			static REL::Relocation<func_t> func{ REL::ID(706318) };
 			return func(this, a_material, a1);
 		}
 
 		void SetEffectShaderData(BSEffectShaderData* shaderData)
 		{
 			using func_t = decltype(&BSShaderProperty::SetEffectShaderData);
-			REL::Relocation<func_t> func{ REL::ID(19696) };
+			static REL::Relocation<func_t> func{ REL::ID(19696) };
 			return func(this, shaderData);
 		}
 
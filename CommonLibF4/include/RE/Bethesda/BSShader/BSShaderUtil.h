@@ -33,14 +33,14 @@ namespace RE
 		static void AccumulateScene(NiCamera* a_camera, NiAVObject* a_object, BSCullingProcess& a_cullingprocess, bool a1)
 		{
 			using func_t = decltype(&BSShaderUtil::AccumulateScene);
-			REL::Relocation<func_t> func{ REL::ID(1551978) };
+			static REL::Relocation<func_t> func{ REL::ID(1551978) };
 			return func(a_camera, a_object, a_cullingprocess, a1);
 		}
 
 		static void AccumulateSceneArray(NiCamera* a_camera, BSTArray<NiPointer<NiAVObject>>* a_objects, BSCullingProcess& a_cullingprocess, bool a1)
 		{
 			using func_t = decltype(&BSShaderUtil::AccumulateSceneArray);
-			REL::Relocation<func_t> func{ REL::ID(899120) };
+			static REL::Relocation<func_t> func{ REL::ID(899120) };
 			return func(a_camera, a_objects, a_cullingprocess, a1);
 		}
 
@@ -49,7 +49,7 @@ namespace RE
 		static void RenderScene(NiCamera* a_camera, BSShaderAccumulator* a_accumulator, bool a1)
 		{
 			using func_t = decltype(&BSShaderUtil::RenderScene);
-			REL::Relocation<func_t> func{ REL::ID(1310228) };
+			static REL::Relocation<func_t> func{ REL::ID(1310228) };
 			return func(a_camera, a_accumulator, a1);
 		}
 
@@ -66,7 +66,7 @@ namespace RE
 		static void SetTexturesCanDegrade(NiAVObject* a_object, bool a_degrade)
 		{
 			using func_t = decltype(&BSShaderUtil::SetTexturesCanDegrade);
-			REL::Relocation<func_t> func{ REL::ID(1432487) };
+			static REL::Relocation<func_t> func{ REL::ID(1432487) };
 			return func(a_object, a_degrade);
 		}
 
@@ -90,21 +90,21 @@ namespace RE
 		static void ClearRenderPasses(NiAVObject* a_object)
 		{
 			using func_t = decltype(&BSShaderUtil::ClearRenderPasses);
-			REL::Relocation<func_t> func{ REL::ID(613616) };
+			static REL::Relocation<func_t> func{ REL::ID(613616) };
 			return func(a_object);
 		}
 
 		static void SetSceneGraphCameraFOV(BSSceneGraph* a_scene, float a_FOV, bool a3, NiCamera* a_camera, bool includeLOD)
 		{
 			using func_t = decltype(&BSShaderUtil::SetSceneGraphCameraFOV);
-			REL::Relocation<func_t> func{ REL::ID(1491349) };
+			static REL::Relocation<func_t> func{ REL::ID(1491349) };
 			return func(a_scene, a_FOV, a3, a_camera, includeLOD);
 		}
 
 		static void SetCameraFOV(NiCamera* a_camera, float a_FOV, float f_far, float f_near)
 		{
 			using func_t = decltype(&BSShaderUtil::SetCameraFOV);
-			REL::Relocation<func_t> func{ REL::ID(1463640) };
+			static REL::Relocation<func_t> func{ REL::ID(1463640) };
 			return func(a_camera, a_FOV, f_far, f_near);
 		}
 
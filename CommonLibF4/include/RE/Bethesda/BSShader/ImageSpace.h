@@ -35,7 +35,7 @@ namespace RE
 		ImageSpaceEffectParam()
 		{
 			typedef ImageSpaceEffectParam* func_t(ImageSpaceEffectParam*);
-			REL::Relocation<func_t> func{ REL::ID(1464304) };
+			static REL::Relocation<func_t> func{ REL::ID(1464304) };
 			func(this);
 		}
 
@@ -72,7 +72,7 @@ namespace RE
 		ImageSpaceEffect()
 		{
 			typedef ImageSpaceEffect* func_t(ImageSpaceEffect*);
-			REL::Relocation<func_t> func{ REL::ID(343213) };
+			static REL::Relocation<func_t> func{ REL::ID(343213) };
 			func(this);
 		}
 
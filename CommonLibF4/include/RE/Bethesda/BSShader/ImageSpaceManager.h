@@ -20,7 +20,7 @@ namespace RE
 
 		static ImageSpaceManager* GetSingleton()
 		{
-			REL::Relocation<ImageSpaceManager**> singleton{ REL::ID(161743) };
+			static REL::Relocation<ImageSpaceManager**> singleton{ REL::ID(161743) };
 			return *singleton;
 		}
 
@@ -231,70 +231,70 @@ namespace RE
 		ImageSpaceEffect* GetEffect(ImageSpaceEffectEnum a_effect)
 		{
 			using func_t = decltype(&ImageSpaceManager::GetEffect);
-			REL::Relocation<func_t> func{ REL::ID(697019), 0x30 };
+			static REL::Relocation<func_t> func{ REL::ID(697019), 0x30 };
 			return func(this, a_effect);
 		}
 
 		void RenderEffect_1(ImageSpaceEffectEnum a_effect, std::uint32_t a_target, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffect_1);
-			REL::Relocation<func_t> func{ REL::ID(778043) };
+			static REL::Relocation<func_t> func{ REL::ID(778043) };
 			return func(this, a_effect, a_target, a_param);
 		}
 
 		void RenderEffect_2(ImageSpaceEffect* a_effect, std::uint32_t a_target1, std::uint32_t a_target2, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffect_2);
-			REL::Relocation<func_t> func{ REL::ID(325252) };
+			static REL::Relocation<func_t> func{ REL::ID(325252) };
 			return func(this, a_effect, a_target1, a_target2, a_param);
 		}
 
 		void RenderEffect_3(ImageSpaceEffect* a_effect, std::uint32_t a_target1, std::uint32_t a_target2, std::uint32_t a_target3, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffect_3);
-			REL::Relocation<func_t> func{ REL::ID(922938) };
+			static REL::Relocation<func_t> func{ REL::ID(922938) };
 			return func(this, a_effect, a_target1, a_target2, a_target3, a_param);
 		}
 
 		void RenderEffectHelper_2(ImageSpaceEffectEnum a_effect, std::uint32_t a_target1, std::uint32_t a_target2, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffectHelper_2);
-			REL::Relocation<func_t> func{ REL::ID(1309722) };
+			static REL::Relocation<func_t> func{ REL::ID(1309722) };
 			return func(this, a_effect, a_target1, a_target2, a_param);
 		}
 
 		void RenderEffect_Tex_1(ImageSpaceEffect* a_effect, NiTexture* a_texture, std::uint32_t a_target, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffect_Tex_1);
-			REL::Relocation<func_t> func{ REL::ID(788799) };
+			static REL::Relocation<func_t> func{ REL::ID(788799) };
 			return func(this, a_effect, a_texture, a_target, a_param);
 		}
 
 		void RenderEffect_Tex_2(ImageSpaceEffectEnum a_effect, NiTexture* a_texture1, NiTexture* a_texture2, std::uint32_t a_target, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffect_Tex_2);
-			REL::Relocation<func_t> func{ REL::ID(1161595) };
+			static REL::Relocation<func_t> func{ REL::ID(1161595) };
 			return func(this, a_effect, a_texture1, a_texture2, a_target, a_param);
 		}
 
 		void RenderEffectHelper_Tex_1(ImageSpaceEffectEnum a_effect, NiTexture* a_texture, std::uint32_t a_target, ImageSpaceEffectParam* a_param)
 		{
 			using func_t = decltype(&ImageSpaceManager::RenderEffectHelper_Tex_1);
-			REL::Relocation<func_t> func{ REL::ID(111275) };
+			static REL::Relocation<func_t> func{ REL::ID(111275) };
 			return func(this, a_effect, a_texture, a_target, a_param);
 		}
 
 		BSTriShape* CreatePartialScreenGeometry(std::uint32_t width, std::uint32_t height)
 		{
 			using func_t = decltype(&ImageSpaceManager::CreatePartialScreenGeometry);
-			REL::Relocation<func_t> func{ REL::ID(1103472) };
+			static REL::Relocation<func_t> func{ REL::ID(1103472) };
 			return func(this, width, height);
 		}
 
 		NiPointer<BSTriShape>& SelectScreenShape(ImageSpaceEffect* a_effect)
 		{
 			using func_t = decltype(&ImageSpaceManager::SelectScreenShape);
-			REL::Relocation<func_t> func{ REL::ID(522068), -0xB };
+			static REL::Relocation<func_t> func{ REL::ID(522068), -0xB };
 			return func(this, a_effect);
 		}
 
@@ -22,7 +22,7 @@ namespace RE
 		ImageSpaceShaderParam()
 		{
 			typedef ImageSpaceShaderParam* func_t(ImageSpaceShaderParam*);
-			REL::Relocation<func_t> func{ REL::ID(109702) };
+			static REL::Relocation<func_t> func{ REL::ID(109702) };
 			func(this);
 		}
 
@@ -31,14 +31,14 @@ namespace RE
 		void ResizeConstantGroup(std::uint32_t a1, std::uint32_t a2)
 		{
 			using func_t = decltype(&ImageSpaceShaderParam::ResizeConstantGroup);
-			REL::Relocation<func_t> func{ REL::ID(707810) };
+			static REL::Relocation<func_t> func{ REL::ID(707810) };
 			return func(this, a1, a2);
 		}
 
 		void SetPixelConstant(std::uint32_t a1, float a2, float a3, float a4, float a5)
 		{
 			using func_t = decltype(&ImageSpaceShaderParam::SetPixelConstant);
-			REL::Relocation<func_t> func{ REL::ID(959652) };
+			static REL::Relocation<func_t> func{ REL::ID(959652) };
 			return func(this, a1, a2, a3, a4, a5);
 		}
 
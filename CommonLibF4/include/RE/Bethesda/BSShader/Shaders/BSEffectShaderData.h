@@ -48,7 +48,7 @@ namespace RE
 		BSEffectShaderData* ctor()
 		{
 			using func_t = decltype(&BSEffectShaderData::ctor);
-			REL::Relocation<func_t> func{ REL::ID(796946) };
+			static REL::Relocation<func_t> func{ REL::ID(796946) };
 			return func(this);
 		}
 	};
@@ -20,7 +20,7 @@ namespace RE
 
 		static BSEffectShaderMaterial* GetDefaultMaterial()
 		{
-			REL::Relocation<BSEffectShaderMaterial**> singleton{ REL::ID(1415090) };
+			static REL::Relocation<BSEffectShaderMaterial**> singleton{ REL::ID(1415090) };
 			return *singleton;
 		}
 
@@ -16,42 +16,42 @@ namespace RE
 		NiTexture* GetBaseTexture()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::GetBaseTexture);
-			REL::Relocation<func_t> func{ REL::ID(1334794) };
+			static REL::Relocation<func_t> func{ REL::ID(1334794) };
 			return func(this);
 		}
 
 		BSEffectShaderMaterial* GetEffectShaderMaterial()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::GetEffectShaderMaterial);
-			REL::Relocation<func_t> func{ REL::ID(1096263) };
+			static REL::Relocation<func_t> func{ REL::ID(1096263) };
 			return func(this);
 		}
 
 		NiTexture* GetEnvMap()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::GetEnvMap);
-			REL::Relocation<func_t> func{ REL::ID(364155), 0x90 };
+			static REL::Relocation<func_t> func{ REL::ID(364155), 0x90 };
 			return func(this);
 		}
 
 		NiTexture* GetEnvMapMask()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::GetEnvMapMask);
-			REL::Relocation<func_t> func{ REL::ID(364155), 0xA0 };
+			static REL::Relocation<func_t> func{ REL::ID(364155), 0xA0 };
 			return func(this);
 		}
 
 		NiTexture* GetGrayscaleTexture()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::GetGrayscaleTexture);
-			REL::Relocation<func_t> func{ REL::ID(364155), 0xB0 };
+			static REL::Relocation<func_t> func{ REL::ID(364155), 0xB0 };
 			return func(this);
 		}
 
 		NiTexture* GetNormalMap()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::GetNormalMap);
-			REL::Relocation<func_t> func{ REL::ID(1321110), 0x10 };
+			static REL::Relocation<func_t> func{ REL::ID(1321110), 0x10 };
 			return func(this);
 		}
 
@@ -75,7 +75,7 @@ namespace RE
 		void SetEnvMap(NiTexture* newTex)
 		{
 			using func_t = decltype(&BSEffectShaderProperty::SetEnvMap);
-			REL::Relocation<func_t> func{ REL::ID(855637), 0x3F };
+			static REL::Relocation<func_t> func{ REL::ID(855637), 0x3F };
 			return func(this, newTex);
 		}
 
@@ -133,7 +133,7 @@ namespace RE
 		static NiObject* CreateObject()
 		{
 			using func_t = decltype(&BSEffectShaderProperty::CreateObject);
-			REL::Relocation<func_t> func{ REL::ID(373342) };
+			static REL::Relocation<func_t> func{ REL::ID(373342) };
 			return func();
 		}
 
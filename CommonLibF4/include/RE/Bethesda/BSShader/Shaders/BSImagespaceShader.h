@@ -16,7 +16,7 @@ namespace RE
 		BSImagespaceShader(const char* fxpName)
 		{
 			typedef BSImagespaceShader* func_t(BSImagespaceShader*, const char*);
-			REL::Relocation<func_t> func{ REL::ID(103011) };
+			static REL::Relocation<func_t> func{ REL::ID(103011) };
 			func(this, fxpName);
 		}
 
@@ -24,13 +24,13 @@ namespace RE
 
 		static ImageSpaceShaderParam& GetDefaultParam()
 		{
-			REL::Relocation<ImageSpaceShaderParam*> singleton{ REL::ID(455011) };
+			static REL::Relocation<ImageSpaceShaderParam*> singleton{ REL::ID(455011) };
 			return *singleton;
 		}
 
 		static ImageSpaceShaderParam* GetCurrentParam()
 		{
-			REL::Relocation<ImageSpaceShaderParam**> singleton{ REL::ID(16045) };
+			static REL::Relocation<ImageSpaceShaderParam**> singleton{ REL::ID(16045) };
 			return *singleton;
 		}
 
@@ -19,7 +19,7 @@ namespace RE
 
 		static BSLightingShader* GetInstance()
 		{
-			REL::Relocation<BSLightingShader**> instance{ REL::ID(482744) };
+			static REL::Relocation<BSLightingShader**> instance{ REL::ID(482744) };
 			return *instance;
 		}
 
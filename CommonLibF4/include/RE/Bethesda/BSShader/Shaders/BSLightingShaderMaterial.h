@@ -80,7 +80,7 @@ namespace RE
 
 		static BSLightingShaderMaterialBase* GetDefaultMaterial()
 		{
-			REL::Relocation<BSLightingShaderMaterialBase**> singleton{ REL::ID(1060450) };
+			static REL::Relocation<BSLightingShaderMaterialBase**> singleton{ REL::ID(1060450) };
 			return *singleton;
 		}
 
@@ -15,41 +15,41 @@ namespace RE
 		NiTexture* GetBaseTexture()
 		{
 			using func_t = decltype(&BSLightingShaderProperty::GetBaseTexture);
-			REL::Relocation<func_t> func{ REL::ID(1242168) };
+			static REL::Relocation<func_t> func{ REL::ID(1242168) };
 			return func(this);
 		}
 
 		BSLightingShaderMaterialBase* GetLightingShaderMaterial()
 		{
 			using func_t = decltype(&BSLightingShaderProperty::GetLightingShaderMaterial);
-			REL::Relocation<func_t> func{ REL::ID(958611) };
+			static REL::Relocation<func_t> func{ REL::ID(958611) };
 			return func(this);
 		}
 
 		NiTexture* GetNormalTexture()
 		{
 			using func_t = decltype(&BSLightingShaderProperty::GetNormalTexture);
-			REL::Relocation<func_t> func{ REL::ID(407460), 0x57 };
+			static REL::Relocation<func_t> func{ REL::ID(407460), 0x57 };
 			return func(this);
 		}
 
 		void SetDiffuseTexture(NiTexture* newTex) {
 			using func_t = decltype(&BSLightingShaderProperty::SetDiffuseTexture);
-			REL::Relocation<func_t> func{ REL::ID(61252) };
+			static REL::Relocation<func_t> func{ REL::ID(61252) };
 			return func(this, newTex);
 		}
 
 		void SetNormalTexture(NiTexture* newTex)
 		{
 			using func_t = decltype(&BSLightingShaderProperty::SetNormalTexture);
-			REL::Relocation<func_t> func{ REL::ID(760865), 0xB };
+			static REL::Relocation<func_t> func{ REL::ID(760865), 0xB };
 			return func(this, newTex);
 		}
 
 		static NiObject* CreateObject()
 		{
 			using func_t = decltype(&BSLightingShaderProperty::CreateObject);
-			REL::Relocation<func_t> func{ REL::ID(1120904) };
+			static REL::Relocation<func_t> func{ REL::ID(1120904) };
 			return func();
 		}
 
@@ -215,6 +215,40 @@ namespace RE
 	using BSFixedStringW = detail::BSFixedString<wchar_t, false>;
 	using BSFixedStringWCS = detail::BSFixedString<wchar_t, true>;
 
+	// a string literal which goes through the pool once, the first time it is used. after that comparing
+	// it against a fixed string is a pointer compare, instead of a locked lookup for every temporary
+	template <
+		stl::nttp::string S,
+		class String = detail::BSFixedString<typename decltype(S)::char_type, false>>
+	class fixed_literal
+	{
+	public:
+		using string_type = String;
+		using value_type = typename decltype(S)::char_type;
+
+		[[nodiscard]] static constexpr std::basic_string_view<value_type> view() noexcept { return { _storage.data(), S.length() }; }
+
+		[[nodiscard]] static const string_type& get()
+		{
+			static const string_type interned{ _storage.data() };
+			return interned;
+		}
+
+		[[nodiscard]] operator const string_type&() const { return get(); }
+
+		[[nodiscard]] friend bool operator==(const fixed_literal&, const string_type& a_rhs) { return get() == a_rhs; }
+
+	private:
+		[[nodiscard]] static consteval auto make_storage() noexcept
+		{
+			std::array<value_type, S.length() + 1> result{};
+			std::copy_n(S.data(), S.length(), result.begin());
+			return result;
+		}
+
+		static constexpr auto _storage = make_storage();
+	};
+
 	namespace BSScript
 	{
 		template <class>
@@ -1,5 +1,18 @@
 #pragma once
 
+#if defined(_M_X64) || defined(__x86_64__)
+#	define RE_CRC32_CLMUL
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	endif
+#	if defined(__GNUC__) || defined(__clang__)
+#		define RE_CRC32_TARGET_CLMUL __attribute__((target("pclmul")))
+#	else
+#		define RE_CRC32_TARGET_CLMUL
+#	endif
+#endif
+
 namespace RE
 {
 	namespace InventoryInterface
@@ -9,48 +22,208 @@ namespace RE
 
 	namespace detail
 	{
+		namespace CRC32
+		{
+			static_assert(std::endian::native == std::endian::little);
+
+			inline constexpr std::uint32_t POLYNOMIAL = 0xEDB88320;
+
+			// inputs at least this long are folded with carry-less multiplies when the cpu has them
+			inline constexpr std::size_t CLMUL_THRESHOLD = 128;
+
+			// TABLES[k][i] is the crc of byte i followed by k zero bytes
+			using tables_t = std::array<std::array<std::uint32_t, 256>, 16>;
+
+			[[nodiscard]] consteval tables_t make_tables() noexcept
+			{
+				tables_t tables{};
+				for (std::uint32_t i = 0; i < 256; ++i) {
+					auto crc = i;
+					for (std::size_t j = 0; j < 8; ++j) {
+						crc = (crc >> 1) ^ ((crc & 1) != 0 ? POLYNOMIAL : 0);
+					}
+					tables[0][i] = crc;
+				}
+				for (std::size_t k = 1; k < tables.size(); ++k) {
+					for (std::size_t i = 0; i < 256; ++i) {
+						tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+					}
+				}
+				return tables;
+			}
+
+			inline constexpr auto TABLES = make_tables();
+			static_assert(TABLES[0][0x01] == 0x77073096);
+			static_assert(TABLES[0][0xFF] == 0x2D02EF8D);
+
+			[[nodiscard]] constexpr std::uint32_t update_bytes(std::uint32_t a_hash, std::span<const std::uint8_t> a_data) noexcept
+			{
+				for (const auto byte : a_data) {
+					a_hash = (a_hash >> 8) ^ TABLES[0][(a_hash ^ byte) & 0xFF];
+				}
+				return a_hash;
+			}
+
+			// the crc of four bytes, the first of which is in the low byte of a_word, k zero bytes before the end of the input
+			[[nodiscard]] constexpr std::uint32_t slice(std::size_t a_k, std::uint32_t a_word) noexcept
+			{
+				return TABLES[a_k + 3][a_word & 0xFF] ^
+				       TABLES[a_k + 2][(a_word >> 8) & 0xFF] ^
+				       TABLES[a_k + 1][(a_word >> 16) & 0xFF] ^
+				       TABLES[a_k][a_word >> 24];
+			}
+
+			[[nodiscard]] constexpr std::uint32_t hash4(std::uint32_t a_key) noexcept
+			{
+				return slice(0, a_key);
+			}
+
+			[[nodiscard]] constexpr std::uint32_t hash8(std::uint64_t a_key) noexcept
+			{
+				return slice(4, static_cast<std::uint32_t>(a_key)) ^
+				       slice(0, static_cast<std::uint32_t>(a_key >> 32));
+			}
+
+			template <class T>
+			[[nodiscard]] inline T load(const std::uint8_t* a_src) noexcept
+			{
+				T result;
+				std::memcpy(std::addressof(result), a_src, sizeof(T));
+				return result;
+			}
+
+			[[nodiscard]] inline std::uint32_t update_slice16(std::uint32_t a_hash, std::span<const std::uint8_t> a_data) noexcept
+			{
+				auto it = a_data.data();
+				auto len = a_data.size();
+				for (; len >= 16; it += 16, len -= 16) {
+					a_hash = slice(12, load<std::uint32_t>(it) ^ a_hash) ^
+					         slice(8, load<std::uint32_t>(it + 4)) ^
+					         slice(4, load<std::uint32_t>(it + 8)) ^
+					         slice(0, load<std::uint32_t>(it + 12));
+				}
+				if (len >= 8) {
+					a_hash = hash8(load<std::uint64_t>(it) ^ a_hash);
+					it += 8;
+					len -= 8;
+				}
+				return update_bytes(a_hash, { it, len });
+			}
+
+			// the crc of a_string in lower case, for names the game compares without case. the string is
+			// lowered a buffer at a time, so each buffer is hashed in one pass
+			[[nodiscard]] inline std::uint32_t update_lower(std::uint32_t a_hash, std::string_view a_string) noexcept
+			{
+				std::array<std::uint8_t, 0x40> buf;
+				while (!a_string.empty()) {
+					const auto len = (std::min)(a_string.size(), buf.size());
+					std::transform(a_string.data(), a_string.data() + len, buf.data(), [](char a_char) {
+						return static_cast<std::uint8_t>(std::tolower(static_cast<unsigned char>(a_char)));
+					});
+					a_hash = update_slice16(a_hash, { buf.data(), len });
+					a_string.remove_prefix(len);
+				}
+				return a_hash;
+			}
+
+#ifdef RE_CRC32_CLMUL
+			[[nodiscard]] inline bool has_clmul() noexcept
+			{
+				static const bool supported = [] {
+#	ifdef _MSC_VER
+					int regs[4]{};
+					::__cpuid(regs, 1);
+					return (regs[2] & (1 << 1)) != 0;
+#	else
+					return __builtin_cpu_supports("pclmul") != 0;
+#	endif
+				}();
+				return supported;
+			}
+
+			// folds 64 bytes at a time, then 16, then reduces to 32 bits (intel, "fast crc computation for
+			// generic polynomials using pclmulqdq"); a_data must be at least 64 bytes and a multiple of 16
+			[[nodiscard]] RE_CRC32_TARGET_CLMUL inline std::uint32_t update_clmul(std::uint32_t a_hash, std::span<const std::uint8_t> a_data) noexcept
+			{
+				const auto fold = [](__m128i a_lhs, __m128i a_rhs, __m128i a_k) RE_CRC32_TARGET_CLMUL {
+					return _mm_xor_si128(
+						_mm_xor_si128(_mm_clmulepi64_si128(a_lhs, a_k, 0x00), _mm_clmulepi64_si128(a_lhs, a_k, 0x11)),
+						a_rhs);
+				};
+				const auto load128 = [](const std::uint8_t* a_src) RE_CRC32_TARGET_CLMUL {
+					return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a_src));
+				};
+
+				auto it = a_data.data();
+				auto len = a_data.size();
+
+				auto x1 = _mm_xor_si128(load128(it), _mm_cvtsi32_si128(static_cast<int>(a_hash)));
+				auto x2 = load128(it + 0x10);
+				auto x3 = load128(it + 0x20);
+				auto x4 = load128(it + 0x30);
+				it += 64;
+				len -= 64;
+
+				auto k = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+				for (; len >= 64; it += 64, len -= 64) {
+					x1 = fold(x1, load128(it), k);
+					x2 = fold(x2, load128(it + 0x10), k);
+					x3 = fold(x3, load128(it + 0x20), k);
+					x4 = fold(x4, load128(it + 0x30), k);
+				}
+
+				k = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+				x1 = fold(x1, x2, k);
+				x1 = fold(x1, x3, k);
+				x1 = fold(x1, x4, k);
+				for (; len >= 16; it += 16, len -= 16) {
+					x1 = fold(x1, load128(it), k);
+				}
+
+				// 128 bits to 64
+				const auto mask = _mm_setr_epi32(~0, 0, ~0, 0);
+				x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k, 0x10));
+				k = _mm_set_epi64x(0, 0x0163CD6124);
+				x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x00), _mm_srli_si128(x1, 4));
+
+				// barrett reduction to 32 bits
+				k = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+				auto reduced = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x10);
+				reduced = _mm_clmulepi64_si128(_mm_and_si128(reduced, mask), k, 0x00);
+				x1 = _mm_xor_si128(x1, reduced);
+
+				return static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+			}
+#endif
+
+			// picks the widest engine the cpu and the input length allow
+			[[nodiscard]] inline std::uint32_t update(std::uint32_t a_hash, std::span<const std::uint8_t> a_data) noexcept
+			{
+#ifdef RE_CRC32_CLMUL
+				if (a_data.size() >= CLMUL_THRESHOLD && has_clmul()) {
+					const auto size = a_data.size() & ~static_cast<std::size_t>(15);
+					a_hash = update_clmul(a_hash, a_data.first(size));
+					a_data = a_data.subspan(size);
+				}
+#endif
+				return update_slice16(a_hash, a_data);
+			}
+		}
+
 		[[nodiscard]] constexpr std::uint32_t GenerateCRC32(std::span<const std::uint8_t> a_data) noexcept
 		{
-			constexpr std::array<std::uint32_t, 256> table{
-				0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-				0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-				0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-				0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-				0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-				0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-				0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-				0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-				0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-				0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-				0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-				0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-				0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-				0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-				0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-				0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-				0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-				0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-				0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-				0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-				0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-				0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-				0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-				0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-				0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-				0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-				0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-				0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-				0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-				0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-				0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-				0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-			};
-
-			std::uint32_t hash = 0;
-			for (const auto byte : a_data) {
-				hash = (hash >> 8) ^ table[(hash ^ byte) & 0xFF];
+			if (std::is_constant_evaluated()) {
+				return CRC32::update_bytes(0, a_data);
+			}
+
+			switch (a_data.size()) {
+			case 4:
+				return CRC32::hash4(CRC32::load<std::uint32_t>(a_data.data()));
+			case 8:
+				return CRC32::hash8(CRC32::load<std::uint64_t>(a_data.data()));
+			default:
+				return CRC32::update(0, a_data);
 			}
-			return hash;
 		}
 
 		template <class, bool>
@@ -77,7 +250,13 @@ namespace RE
 	public:
 		[[nodiscard]] std::uint32_t operator()(Key a_data) const noexcept
 		{
-			return detail::GenerateCRC32({ reinterpret_cast<const std::uint8_t*>(std::addressof(a_data)), sizeof(Key) });
+			if constexpr (sizeof(Key) == 4) {
+				return detail::CRC32::hash4(std::bit_cast<std::uint32_t>(a_data));
+			} else if constexpr (sizeof(Key) == 8) {
+				return detail::CRC32::hash8(std::bit_cast<std::uint64_t>(a_data));
+			} else {
+				return detail::GenerateCRC32({ reinterpret_cast<const std::uint8_t*>(std::addressof(a_data)), sizeof(Key) });
+			}
 		}
 	};
 
@@ -104,7 +283,7 @@ namespace RE
 	public:
 		[[nodiscard]] std::uint32_t operator()(std::basic_string_view<CharT> a_data) const noexcept
 		{
-			return detail::GenerateCRC32({ a_data.data(), a_data.length() });
+			return detail::GenerateCRC32({ reinterpret_cast<const std::uint8_t*>(a_data.data()), a_data.length() * sizeof(CharT) });
 		}
 	};
 
@@ -117,3 +296,6 @@ namespace RE
 	extern template struct BSCRC32<std::int64_t>;
 	extern template struct BSCRC32<std::uint64_t>;
 }
+
+#undef RE_CRC32_TARGET_CLMUL
+#undef RE_CRC32_CLMUL
@@ -33,7 +33,7 @@ namespace RE
 		
 		[[nodiscard]] static Calendar* GetSingleton()
 		{
-			REL::Relocation<Calendar**> singleton{ REL::ID(1444952) };
+			static REL::Relocation<Calendar**> singleton{ REL::ID(1444952) };
 			return *singleton;
 		}
 
@@ -11,21 +11,21 @@ namespace RE
 	public:
 		[[nodiscard]] static ConsoleLog* GetSingleton()
 		{
-			REL::Relocation<ConsoleLog**> singleton{ REL::ID(689441) };
+			static REL::Relocation<ConsoleLog**> singleton{ REL::ID(689441) };
 			return *singleton;
 		}
 
 		void AddString(char const* a_string)
 		{
 			using func_t = decltype(&ConsoleLog::AddString);
-			REL::Relocation<func_t> func{ REL::ID(764) };
+			static REL::Relocation<func_t> func{ REL::ID(764) };
 			return func(this, a_string);
 		}
 
 		void Print(const char* a_fmt, std::va_list a_args)
 		{
 			using func_t = decltype(&ConsoleLog::Print);
-			REL::Relocation<func_t> func{ REL::ID(799546) };
+			static REL::Relocation<func_t> func{ REL::ID(799546) };
 			func(this, a_fmt, a_args);
 		}
 
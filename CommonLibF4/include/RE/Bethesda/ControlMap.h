@@ -55,28 +55,28 @@ namespace RE
 
 		[[nodiscard]] static ControlMap* GetSingleton()
 		{
-			REL::Relocation<ControlMap**> singleton{ REL::ID(325206) };
+			static REL::Relocation<ControlMap**> singleton{ REL::ID(325206) };
 			return *singleton;
 		}
 
 		bool PopInputContext(UserEvents::INPUT_CONTEXT_ID a_context)
 		{
 			using func_t = decltype(&ControlMap::PopInputContext);
-			REL::Relocation<func_t> func{ REL::ID(74587) };
+			static REL::Relocation<func_t> func{ REL::ID(74587) };
 			return func(this, a_context);
 		}
 
 		void PushInputContext(UserEvents::INPUT_CONTEXT_ID a_context)
 		{
 			using func_t = decltype(&ControlMap::PushInputContext);
-			REL::Relocation<func_t> func{ REL::ID(1404410) };
+			static REL::Relocation<func_t> func{ REL::ID(1404410) };
 			return func(this, a_context);
 		}
 
 		void SetTextEntryMode(bool a_enable)
 		{
 			using func_t = decltype(&ControlMap::SetTextEntryMode);
-			REL::Relocation<func_t> func{ REL::ID(1270079) };
+			static REL::Relocation<func_t> func{ REL::ID(1270079) };
 			return func(this, a_enable);
 		}
 
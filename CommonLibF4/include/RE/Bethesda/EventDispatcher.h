@@ -0,0 +1,245 @@
+#pragma once
+
+#include "RE/SnapshotDomain.h"
+
+#ifndef F4SE_TEST_SUITE
+#	include "RE/Bethesda/BSCore/BSTEvent.h"
+#endif
+
+namespace RE
+{
+	// registers one sink with a game event source and fans each event out to any number of plugin
+	// listeners. dispatch walks an immutable snapshot of the listeners, which it pins without taking a
+	// lock, and subscribing or unsubscribing swaps in a new one. a dispatch never waits on a subscriber,
+	// and a listener may unsubscribe from inside its own callback
+	template <class Event>
+	class EventDispatcher :
+		public BSTEventSink<Event>  // 00
+	{
+	public:
+		using event_type = Event;
+		using source_type = BSTEventSource<event_type>;
+		using callback_type = std::function<BSEventNotifyControl(const event_type&)>;
+		using predicate_type = std::function<bool(const event_type&)>;
+		using handle_type = std::uint32_t;
+
+		static constexpr handle_type INVALID_HANDLE = 0;
+
+		struct stats_t
+		{
+		public:
+			// members
+			handle_type handle{ INVALID_HANDLE };
+			std::uint64_t calls{ 0 };
+			std::uint64_t filtered{ 0 };
+			std::chrono::nanoseconds total{ 0 };
+			std::chrono::nanoseconds max{ 0 };
+		};
+
+		explicit EventDispatcher(source_type* a_source) :
+			_source(a_source)
+		{
+			if (_source) {
+				_source->RegisterSink(this);
+			}
+		}
+
+		EventDispatcher(const EventDispatcher&) = delete;
+		EventDispatcher(EventDispatcher&&) = delete;
+
+		~EventDispatcher() override
+		{
+			if (_source) {
+				_source->UnregisterSink(this);
+			}
+			release(_current.load());
+		}
+
+		EventDispatcher& operator=(const EventDispatcher&) = delete;
+		EventDispatcher& operator=(EventDispatcher&&) = delete;
+
+		// the callback may return nothing, or kStop to keep the event from the listeners after it. the
+		// game's other sinks always see the event
+		template <class F>
+		handle_type Subscribe(F&& a_callback, predicate_type a_predicate = nullptr)  //
+			requires(std::invocable<F&, const event_type&>)
+		{
+			auto listener = std::make_shared<listener_t>();
+			listener->handle = _nextHandle.fetch_add(1, std::memory_order_relaxed);
+			listener->predicate = std::move(a_predicate);
+			if constexpr (std::is_void_v<std::invoke_result_t<F&, const event_type&>>) {
+				listener->callback = [func = std::forward<F>(a_callback)](const event_type& a_event) mutable {
+					func(a_event);
+					return BSEventNotifyControl::kContinue;
+				};
+			} else {
+				listener->callback = std::forward<F>(a_callback);
+			}
+
+			const auto handle = listener->handle;
+			update([&](snapshot_type& a_listeners) { a_listeners.push_back(listener); });
+			return handle;
+		}
+
+		// returns false if the handle is not subscribed. a dispatch already underway may still call it once
+		bool Unsubscribe(handle_type a_handle)
+		{
+			bool found = false;
+			update([&](snapshot_type& a_listeners) {
+				const auto it = std::ranges::find(a_listeners, a_handle, &listener_t::handle);
+				found = it != a_listeners.end();
+				if (found) {
+					a_listeners.erase(it);
+				}
+			});
+			return found;
+		}
+
+		[[nodiscard]] std::size_t size() const
+		{
+			const auto snapshot = acquire();
+			return snapshot ? snapshot->listeners.size() : 0;
+		}
+
+		[[nodiscard]] bool empty() const { return size() == 0; }
+
+		// one entry per listener, in the order they are called
+		[[nodiscard]] std::vector<stats_t> GetStats() const
+		{
+			std::vector<stats_t> result;
+			if (const auto snapshot = acquire(); snapshot) {
+				result.reserve(snapshot->listeners.size());
+				for (const auto& listener : snapshot->listeners) {
+					result.push_back({ listener->handle,
+						listener->calls.load(std::memory_order_relaxed),
+						listener->filtered.load(std::memory_order_relaxed),
+						std::chrono::nanoseconds{ listener->total.load(std::memory_order_relaxed) },
+						std::chrono::nanoseconds{ listener->max.load(std::memory_order_relaxed) } });
+				}
+			}
+			return result;
+		}
+
+		void ResetStats()
+		{
+			if (const auto snapshot = acquire(); snapshot) {
+				for (const auto& listener : snapshot->listeners) {
+					listener->calls.store(0, std::memory_order_relaxed);
+					listener->filtered.store(0, std::memory_order_relaxed);
+					listener->total.store(0, std::memory_order_relaxed);
+					listener->max.store(0, std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// override (BSTEventSink<Event>)
+		BSEventNotifyControl ProcessEvent(const event_type& a_event, source_type*) override  // 01
+		{
+			const auto snapshot = acquire();
+			if (!snapshot) {
+				return BSEventNotifyControl::kContinue;
+			}
+
+			for (const auto& listener : snapshot->listeners) {
+				if (listener->predicate && !listener->predicate(a_event)) {
+					listener->filtered.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+
+				const auto start = std::chrono::steady_clock::now();
+				const auto result = listener->callback(a_event);
+				listener->record(std::chrono::steady_clock::now() - start);
+				if (result == BSEventNotifyControl::kStop) {
+					break;
+				}
+			}
+
+			return BSEventNotifyControl::kContinue;
+		}
+
+	private:
+		struct listener_t
+		{
+		public:
+			void record(std::chrono::nanoseconds a_elapsed) noexcept
+			{
+				const auto elapsed = static_cast<std::uint64_t>(a_elapsed.count());
+				calls.fetch_add(1, std::memory_order_relaxed);
+				total.fetch_add(elapsed, std::memory_order_relaxed);
+				auto seen = max.load(std::memory_order_relaxed);
+				while (seen < elapsed && !max.compare_exchange_weak(seen, elapsed, std::memory_order_relaxed)) {}
+			}
+
+			// members
+			handle_type handle{ INVALID_HANDLE };
+			callback_type callback;
+			predicate_type predicate;
+			std::atomic<std::uint64_t> calls{ 0 };
+			std::atomic<std::uint64_t> filtered{ 0 };
+			std::atomic<std::uint64_t> total{ 0 };
+			std::atomic<std::uint64_t> max{ 0 };
+		};
+
+		using snapshot_type = std::vector<std::shared_ptr<listener_t>>;
+
+		// the dispatcher holds one reference to the current snapshot, and each reader pinning it another
+		struct snapshot_t
+		{
+		public:
+			// members
+			snapshot_type listeners;
+			mutable std::atomic<std::uint32_t> refs{ 1 };
+		};
+
+		static void release(const snapshot_t* a_snapshot) noexcept
+		{
+			if (a_snapshot && a_snapshot->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				delete a_snapshot;
+			}
+		}
+
+		struct release_t
+		{
+		public:
+			void operator()(const snapshot_t* a_snapshot) const noexcept { release(a_snapshot); }
+		};
+
+		// the reader guard only covers taking the reference, so a pinned snapshot can outlive it, and a
+		// callback which unsubscribes is not waiting on itself
+		[[nodiscard]] std::unique_ptr<const snapshot_t, release_t> acquire() const noexcept
+		{
+			const detail::SnapshotDomain::reader_guard guard{ _domain };
+			const auto snapshot = _current.load();
+			if (snapshot) {
+				snapshot->refs.fetch_add(1, std::memory_order_relaxed);
+			}
+			return std::unique_ptr<const snapshot_t, release_t>{ snapshot };
+		}
+
+		// copy, edit, and swap the copy in. the old one goes once no reader can still be about to pin it
+		template <class F>
+		void update(F a_edit)
+		{
+			const std::scoped_lock l{ _writeLock };
+			const auto old = _current.load();
+			auto copy = std::make_unique<snapshot_t>();
+			if (old) {
+				copy->listeners = old->listeners;
+			}
+			a_edit(copy->listeners);
+
+			_current.store(copy.release());
+			if (old) {
+				_domain.synchronize();
+				release(old);
+			}
+		}
+
+		// members
+		source_type* _source{ nullptr };
+		detail::SnapshotDomain _domain;
+		std::atomic<const snapshot_t*> _current{ nullptr };
+		std::mutex _writeLock;
+		std::atomic<handle_type> _nextHandle{ 1 };
+	};
+}
@@ -28,7 +28,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<BGSOnPlayerUseWorkBenchEvent>* GetEventSource()
 		{
 			using func_t = decltype(&BGSOnPlayerUseWorkBenchEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(379998) };
+			static REL::Relocation<func_t> func{ REL::ID(379998) };
 			return func();
 		}
 	};
@@ -52,7 +52,7 @@ namespace RE
 		static void InitSDM()
 		{
 			using func_t = decltype(&BSThreadEvent::InitSDM);
-			REL::Relocation<func_t> func{ REL::ID(1425097) };
+			static REL::Relocation<func_t> func{ REL::ID(1425097) };
 			return func();
 		}
 	};
@@ -66,7 +66,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(421543) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(421543) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -89,7 +89,7 @@ namespace RE
 
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(344866) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(344866) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -123,7 +123,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(696410) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(696410) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -154,7 +154,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(787908) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(787908) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -201,7 +201,7 @@ namespace RE
 			const InventoryUserUIInterfaceEntry& a_entry)
 		{
 			using func_t = decltype(&InventoryItemDisplayData::ctor);
-			REL::Relocation<func_t> func{ REL::ID(679373) };
+			static REL::Relocation<func_t> func{ REL::ID(679373) };
 			return func(this, a_inventoryRef, a_entry);
 		}
 	};
@@ -218,7 +218,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<LocksPicked::Event>* GetEventSource()
 		{
 			using func_t = decltype(&LocksPicked::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(594991) };
+			static REL::Relocation<func_t> func{ REL::ID(594991) };
 			return func();
 		}
 	};
@@ -264,7 +264,7 @@ namespace RE
 
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(685859) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(685859) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -285,7 +285,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(1140080) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(1140080) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -313,7 +313,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(353960) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(353960) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -321,7 +321,7 @@ namespace RE
 		}
 		[[nodiscard]] static ValueEventSource_t* GetValueEventSource()
 		{
-			REL::Relocation<ValueEventSource_t**> singleton{ REL::ID(573549) };
+			static REL::Relocation<ValueEventSource_t**> singleton{ REL::ID(573549) };
 			if (!*singleton) {
 				*singleton = new ValueEventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -345,7 +345,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(1231665) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(1231665) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -363,7 +363,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(88091) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(88091) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -371,7 +371,7 @@ namespace RE
 		}
 		[[nodiscard]] static ValueEventSource_t* GetValueEventSource()
 		{
-			REL::Relocation<ValueEventSource_t**> singleton{ REL::ID(307381) };
+			static REL::Relocation<ValueEventSource_t**> singleton{ REL::ID(307381) };
 			if (!*singleton) {
 				*singleton = new ValueEventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -390,7 +390,7 @@ namespace RE
 	public:
 		[[nodiscard]] static EventSource_t* GetEventSource()
 		{
-			REL::Relocation<EventSource_t**> singleton{ REL::ID(793042) };
+			static REL::Relocation<EventSource_t**> singleton{ REL::ID(793042) };
 			if (!*singleton) {
 				*singleton = new EventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -399,7 +399,7 @@ namespace RE
 
 		[[nodiscard]] static ValueEventSource_t* GetValueEventSource()
 		{
-			REL::Relocation<ValueEventSource_t**> singleton{ REL::ID(1012004) };
+			static REL::Relocation<ValueEventSource_t**> singleton{ REL::ID(1012004) };
 			if (!*singleton) {
 				*singleton = new ValueEventSource_t(&BSTGlobalEvent::GetSingleton()->eventSourceSDMKiller);
 			}
@@ -456,7 +456,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<TESActivateEvent>* GetEventSource()
 		{
 			using func_t = decltype(&TESActivateEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(166230) };
+			static REL::Relocation<func_t> func{ REL::ID(166230) };
 			return func();
 		}
 
@@ -472,7 +472,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<TESContainerChangedEvent>* GetEventSource()
 		{
 			using func_t = decltype(&TESContainerChangedEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(242538) };
+			static REL::Relocation<func_t> func{ REL::ID(242538) };
 			return func();
 		}
 
@@ -492,7 +492,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<TESDeathEvent>* GetEventSource()
 		{
 			using func_t = decltype(&TESDeathEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(1465690) };
+			static REL::Relocation<func_t> func{ REL::ID(1465690) };
 			return func();
 		}
 
@@ -508,14 +508,14 @@ namespace RE
 	public:
 		[[nodiscard]] static BSTEventSource<TESEquipEvent>& GetSingleton()
 		{
-			REL::Relocation<BSTEventSource<TESEquipEvent>*> singleton{ REL::ID(485633) };
+			static REL::Relocation<BSTEventSource<TESEquipEvent>*> singleton{ REL::ID(485633) };
 			return *singleton;
 		}
 
 		[[nodiscard]] static BSTEventSource<TESEquipEvent>* GetEventSource()
 		{
 			using func_t = decltype(&TESEquipEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(1251703) };
+			static REL::Relocation<func_t> func{ REL::ID(1251703) };
 			return func();
 		}
 
@@ -549,7 +549,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<TESFurnitureEvent>* GetEventSource()
 		{
 			using func_t = decltype(&TESFurnitureEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(823570) };
+			static REL::Relocation<func_t> func{ REL::ID(823570) };
 			return func();
 		}
 
@@ -565,14 +565,14 @@ namespace RE
 	public:
 		[[nodiscard]] static BSTEventSource<TESLoadGameEvent>& GetSingleton()
 		{
-			REL::Relocation<BSTEventSource<TESLoadGameEvent>*> singleton{ REL::ID(430381) };
+			static REL::Relocation<BSTEventSource<TESLoadGameEvent>*> singleton{ REL::ID(430381) };
 			return *singleton;
 		}
 
 		[[nodiscard]] static BSTEventSource<TESLoadGameEvent>* GetEventSource()
 		{
 			using func_t = decltype(&TESLoadGameEvent::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(823570) };
+			static REL::Relocation<func_t> func{ REL::ID(823570) };
 			return func();
 		}
 	};
@@ -615,7 +615,7 @@ namespace RE
 			[[nodiscard]] static CellAttachDetachEventSourceSingleton& GetSingleton()
 			{
 				using func_t = decltype(&CellAttachDetachEventSourceSingleton::GetSingleton);
-				REL::Relocation<func_t> func{ REL::ID(862142) };
+				static REL::Relocation<func_t> func{ REL::ID(862142) };
 				return func();
 			}
 
@@ -636,7 +636,7 @@ namespace RE
 		[[nodiscard]] static BSTEventSource<WeaponAttack::Event>& GetEventSource()
 		{
 			using func_t = decltype(&WeaponAttack::GetEventSource);
-			REL::Relocation<func_t> func{ REL::ID(66546) };
+			static REL::Relocation<func_t> func{ REL::ID(66546) };
 			return func();
 		}
 	};
@@ -42,14 +42,14 @@ namespace RE
 
 		[[nodiscard]] static FavoritesManager* GetSingleton()
 		{
-			REL::Relocation<FavoritesManager**> singleton{ REL::ID(198281) };
+			static REL::Relocation<FavoritesManager**> singleton{ REL::ID(198281) };
 			return *singleton;
 		}
 
 		[[nodiscard]] bool IsComponentFavorite(const TESBoundObject* a_component)
 		{
 			using func_t = decltype(&FavoritesManager::IsComponentFavorite);
-			REL::Relocation<func_t> func{ REL::ID(352046) };
+			static REL::Relocation<func_t> func{ REL::ID(352046) };
 			return func(this, a_component);
 		}
 
@@ -873,7 +873,7 @@ namespace RE
 		void AddKeyword(BGSKeyword* a_keyword)
 		{
 			using func_t = decltype(&BGSKeywordForm::AddKeyword);
-			REL::Relocation<func_t> func{ REL::ID(762999) };
+			static REL::Relocation<func_t> func{ REL::ID(762999) };
 			return func(this, a_keyword);
 		}
 
@@ -1007,14 +1007,14 @@ namespace RE
 		void AllocatePerkRankArray(std::uint32_t a_count)
 		{
 			using func_t = decltype(&BGSPerkRankArray::AllocatePerkRankArray);
-			REL::Relocation<func_t> func{ REL::ID(888419) };
+			static REL::Relocation<func_t> func{ REL::ID(888419) };
 			return func(this, a_count);
 		}
 
 		void ClearPerks(bool a_removeFormUser)
 		{
 			using func_t = decltype(&BGSPerkRankArray::ClearPerks);
-			REL::Relocation<func_t> func{ REL::ID(1247917) };
+			static REL::Relocation<func_t> func{ REL::ID(1247917) };
 			return func(this, a_removeFormUser);
 		}
 
@@ -1233,14 +1233,14 @@ namespace RE
 		void GetDescription(BSStringT<char>& a_out, const TESForm* a_form) const
 		{
 			using func_t = decltype(&BGSLocalizedStringDL::GetDescription);
-			REL::Relocation<func_t> func{ REL::ID(523613) };
+			static REL::Relocation<func_t> func{ REL::ID(523613) };
 			return func(this, a_out, a_form);
 		}
 
 		[[nodiscard]] BGSLocalizedStrings::ScrapStringBuffer GetText(TESFile& a_file) const
 		{
 			using func_t = decltype(&BGSLocalizedStringDL::GetText);
-			REL::Relocation<func_t> func{ REL::ID(472297) };
+			static REL::Relocation<func_t> func{ REL::ID(472297) };
 			return func(this, a_file);
 		}
 
@@ -1269,7 +1269,7 @@ namespace RE
 		void GetDescription(BSStringT<char>& a_outString, const TESForm* a_form = nullptr)
 		{
 			using func_t = decltype(&TESDescription::GetDescription);
-			REL::Relocation<func_t> func{ REL::ID(523613) };
+			static REL::Relocation<func_t> func{ REL::ID(523613) };
 			return func(this, a_outString, a_form);
 		}
 
@@ -1317,7 +1317,7 @@ namespace RE
 		[[nodiscard]] static auto GetSparseFullNameMap()
 			-> BSTHashMap<const TESForm*, BGSLocalizedString>&
 		{
-			REL::Relocation<BSTHashMap<const TESForm*, BGSLocalizedString>*> sparseFullNameMap{ REL::ID(226372), -0x8 };
+			static REL::Relocation<BSTHashMap<const TESForm*, BGSLocalizedString>*> sparseFullNameMap{ REL::ID(226372), -0x8 };
 			return *sparseFullNameMap;
 		}
 
@@ -1343,7 +1343,7 @@ namespace RE
 		[[nodiscard]] static std::uint32_t GetFormHealth(const TESForm* a_form, const TBO_InstanceData* a_data)
 		{
 			using func_t = decltype(&TESHealthForm::GetFormHealth);
-			REL::Relocation<func_t> func{ REL::ID(1515099) };
+			static REL::Relocation<func_t> func{ REL::ID(1515099) };
 			return func(a_form, a_data);
 		}
 
@@ -1754,7 +1754,7 @@ namespace RE
 		bool AddSpell(TESForm* a_spell)
 		{
 			using func_t = decltype(&TESSpellList::AddSpell);
-			REL::Relocation<func_t> func{ REL::ID(1312083) };
+			static REL::Relocation<func_t> func{ REL::ID(1312083) };
 			return func(this, a_spell);
 		}
 
@@ -1785,7 +1785,7 @@ namespace RE
 		[[nodiscard]] static std::uint32_t GetFormValue(const TESForm* a_form, const TBO_InstanceData* a_data)
 		{
 			using func_t = std::int32_t (*)(const TESForm*, const TBO_InstanceData*);
-			REL::Relocation<func_t> func{ REL::ID(885783) };
+			static REL::Relocation<func_t> func{ REL::ID(885783) };
 			return func(a_form, a_data);
 		}
 
@@ -1807,7 +1807,7 @@ namespace RE
 		[[nodiscard]] static float GetFormWeight(const TESForm* a_form, const TBO_InstanceData* a_data)
 		{
 			using func_t = float (*)(const TESForm*, const TBO_InstanceData*);
-			REL::Relocation<func_t> func{ REL::ID(1321341) };
+			static REL::Relocation<func_t> func{ REL::ID(1321341) };
 			return func(a_form, a_data);
 		}
 
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "RE/Bethesda/CRC.h"
+#include "RE/SnapshotDomain.h"
+
+namespace RE
+{
+	class TESForm;
+
+	namespace detail
+	{
+		// open addressed map from a form id or an editor id to a form. keys are never removed, only their
+		// values cleared, so lookups stay wait-free while the one writer patches the table in place
+		template <class Key, class T>
+		class FormTable
+		{
+		public:
+			static_assert(std::same_as<Key, std::uint32_t> || std::same_as<Key, std::string_view>);
+
+			explicit FormTable(std::size_t a_count) :
+				_capacity(std::bit_ceil((std::max)(a_count * 2, static_cast<std::size_t>(16)))),
+				_slots(std::make_unique<slot_t[]>(_capacity))
+			{}
+
+			[[nodiscard]] std::size_t capacity() const noexcept { return _capacity; }
+			[[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+			[[nodiscard]] T* find(Key a_key) const noexcept
+			{
+				const auto hash = hash_key(a_key);
+				for (std::size_t i = hash, n = 0; n < _capacity; ++i, ++n) {
+					const auto& slot = _slots[i & (_capacity - 1)];
+					const auto seen = slot.hash.load(std::memory_order_acquire);
+					if (seen == 0) {
+						break;
+					} else if (seen == hash && slot.matches(a_key)) {
+						return slot.value.load(std::memory_order_acquire);
+					}
+				}
+				return nullptr;
+			}
+
+			// returns false, and leaves the table alone, if it is too full to take another key
+			bool insert(Key a_key, T* a_value)
+			{
+				const auto hash = hash_key(a_key);
+				for (std::size_t i = hash;; ++i) {
+					auto& slot = _slots[i & (_capacity - 1)];
+					const auto seen = slot.hash.load(std::memory_order_relaxed);
+					if (seen == 0) {
+						if ((_size + 1) * 2 > _capacity) {
+							return false;
+						}
+
+						slot.key.store(store_key(a_key), std::memory_order_relaxed);
+						slot.value.store(a_value, std::memory_order_relaxed);
+						slot.hash.store(hash, std::memory_order_release);
+						++_size;
+						return true;
+					} else if (seen == hash && slot.matches(a_key)) {
+						slot.value.store(a_value, std::memory_order_release);
+						return true;
+					}
+				}
+			}
+
+			void erase(Key a_key) noexcept
+			{
+				const auto hash = hash_key(a_key);
+				for (std::size_t i = hash, n = 0; n < _capacity; ++i, ++n) {
+					auto& slot = _slots[i & (_capacity - 1)];
+					const auto seen = slot.hash.load(std::memory_order_relaxed);
+					if (seen == 0) {
+						break;
+					} else if (seen == hash && slot.matches(a_key)) {
+						slot.value.store(nullptr, std::memory_order_release);
+						break;
+					}
+				}
+			}
+
+			// visits every key which still has a value, for the writer to copy into a larger table
+			template <class F>
+			void for_each(F a_func) const
+			{
+				for (std::size_t i = 0; i < _capacity; ++i) {
+					const auto& slot = _slots[i];
+					if (const auto value = slot.value.load(std::memory_order_relaxed); value) {
+						a_func(slot.get_key(), value);
+					}
+				}
+			}
+
+		private:
+			using key_storage = std::conditional_t<std::same_as<Key, std::uint32_t>, std::uint32_t, const std::string*>;
+
+			struct slot_t
+			{
+			public:
+				[[nodiscard]] Key get_key() const noexcept
+				{
+					if constexpr (std::same_as<Key, std::uint32_t>) {
+						return key.load(std::memory_order_relaxed);
+					} else {
+						return *key.load(std::memory_order_relaxed);
+					}
+				}
+
+				[[nodiscard]] bool matches(Key a_key) const noexcept
+				{
+					if constexpr (std::same_as<Key, std::uint32_t>) {
+						return get_key() == a_key;
+					} else {
+						return std::ranges::equal(get_key(), a_key, [](char a_lhs, char a_rhs) {
+							return lower(a_lhs) == lower(a_rhs);
+						});
+					}
+				}
+
+				// members
+				std::atomic<std::uint32_t> hash{ 0 };  // 0 marks an empty slot
+				std::atomic<key_storage> key{};
+				std::atomic<T*> value{ nullptr };
+			};
+
+			[[nodiscard]] static std::uint8_t lower(char a_char) noexcept
+			{
+				return static_cast<std::uint8_t>(std::tolower(static_cast<unsigned char>(a_char)));
+			}
+
+			// editor ids compare without case, as the game's do
+			[[nodiscard]] static std::uint32_t hash_key(Key a_key) noexcept
+			{
+				std::uint32_t hash = 0;
+				if constexpr (std::same_as<Key, std::uint32_t>) {
+					hash = CRC32::hash4(a_key);
+				} else {
+					hash = CRC32::update_lower(0, a_key);
+				}
+				return hash != 0 ? hash : 1;
+			}
+
+			[[nodiscard]] key_storage store_key(Key a_key)
+			{
+				if constexpr (std::same_as<Key, std::uint32_t>) {
+					return a_key;
+				} else {
+					return std::addressof(_names.emplace_back(a_key));
+				}
+			}
+
+			// members
+			std::size_t _capacity;
+			std::unique_ptr<slot_t[]> _slots;
+			std::size_t _size{ 0 };
+			std::deque<std::string> _names;
+		};
+
+		template <class T>
+		struct FormSnapshot
+		{
+		public:
+			FormSnapshot(std::size_t a_ids, std::size_t a_editorIDs) :
+				ids(a_ids),
+				editorIDs(a_editorIDs)
+			{}
+
+			// members
+			FormTable<std::uint32_t, T> ids;
+			FormTable<std::string_view, T> editorIDs;
+		};
+
+		// the game independent half of FormLookupCache
+		template <class T>
+		class FormCache
+		{
+		public:
+			using snapshot_type = FormSnapshot<T>;
+
+			struct stats_t
+			{
+			public:
+				// members
+				std::uint64_t hits{ 0 };
+				std::uint64_t misses{ 0 };
+			};
+
+			FormCache() = default;
+			FormCache(const FormCache&) = delete;
+			FormCache(FormCache&&) = delete;
+
+			~FormCache() { delete _current.load(); }
+
+			FormCache& operator=(const FormCache&) = delete;
+			FormCache& operator=(FormCache&&) = delete;
+
+			[[nodiscard]] bool IsBuilt() const noexcept { return _current.load() != nullptr; }
+
+			// wait-free; returns nullptr if the snapshot does not have the form
+			[[nodiscard]] T* Find(std::uint32_t a_formID) const noexcept
+			{
+				return probe([&](const snapshot_type& a_snapshot) { return a_snapshot.ids.find(a_formID); });
+			}
+
+			[[nodiscard]] T* Find(std::string_view a_editorID) const noexcept
+			{
+				return probe([&](const snapshot_type& a_snapshot) { return a_snapshot.editorIDs.find(a_editorID); });
+			}
+
+			// swaps in a new snapshot, and frees the old one once no reader can still hold it
+			void Publish(std::unique_ptr<snapshot_type> a_snapshot)
+			{
+				const std::scoped_lock l{ _writeLock };
+				replace(std::move(a_snapshot));
+			}
+
+			void Invalidate() { Publish(nullptr); }
+
+			// patches the snapshot in place, growing it if it has to
+			void Insert(std::uint32_t a_formID, std::string_view a_editorID, T* a_form)
+			{
+				const std::scoped_lock l{ _writeLock };
+				const auto snapshot = _current.load();
+				if (!snapshot) {
+					return;
+				}
+
+				if (!snapshot->ids.insert(a_formID, a_form) ||
+					(!a_editorID.empty() && !snapshot->editorIDs.insert(a_editorID, a_form))) {
+					auto grown = std::make_unique<snapshot_type>(snapshot->ids.size() + 1, snapshot->editorIDs.size() + 1);
+					snapshot->ids.for_each([&](std::uint32_t a_key, T* a_value) { grown->ids.insert(a_key, a_value); });
+					snapshot->editorIDs.for_each([&](std::string_view a_key, T* a_value) { grown->editorIDs.insert(a_key, a_value); });
+					grown->ids.insert(a_formID, a_form);
+					if (!a_editorID.empty()) {
+						grown->editorIDs.insert(a_editorID, a_form);
+					}
+					replace(std::move(grown));
+				}
+			}
+
+			void Erase(std::uint32_t a_formID, std::string_view a_editorID)
+			{
+				const std::scoped_lock l{ _writeLock };
+				if (const auto snapshot = _current.load(); snapshot) {
+					snapshot->ids.erase(a_formID);
+					if (!a_editorID.empty()) {
+						snapshot->editorIDs.erase(a_editorID);
+					}
+				}
+			}
+
+			[[nodiscard]] stats_t GetStats() const noexcept
+			{
+				stats_t stats;
+				for (const auto& counter : _counters) {
+					stats.hits += counter.hits.load(std::memory_order_relaxed);
+					stats.misses += counter.misses.load(std::memory_order_relaxed);
+				}
+				return stats;
+			}
+
+			void ResetStats() noexcept
+			{
+				for (auto& counter : _counters) {
+					counter.hits.store(0, std::memory_order_relaxed);
+					counter.misses.store(0, std::memory_order_relaxed);
+				}
+			}
+
+		private:
+			template <class F>
+			[[nodiscard]] T* probe(F a_find) const noexcept
+			{
+				const SnapshotDomain::reader_guard guard{ _domain };
+				const auto snapshot = _current.load();
+				const auto result = snapshot ? a_find(*snapshot) : nullptr;
+				auto& counter = _counters[thread_stripe()];
+				(result ? counter.hits : counter.misses).fetch_add(1, std::memory_order_relaxed);
+				return result;
+			}
+
+			void replace(std::unique_ptr<snapshot_type> a_snapshot)
+			{
+				const std::unique_ptr<snapshot_type> old{ _current.exchange(a_snapshot.release()) };
+				if (old) {
+					_domain.synchronize();
+				}
+			}
+
+			// striped like the domain's readers, so probes on different threads never share a line
+			struct alignas(0x40) counter_t
+			{
+			public:
+				// members
+				std::atomic<std::uint64_t> hits{ 0 };
+				std::atomic<std::uint64_t> misses{ 0 };
+			};
+
+			// members
+			SnapshotDomain _domain;
+			std::atomic<snapshot_type*> _current{ nullptr };
+			std::mutex _writeLock;
+			mutable std::array<counter_t, SNAPSHOT_STRIPES> _counters{};
+		};
+	}
+
+	// a plugin side copy of the game's form maps, so hot lookups skip their global locks. build it once
+	// kGameDataReady reports the data is loaded, and forward form creation and deletion to keep it current.
+	// anything the snapshot does not have falls back to the game.
+	// nothing in here watches the game, so a snapshot is only good until the next form is deleted: unless
+	// every deletion reaches OnFormDeleted (i.e. from a hook on the form's destructor), rebuild or Invalidate
+	// it before then, or a lookup can hand back a form that has already been freed
+	class FormLookupCache :
+		public detail::FormCache<TESForm>
+	{
+	public:
+		[[nodiscard]] static FormLookupCache& GetSingleton();
+
+		void Build();
+
+		[[nodiscard]] TESForm* GetFormByID(std::uint32_t a_formID) const;
+		[[nodiscard]] TESForm* GetFormByEditorID(std::string_view a_editorID) const;
+
+		// created forms are skipped, as Build skips them
+		void OnFormCreated(TESForm* a_form);
+		void OnFormDeleted(const TESForm* a_form);
+	};
+}
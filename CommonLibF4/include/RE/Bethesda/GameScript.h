@@ -148,7 +148,7 @@ namespace RE
 			BSScript::ErrorLogger::Severity a_severity = BSScript::ErrorLogger::Severity::kError)
 		{
 			using func_t = decltype(&LogFormError);
-			REL::Relocation<func_t> func{ REL::ID(1081933) };
+			static REL::Relocation<func_t> func{ REL::ID(1081933) };
 			return func(a_obj, a_error, a_vm, a_stackID, a_severity);
 		}
 
@@ -261,7 +261,7 @@ namespace RE
 			void GetInventoryObjFromHandle(std::uint64_t a_cobj, TESObjectREFR*& a_container, std::uint16_t& a_uniqueID, TESObjectREFR*& a_inWorldREFR)
 			{
 				using func_t = decltype(&HandlePolicy::GetInventoryObjFromHandle);
-				REL::Relocation<func_t> func{ REL::ID(66597) };
+				static REL::Relocation<func_t> func{ REL::ID(66597) };
 				return func(this, a_cobj, a_container, a_uniqueID, a_inWorldREFR);
 			}
 
@@ -475,7 +475,7 @@ namespace RE
 
 		[[nodiscard]] static GameVM* GetSingleton()
 		{
-			REL::Relocation<GameVM**> singleton{ REL::ID(996227) };
+			static REL::Relocation<GameVM**> singleton{ REL::ID(996227) };
 			return *singleton;
 		}
 
@@ -484,7 +484,7 @@ namespace RE
 		bool QueuePostRenderCall(const BSTSmartPointer<GameScript::DelayFunctor>& a_functor)
 		{
 			using func_t = decltype(&GameVM::QueuePostRenderCall);
-			REL::Relocation<func_t> func{ REL::ID(34412) };
+			static REL::Relocation<func_t> func{ REL::ID(34412) };
 			return func(this, a_functor);
 		}
 
@@ -496,7 +496,7 @@ namespace RE
 			const BSTSmartPointer<BSScript::IStackCallbackFunctor>& a_callback)
 		{
 			using func_t = decltype(&GameVM::SendEventToObjectAndRelated);
-			REL::Relocation<func_t> func{ REL::ID(367992) };
+			static REL::Relocation<func_t> func{ REL::ID(367992) };
 			return func(this, a_object, a_eventName, a_args, a_filter, a_callback);
 		}
 
@@ -673,7 +673,7 @@ namespace RE
 		inline void BindCObject(const BSTSmartPointer<BSScript::Object>& a_scriptObj, const RefrOrInventoryObj& a_cobj, BSScript::IVirtualMachine& a_vm)
 		{
 			using func_t = decltype(&BindCObject);
-			REL::Relocation<func_t> func{ REL::ID(81787) };
+			static REL::Relocation<func_t> func{ REL::ID(81787) };
 			return func(a_scriptObj, a_cobj, a_vm);
 		}
 
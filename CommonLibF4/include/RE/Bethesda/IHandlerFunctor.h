@@ -62,27 +62,27 @@ namespace RE
 	public:
 		static ActorAnimationHandlerDictionary& GetSingleton()
 		{
-			REL::Relocation<ActorAnimationHandlerDictionary*> singleton{ REL::ID(340630) };
+			static REL::Relocation<ActorAnimationHandlerDictionary*> singleton{ REL::ID(340630) };
 			return *singleton;
 		}
 
 		static ActorAnimationHandlerDictionary* GetSingletonPtr()
 		{
-			REL::Relocation<ActorAnimationHandlerDictionary**> singleton{ REL::ID(1048465) };
+			static REL::Relocation<ActorAnimationHandlerDictionary**> singleton{ REL::ID(1048465) };
 			return *singleton;
 		}
 
 		static ActorAnimationHandlerDictionary* GetInstance()
 		{
 			using func_t = decltype(&ActorAnimationHandlerDictionary::GetInstance);
-			REL::Relocation<func_t> func{ REL::ID(755490), 0xE };
+			static REL::Relocation<func_t> func{ REL::ID(755490), 0xE };
 			return func();
 		}
 
 		static ActorAnimationHandlerDictionary*& GetInstancePtr()
 		{
 			using func_t = decltype(&ActorAnimationHandlerDictionary::GetInstancePtr);
-			REL::Relocation<func_t> func{ REL::ID(930001), 0x100 };
+			static REL::Relocation<func_t> func{ REL::ID(930001), 0x100 };
 			return func();
 		}
 	};
@@ -93,7 +93,7 @@ namespace RE
 	public:
 		static ActorAnimationHandlerFactoryManager& GetSingleton()
 		{
-			REL::Relocation<ActorAnimationHandlerFactoryManager*> singleton{ REL::ID(930001) };
+			static REL::Relocation<ActorAnimationHandlerFactoryManager*> singleton{ REL::ID(930001) };
 			return *singleton;
 		}
 	};
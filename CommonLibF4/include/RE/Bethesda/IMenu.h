@@ -171,7 +171,7 @@ namespace RE
 
 		[[nodiscard]] static FlatScreenModel* GetSingleton()
 		{
-			REL::Relocation<FlatScreenModel**> singleton{ REL::ID(847741) };
+			static REL::Relocation<FlatScreenModel**> singleton{ REL::ID(847741) };
 			return *singleton;
 		}
 
@@ -210,7 +210,7 @@ namespace RE
 		bool ShouldHandleEvent(const InputEvent* a_event) override  // 01
 		{
 			using func_t = decltype(&IMenu::ShouldHandleEvent);
-			REL::Relocation<func_t> func{ REL::ID(1241790) };
+			static REL::Relocation<func_t> func{ REL::ID(1241790) };
 			return func(this, a_event);
 		}
 
@@ -262,7 +262,7 @@ namespace RE
 		virtual bool PassesRenderConditionText(MENU_RENDER_CONTEXT a_reason, const BSFixedString& a_customRendererName) const  // 07
 		{
 			using func_t = decltype(&IMenu::PassesRenderConditionText);
-			REL::Relocation<func_t> func{ REL::ID(937304) };
+			static REL::Relocation<func_t> func{ REL::ID(937304) };
 			return func(this, a_reason, a_customRendererName);
 		}
 
@@ -314,7 +314,7 @@ namespace RE
 		void OnSetSafeRect()
 		{
 			using func_t = decltype(&IMenu::OnSetSafeRect);
-			REL::Relocation<func_t> func{ REL::ID(964859) };
+			static REL::Relocation<func_t> func{ REL::ID(964859) };
 			return func(this);
 		}
 
@@ -323,14 +323,14 @@ namespace RE
 		UI_MESSAGE_RESULTS ProcessScaleformEvent(Scaleform::GFx::Movie* a_movie, const IUIMessageData* a_data)
 		{
 			using func_t = decltype(&IMenu::ProcessScaleformEvent);
-			REL::Relocation<func_t> func{ REL::ID(150211) };
+			static REL::Relocation<func_t> func{ REL::ID(150211) };
 			return func(this, a_movie, a_data);
 		}
 
 		void RefreshPlatform()
 		{
 			using func_t = decltype(&IMenu::RefreshPlatform);
-			REL::Relocation<func_t> func{ REL::ID(1071829) };
+			static REL::Relocation<func_t> func{ REL::ID(1071829) };
 			return func(this);
 		}
 
@@ -455,14 +455,14 @@ namespace RE
 		Scaleform::GFx::Value* AcquireFlashObjectByMemberName(const Scaleform::GFx::Value& a_flashObject, const char* a_relativePathToMember)
 		{
 			using func_t = decltype(&BSGFxObject::AcquireFlashObjectByMemberName);
-			REL::Relocation<func_t> func{ REL::ID(1172680) };
+			static REL::Relocation<func_t> func{ REL::ID(1172680) };
 			return func(this, a_flashObject, a_relativePathToMember);
 		}
 
 		Scaleform::GFx::Value* AcquireFlashObjectByPath(const Scaleform::GFx::Movie& a_parentMovie, const char* a_absolutePathToMember)
 		{
 			using func_t = decltype(&BSGFxObject::AcquireFlashObjectByPath);
-			REL::Relocation<func_t> func{ REL::ID(1065592) };
+			static REL::Relocation<func_t> func{ REL::ID(1065592) };
 			return func(this, a_parentMovie, a_absolutePathToMember);
 		}
 	};
@@ -512,7 +512,7 @@ namespace RE
 		void RemoveChild(const BSGFxDisplayObject& a_child) const
 		{
 			using func_t = decltype(&BSGFxDisplayObject::RemoveChild);
-			REL::Relocation<func_t> func{ REL::ID(1229383) };
+			static REL::Relocation<func_t> func{ REL::ID(1229383) };
 			return func(this, a_child);
 		}
 
@@ -581,7 +581,7 @@ namespace RE
 		virtual BSEventNotifyControl ProcessEvent(const ApplyColorUpdateEvent& a_event, BSTEventSource<ApplyColorUpdateEvent>* a_source) override  // 01
 		{
 			using func_t = decltype(&BSGFxShaderFXTarget::ProcessEvent);
-			REL::Relocation<func_t> func{ REL::ID(848563) };
+			static REL::Relocation<func_t> func{ REL::ID(848563) };
 			return func(this, a_event, a_source);
 		}
 
@@ -589,21 +589,21 @@ namespace RE
 		virtual void AppendShaderFXInfos(BSTArray<UIShaderFXInfo>& a_colorFXInfo, BSTArray<UIShaderFXInfo>& a_backgroundFXInfo)  // 02
 		{
 			using func_t = decltype(&BSGFxShaderFXTarget::AppendShaderFXInfos);
-			REL::Relocation<func_t> func{ REL::ID(544646) };
+			static REL::Relocation<func_t> func{ REL::ID(544646) };
 			return func(this, a_colorFXInfo, a_backgroundFXInfo);
 		}
 
 		void CreateAndSetFiltersToHUD(HUDColorTypes a_colorType, float a_scale = 1.0)
 		{
 			using func_t = decltype(&BSGFxShaderFXTarget::CreateAndSetFiltersToHUD);
-			REL::Relocation<func_t> func{ REL::ID(876001) };
+			static REL::Relocation<func_t> func{ REL::ID(876001) };
 			func(this, a_colorType, a_scale);
 		}
 
 		void EnableShadedBackground(HUDColorTypes a_colorType, float a_scale = 1.0)
 		{
 			using func_t = decltype(&BSGFxShaderFXTarget::EnableShadedBackground);
-			REL::Relocation<func_t> func{ REL::ID(278402) };
+			static REL::Relocation<func_t> func{ REL::ID(278402) };
 			func(this, a_colorType, a_scale);
 		}
 
@@ -672,14 +672,14 @@ namespace RE
 		virtual void SetIsTopButtonBar(bool a_isTopButtonBar) override  // 08
 		{
 			using func_t = decltype(&GameMenuBase::SetIsTopButtonBar);
-			REL::Relocation<func_t> func{ REL::ID(1367353) };
+			static REL::Relocation<func_t> func{ REL::ID(1367353) };
 			return func(this, a_isTopButtonBar);
 		}
 
 		virtual void OnMenuDisplayStateChanged() override  // 0A
 		{
 			using func_t = decltype(&GameMenuBase::OnMenuDisplayStateChanged);
-			REL::Relocation<func_t> func{ REL::ID(1274450) };
+			static REL::Relocation<func_t> func{ REL::ID(1274450) };
 			return func(this);
 		}
 
@@ -702,21 +702,21 @@ namespace RE
 		virtual bool CacheShaderFXQuadsForRenderer_Impl() override  // 10
 		{
 			using func_t = decltype(&GameMenuBase::CacheShaderFXQuadsForRenderer_Impl);
-			REL::Relocation<func_t> func{ REL::ID(863029) };
+			static REL::Relocation<func_t> func{ REL::ID(863029) };
 			return func(this);
 		}
 
 		virtual void TransferCachedShaderFXQuadsForRenderer(const BSFixedString& a_rendererName) override  // 11
 		{
 			using func_t = decltype(&GameMenuBase::TransferCachedShaderFXQuadsForRenderer);
-			REL::Relocation<func_t> func{ REL::ID(65166) };
+			static REL::Relocation<func_t> func{ REL::ID(65166) };
 			return func(this, a_rendererName);
 		}
 
 		virtual void SetViewportRect(const NiRect<float>& a_viewportRect) override  // 12
 		{
 			using func_t = decltype(&GameMenuBase::SetViewportRect);
-			REL::Relocation<func_t> func{ REL::ID(1554334) };
+			static REL::Relocation<func_t> func{ REL::ID(1554334) };
 			return func(this, a_viewportRect);
 		}
 
@@ -724,14 +724,14 @@ namespace RE
 		virtual void AppendShaderFXInfos(BSTAlignedArray<UIShaderFXInfo>& a_colorFXInfos, BSTAlignedArray<UIShaderFXInfo>& a_backgroundFXInfos) const  // 13
 		{
 			using func_t = decltype(&GameMenuBase::AppendShaderFXInfos);
-			REL::Relocation<func_t> func{ REL::ID(583584) };
+			static REL::Relocation<func_t> func{ REL::ID(583584) };
 			return func(this, a_colorFXInfos, a_backgroundFXInfos);
 		}
 
 		void SetUpButtonBar(BSGFxShaderFXTarget& a_parentObject, const char* a_buttonBarPath, HUDColorTypes a_colorType)
 		{
 			using func_t = decltype(&GameMenuBase::SetUpButtonBar);
-			REL::Relocation<func_t> func{ REL::ID(531584) };
+			static REL::Relocation<func_t> func{ REL::ID(531584) };
 			func(this, a_parentObject, a_buttonBarPath, a_colorType);
 		}
 
@@ -768,25 +768,25 @@ namespace RE
 		static void ExecuteCommand(const char* a_command)
 		{
 			using func_t = decltype(&Console::ExecuteCommand);
-			REL::Relocation<func_t> func{ REL::ID(1061864) };
+			static REL::Relocation<func_t> func{ REL::ID(1061864) };
 			return func(a_command);
 		}
 
 		[[nodiscard]] static decltype(auto) GetCurrentPickIndex()
 		{
-			REL::Relocation<std::int32_t*> currentPickIndex{ REL::ID(1407033) };
+			static REL::Relocation<std::int32_t*> currentPickIndex{ REL::ID(1407033) };
 			return *currentPickIndex;
 		}
 
 		[[nodiscard]] static decltype(auto) GetPickRef()
 		{
-			REL::Relocation<ObjectRefHandle*> ref{ REL::ID(170742) };
+			static REL::Relocation<ObjectRefHandle*> ref{ REL::ID(170742) };
 			return *ref;
 		}
 
 		[[nodiscard]] static decltype(auto) GetPickRefs()
 		{
-			REL::Relocation<BSTArray<ObjectRefHandle>*> pickRefs{ REL::ID(875116) };
+			static REL::Relocation<BSTArray<ObjectRefHandle>*> pickRefs{ REL::ID(875116) };
 			return *pickRefs;
 		}
 
@@ -802,7 +802,7 @@ namespace RE
 		void SetCurrentPickREFR(stl::not_null<ObjectRefHandle*> a_refr)
 		{
 			using func_t = decltype(&Console::SetCurrentPickREFR);
-			REL::Relocation<func_t> func{ REL::ID(79066) };
+			static REL::Relocation<func_t> func{ REL::ID(79066) };
 			return func(this, a_refr);
 		}
 
@@ -857,7 +857,7 @@ namespace RE
 		void ClearModel()
 		{
 			using func_t = decltype(&Inventory3DManager::ClearModel);
-			REL::Relocation<func_t> func{ REL::ID(63218) };
+			static REL::Relocation<func_t> func{ REL::ID(63218) };
 			return func(this);
 		}
 
@@ -970,14 +970,14 @@ namespace RE
 		void CheckAndSetItemForPlacement()
 		{
 			using func_t = decltype(&WorkshopMenu::CheckAndSetItemForPlacement);
-			REL::Relocation<func_t> func{ REL::ID(1541862) };
+			static REL::Relocation<func_t> func{ REL::ID(1541862) };
 			return func(this);
 		}
 
 		void UpdateButtonText()
 		{
 			using func_t = decltype(&WorkshopMenu::UpdateButtonText);
-			REL::Relocation<func_t> func{ REL::ID(1089189) };
+			static REL::Relocation<func_t> func{ REL::ID(1089189) };
 			return func(this);
 		}
 
@@ -1019,7 +1019,7 @@ namespace RE
 		BSEventNotifyControl ProcessEvent(const PipboyValueChangedEvent& a_event, BSTEventSource<PipboyValueChangedEvent>* a_source) override
 		{
 			using func_t = decltype(&PipboySubMenu::ProcessEvent);
-			REL::Relocation<func_t> func{ REL::ID(893703) };
+			static REL::Relocation<func_t> func{ REL::ID(893703) };
 			return func(this, a_event, a_source);
 		}
 
@@ -1043,7 +1043,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyStatsMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(332518) };
+			static REL::Relocation<func_t> func{ REL::ID(332518) };
 			return func(this);
 		}
 
@@ -1063,7 +1063,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboySpecialMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(1426810) };
+			static REL::Relocation<func_t> func{ REL::ID(1426810) };
 			return func(this);
 		}
 	};
@@ -1080,7 +1080,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyPerksMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(783380) };
+			static REL::Relocation<func_t> func{ REL::ID(783380) };
 			return func(this);
 		}
 	};
@@ -1097,7 +1097,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyInventoryMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(762897) };
+			static REL::Relocation<func_t> func{ REL::ID(762897) };
 			return func(this);
 		}
 	};
@@ -1114,7 +1114,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyQuestMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(1495929) };
+			static REL::Relocation<func_t> func{ REL::ID(1495929) };
 			return func(this);
 		}
 	};
@@ -1131,7 +1131,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyWorkshopMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(1370368) };
+			static REL::Relocation<func_t> func{ REL::ID(1370368) };
 			return func(this);
 		}
 	};
@@ -1148,7 +1148,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyLogMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(672256) };
+			static REL::Relocation<func_t> func{ REL::ID(672256) };
 			return func(this);
 		}
 	};
@@ -1175,7 +1175,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyMapMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(92696) };
+			static REL::Relocation<func_t> func{ REL::ID(92696) };
 			return func(this);
 		}
 
@@ -1201,7 +1201,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyRadioMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(713423) };
+			static REL::Relocation<func_t> func{ REL::ID(713423) };
 			return func(this);
 		}
 
@@ -1220,7 +1220,7 @@ namespace RE
 		void UpdateData() override
 		{
 			using func_t = decltype(&PipboyPlayerInfoMenu::UpdateData);
-			REL::Relocation<func_t> func{ REL::ID(426990) };
+			static REL::Relocation<func_t> func{ REL::ID(426990) };
 			return func(this);
 		}
 	};
@@ -1337,7 +1337,7 @@ namespace RE
 			void IncrementSort()
 			{
 				using func_t = decltype(&ItemSorter::IncrementSort);
-				REL::Relocation<func_t> func{ REL::ID(1307263) };
+				static REL::Relocation<func_t> func{ REL::ID(1307263) };
 				return func(this);
 			}
 
@@ -1425,7 +1425,7 @@ namespace RE
 		void TakeAllItems()
 		{
 			using func_t = decltype(&ContainerMenu::TakeAllItems);
-			REL::Relocation<func_t> func{ REL::ID(1323703) };
+			static REL::Relocation<func_t> func{ REL::ID(1323703) };
 			return func(this);
 		}
 
@@ -1479,21 +1479,21 @@ namespace RE
 		void ClearTradingData()
 		{
 			using func_t = decltype(&BarterMenu::ClearTradingData);
-			REL::Relocation<func_t> func{ REL::ID(1112285) };
+			static REL::Relocation<func_t> func{ REL::ID(1112285) };
 			return func(this);
 		}
 
 		void CompleteTrade()
 		{
 			using func_t = decltype(&BarterMenu::CompleteTrade);
-			REL::Relocation<func_t> func{ REL::ID(379932) };
+			static REL::Relocation<func_t> func{ REL::ID(379932) };
 			return func(this);
 		}
 
 		[[nodiscard]] std::int64_t GetCapsOwedByPlayer()
 		{
 			using func_t = decltype(&BarterMenu::GetCapsOwedByPlayer);
-			REL::Relocation<func_t> func{ REL::ID(672405) };
+			static REL::Relocation<func_t> func{ REL::ID(672405) };
 			return func(this);
 		}
 
@@ -1526,7 +1526,7 @@ namespace RE
 		void ShowMessage()
 		{
 			using func_t = decltype(&MessageBoxMenu::ShowMessage);
-			REL::Relocation<func_t> func{ REL::ID(442479) };
+			static REL::Relocation<func_t> func{ REL::ID(442479) };
 			return func(this);
 		}
 
@@ -1821,21 +1821,21 @@ namespace RE
 		void BuildWeaponScrappingArray()
 		{
 			using func_t = decltype(&ExamineMenu::BuildWeaponScrappingArray);
-			REL::Relocation<func_t> func{ REL::ID(646841) };
+			static REL::Relocation<func_t> func{ REL::ID(646841) };
 			return func(this);
 		}
 
 		[[nodiscard]] std::uint32_t GetSelectedIndex()
 		{
 			using func_t = decltype(&ExamineMenu::GetSelectedIndex);
-			REL::Relocation<func_t> func{ REL::ID(776503) };
+			static REL::Relocation<func_t> func{ REL::ID(776503) };
 			return func(this);
 		}
 
 		void ShowConfirmMenu(ExamineConfirmMenu::InitData* a_data, ExamineConfirmMenu::ICallback* a_callback)
 		{
 			using func_t = decltype(&ExamineMenu::ShowConfirmMenu);
-			REL::Relocation<func_t> func{ REL::ID(443081) };
+			static REL::Relocation<func_t> func{ REL::ID(443081) };
 			return func(this, a_data, a_callback);
 		}
 
@@ -1911,7 +1911,7 @@ namespace RE
 		static void OpenLockpickingMenu(TESObjectREFR* a_lockedRef)
 		{
 			using func_t = decltype(&LockpickingMenu::OpenLockpickingMenu);
-			REL::Relocation<func_t> func{ REL::ID(129892) };
+			static REL::Relocation<func_t> func{ REL::ID(129892) };
 			return func(a_lockedRef);
 		}
 
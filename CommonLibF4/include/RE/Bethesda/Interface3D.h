@@ -124,42 +124,42 @@ namespace RE
 			[[nodiscard]] static Renderer* Create(const BSFixedString& a_name, UI_DEPTH_PRIORITY a_depth, float a_fov, bool a_alwaysrender)
 			{
 				using func_t = decltype(&Renderer::Create);
-				REL::Relocation<func_t> func{ REL::ID(88488) };
+				static REL::Relocation<func_t> func{ REL::ID(88488) };
 				return func(a_name, a_depth, a_fov, a_alwaysrender);
 			}
 
 			[[nodiscard]] static Renderer* GetByName(const BSFixedString& a_name)
 			{
 				using func_t = decltype(&Renderer::GetByName);
-				REL::Relocation<func_t> func{ REL::ID(140387) };
+				static REL::Relocation<func_t> func{ REL::ID(140387) };
 				return func(a_name);
 			}
 
 			void Enable(bool a_unhideGeometries = false)
 			{
 				using func_t = decltype(&Renderer::Enable);
-				REL::Relocation<func_t> func{ REL::ID(326895) };
+				static REL::Relocation<func_t> func{ REL::ID(326895) };
 				return func(this, a_unhideGeometries);
 			}
 
 			void Disable()
 			{
 				using func_t = decltype(&Renderer::Disable);
-				REL::Relocation<func_t> func{ REL::ID(938370) };
+				static REL::Relocation<func_t> func{ REL::ID(938370) };
 				return func(this);
 			}
 
 			void Release()
 			{
 				using func_t = decltype(&Renderer::Release);
-				REL::Relocation<func_t> func{ REL::ID(74749) };
+				static REL::Relocation<func_t> func{ REL::ID(74749) };
 				return func(this);
 			}
 
 			void SetViewport(Scaleform::GFx::Movie& a_movie, NiRect<float> const& a_viewport)
 			{
 				using func_t = decltype(&Renderer::SetViewport);
-				REL::Relocation<func_t> func{ REL::ID(825410) };
+				static REL::Relocation<func_t> func{ REL::ID(825410) };
 				return func(this, a_movie, a_viewport);
 			}
 
@@ -179,7 +179,7 @@ namespace RE
 
 			void Highlight_SetElement(NiAVObject* a_object, bool a_highlightOffscreen) {
 				using func_t = decltype(&Renderer::Highlight_SetElement);
-				REL::Relocation<func_t> func{ REL::ID(1291591) };
+				static REL::Relocation<func_t> func{ REL::ID(1291591) };
 				return func(this, a_object, a_highlightOffscreen);
 			}
 
@@ -188,49 +188,49 @@ namespace RE
 			void MainScreen_AddPointLight(NiPoint3 a_position, NiColor a_diffuse, float a_specular, float a_dimmer)
 			{
 				using func_t = decltype(&Renderer::MainScreen_AddPointLight);
-				REL::Relocation<func_t> func{ REL::ID(1335675) };
+				static REL::Relocation<func_t> func{ REL::ID(1335675) };
 				return func(this, a_position, a_diffuse, a_specular, a_dimmer);
 			}
 
 			void MainScreen_AddSpotLight(NiPoint3 a_position, NiPoint3 a_target, NiAVObject* a_object, float a_FOV, NiColor a_diffuse, float a_specular, float a_dimmer, bool unk)
 			{
 				using func_t = decltype(&Renderer::MainScreen_AddSpotLight);
-				REL::Relocation<func_t> func{ REL::ID(1056093) };
+				static REL::Relocation<func_t> func{ REL::ID(1056093) };
 				return func(this, a_position, a_target, a_object, a_FOV, a_diffuse, a_specular, a_dimmer, unk);
 			}
 
 			void MainScreen_EnableScreenAttached3DMasking(char const* a_geometry, char const* a_material)
 			{
 				using func_t = decltype(&Renderer::MainScreen_EnableScreenAttached3DMasking);
-				REL::Relocation<func_t> func{ REL::ID(1201550) };
+				static REL::Relocation<func_t> func{ REL::ID(1201550) };
 				return func(this, a_geometry, a_material);
 			}
 
 			void MainScreen_RegisterGeometryRequiringFullViewport(NiAVObject* a_object)
 			{
 				using func_t = decltype(&Renderer::MainScreen_RegisterGeometryRequiringFullViewport);
-				REL::Relocation<func_t> func{ REL::ID(897225) };
+				static REL::Relocation<func_t> func{ REL::ID(897225) };
 				return func(this, a_object);
 			}
 
 			void MainScreen_SetBackgroundMode(BackgroundMode a_mode)
 			{
 				using func_t = decltype(&Renderer::MainScreen_SetBackgroundMode);
-				REL::Relocation<func_t> func{ REL::ID(378876) };
+				static REL::Relocation<func_t> func{ REL::ID(378876) };
 				return func(this, a_mode);
 			}
 
 			void MainScreen_SetScreenAttached3D(NiAVObject* a_object)
 			{
 				using func_t = decltype(&Renderer::MainScreen_SetScreenAttached3D);
-				REL::Relocation<func_t> func{ REL::ID(817727) };
+				static REL::Relocation<func_t> func{ REL::ID(817727) };
 				return func(this, a_object);
 			}
 
 			void MainScreen_SetWorldAttached3D(NiAVObject* a_object)
 			{
 				using func_t = decltype(&Renderer::MainScreen_SetWorldAttached3D);
-				REL::Relocation<func_t> func{ REL::ID(724778) };
+				static REL::Relocation<func_t> func{ REL::ID(724778) };
 				return func(this, a_object);
 			}
 
@@ -239,35 +239,35 @@ namespace RE
 			void Offscreen_AddLight(NiPoint3 a_position, NiColor a_diffuse, NiColor a_specular, float a_dimmer)
 			{
 				using func_t = decltype(&Renderer::Offscreen_AddLight);
-				REL::Relocation<func_t> func{ REL::ID(1267198) };
+				static REL::Relocation<func_t> func{ REL::ID(1267198) };
 				return func(this, a_position, a_diffuse, a_specular, a_dimmer);
 			}
 
 			void Offscreen_Clear3D()
 			{
 				using func_t = decltype(&Renderer::Offscreen_Clear3D);
-				REL::Relocation<func_t> func{ REL::ID(1533262) };
+				static REL::Relocation<func_t> func{ REL::ID(1533262) };
 				return func(this);
 			}
 
 			void Offscreen_ClearLights()
 			{
 				using func_t = decltype(&Renderer::Offscreen_ClearLights);
-				REL::Relocation<func_t> func{ REL::ID(1039253) };
+				static REL::Relocation<func_t> func{ REL::ID(1039253) };
 				return func(this);
 			}
 
 			void Offscreen_Enable3D(bool a_enable)
 			{
 				using func_t = decltype(&Renderer::Offscreen_Enable3D);
-				REL::Relocation<func_t> func{ REL::ID(1107859), 0x10 };
+				static REL::Relocation<func_t> func{ REL::ID(1107859), 0x10 };
 				return func(this, a_enable);
 			}
 
 			OldScreenEffectControl& Offscreen_QPipboyEffectControl()
 			{
 				using func_t = decltype(&Renderer::Offscreen_QPipboyEffectControl);
-				REL::Relocation<func_t> func{ REL::ID(852814) };
+				static REL::Relocation<func_t> func{ REL::ID(852814) };
 				return func(this);
 			}
 
@@ -277,42 +277,42 @@ namespace RE
 			void Offscreen_Set3D(NiAVObject* a_object)
 			{
 				using func_t = decltype(&Renderer::Offscreen_Set3D);
-				REL::Relocation<func_t> func{ REL::ID(43983) };
+				static REL::Relocation<func_t> func{ REL::ID(43983) };
 				return func(this, a_object);
 			}
 
 			void Offscreen_SetDisplayMode(ScreenMode a_mode, char const* a_geometry, char const* a_material)
 			{
 				using func_t = decltype(&Renderer::Offscreen_SetDisplayMode);
-				REL::Relocation<func_t> func{ REL::ID(576234) };
+				static REL::Relocation<func_t> func{ REL::ID(576234) };
 				return func(this, a_mode, a_geometry, a_material);
 			}
 
 			void Offscreen_SetPostEffect(PostEffect a_effect)
 			{
 				using func_t = decltype(&Renderer::Offscreen_SetPostEffect);
-				REL::Relocation<func_t> func{ REL::ID(1187686) };
+				static REL::Relocation<func_t> func{ REL::ID(1187686) };
 				return func(this, a_effect);
 			}
 
 			void Offscreen_SetRenderTargetSize(OffscreenMenuSize a_size)
 			{
 				using func_t = decltype(&Renderer::Offscreen_SetRenderTargetSize);
-				REL::Relocation<func_t> func{ REL::ID(1547000) };
+				static REL::Relocation<func_t> func{ REL::ID(1547000) };
 				return func(this, a_size);
 			}
 
 			void Oddscreen_SetUseLongRangeCamera(bool a_enable)
 			{
 				using func_t = decltype(&Renderer::Oddscreen_SetUseLongRangeCamera);
-				REL::Relocation<func_t> func{ REL::ID(1544159), 0x30 };
+				static REL::Relocation<func_t> func{ REL::ID(1544159), 0x30 };
 				return func(this, a_enable);
 			}
 
 			void Offscreen_UseCustomRenderTarget(const std::int32_t& a_target, std::int32_t a_swapTarget)
 			{
 				using func_t = decltype(&Renderer::Offscreen_UseCustomRenderTarget);
-				REL::Relocation<func_t> func{ REL::ID(152177), 0x15 };
+				static REL::Relocation<func_t> func{ REL::ID(152177), 0x15 };
 				return func(this, a_target, a_swapTarget);
 			}
 
@@ -24,7 +24,7 @@ namespace RE
 				float a_compareDamage = FLT_MAX)
 			{
 				using func_t = decltype(&detail::AddItemCardInfoEntry);
-				REL::Relocation<func_t> func{ REL::ID(489521) };
+				static REL::Relocation<func_t> func{ REL::ID(489521) };
 				return func(a_array, a_newEntry, a_textID, a_value, a_difference, a_totalDamage, a_compareDamage);
 			}
 		}
@@ -51,7 +51,7 @@ namespace RE
 		inline void GetEffectDisplayInfo(MagicItem* a_item, EffectItem* a_effect, float& a_magnitude, float& a_duration)
 		{
 			using func_t = decltype(&StatsMenuUtils::GetEffectDisplayInfo);
-			REL::Relocation<func_t> func{ REL::ID(294691) };
+			static REL::Relocation<func_t> func{ REL::ID(294691) };
 			return func(a_item, a_effect, a_magnitude, a_duration);
 		}
 	}
@@ -63,14 +63,14 @@ namespace RE
 		inline void GetComparisonItems(const TESBoundObject* a_object, ComparisonItems& a_comparisonItems)
 		{
 			using func_t = decltype(&GetComparisonItems);
-			REL::Relocation<func_t> func{ REL::ID(593818) };
+			static REL::Relocation<func_t> func{ REL::ID(593818) };
 			return func(a_object, a_comparisonItems);
 		}
 
 		inline void PlayMenuSound(const char* a_soundName)
 		{
 			using func_t = decltype(&PlayMenuSound);
-			REL::Relocation<func_t> func{ REL::ID(1227993) };
+			static REL::Relocation<func_t> func{ REL::ID(1227993) };
 			return func(a_soundName);
 		}
 	}
@@ -27,7 +27,7 @@ namespace RE
 		void GetDescription(BSStringT<char>* a_buffer, const char* a_beginTagFormat, const char* a_endTagFormat, float a_magnitude, float a_duration)
 		{
 			using func_t = decltype(&EffectItem::GetDescription);
-			REL::Relocation<func_t> func{ REL::ID(949839) };
+			static REL::Relocation<func_t> func{ REL::ID(949839) };
 			return func(this, a_buffer, a_beginTagFormat, a_endTagFormat, a_magnitude, a_duration);
 		}
 
@@ -46,49 +46,49 @@ namespace RE
 
 		[[nodiscard]] static Main* GetSingleton()
 		{
-			REL::Relocation<Main**> singleton{ REL::ID(756304) };
+			static REL::Relocation<Main**> singleton{ REL::ID(756304) };
 			return *singleton;
 		}
 
 		[[nodiscard]] static BSPortalGraphEntry* GetCameraPortalGraphEntry()
 		{
 			using func_t = decltype(&Main::GetCameraPortalGraphEntry);
-			REL::Relocation<func_t> func{ REL::ID(515799) };
+			static REL::Relocation<func_t> func{ REL::ID(515799) };
 			return func();
 		}
 
 		[[nodiscard]] static BSMultiBoundRoom* GetCameraRootMultiBound()
 		{
 			using func_t = decltype(&Main::GetCameraRootMultiBound);
-			REL::Relocation<func_t> func{ REL::ID(1220834) };
+			static REL::Relocation<func_t> func{ REL::ID(1220834) };
 			return func();
 		}
 
 		[[nodiscard]] static SceneGraph* GetWorldSceneGraph()
 		{
 			using func_t = decltype(&Main::GetWorldSceneGraph);
-			REL::Relocation<func_t> func{ REL::ID(1376648), 0x30 };
+			static REL::Relocation<func_t> func{ REL::ID(1376648), 0x30 };
 			return func();
 		}
 
 		[[nodiscard]] static NiNode* WeatherRootNode()
 		{
 			using func_t = decltype(&Main::WeatherRootNode);
-			REL::Relocation<func_t> func{ REL::ID(1246373), 0x4 };
+			static REL::Relocation<func_t> func{ REL::ID(1246373), 0x4 };
 			return func();
 		}
 
 		[[nodiscard]] static NiCamera* WorldRootCamera()
 		{
 			using func_t = decltype(&Main::WorldRootCamera);
-			REL::Relocation<func_t> func{ REL::ID(384264) };
+			static REL::Relocation<func_t> func{ REL::ID(384264) };
 			return func();
 		}
 
 		[[nodiscard]] static NiNode* WorldRootNode()
 		{
 			using func_t = decltype(&Main::WorldRootNode);
-			REL::Relocation<func_t> func{ REL::ID(407532), 0xC };
+			static REL::Relocation<func_t> func{ REL::ID(407532), 0xC };
 			return func();
 		}
 
@@ -122,7 +122,7 @@ namespace RE
 
 	BSTimer& GetAppTimer()
 	{
-		REL::Relocation<BSTimer*> appTimer{ REL::ID(1013228) };
+		static REL::Relocation<BSTimer*> appTimer{ REL::ID(1013228) };
 		return *appTimer;
 	}
 }
@@ -95,35 +95,35 @@ namespace RE
 
 		[[nodiscard]] static PipboyManager* GetSingleton()
 		{
-			REL::Relocation<PipboyManager**> singleton{ REL::ID(553234) };
+			static REL::Relocation<PipboyManager**> singleton{ REL::ID(553234) };
 			return *singleton;
 		}
 
 		void LowerPipboy(LOWER_REASON a_reason)
 		{
 			using func_t = decltype(&PipboyManager::LowerPipboy);
-			REL::Relocation<func_t> func{ REL::ID(1444875) };
+			static REL::Relocation<func_t> func{ REL::ID(1444875) };
 			return func(this, a_reason);
 		}
 
 		void RaisePipboy()
 		{
 			using func_t = decltype(&PipboyManager::RaisePipboy);
-			REL::Relocation<func_t> func{ REL::ID(726763) };
+			static REL::Relocation<func_t> func{ REL::ID(726763) };
 			return func(this);
 		}
 
 		void RefreshPipboyRenderSurface()
 		{
 			using func_t = decltype(&PipboyManager::RefreshPipboyRenderSurface);
-			REL::Relocation<func_t> func{ REL::ID(81339) };
+			static REL::Relocation<func_t> func{ REL::ID(81339) };
 			return func(this);
 		}
 
 		void UpdateCursorConstraint(bool a_enable)
 		{
 			using func_t = decltype(&PipboyManager::UpdateCursorConstraint);
-			REL::Relocation<func_t> func{ REL::ID(900802) };
+			static REL::Relocation<func_t> func{ REL::ID(900802) };
 			return func(this, a_enable);
 		}
 
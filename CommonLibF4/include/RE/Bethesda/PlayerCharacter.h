@@ -231,14 +231,14 @@ namespace RE
 			void ctor(bool a_suppressMessages, bool a_suppressAudio)
 			{
 				using func_t = decltype(&ScopedInventoryChangeMessageContext::ctor);
-				REL::Relocation<func_t> func{ REL::ID(1512872) };
+				static REL::Relocation<func_t> func{ REL::ID(1512872) };
 				return func(this, a_suppressMessages, a_suppressAudio);
 			}
 
 			void dtor()
 			{
 				using func_t = decltype(&ScopedInventoryChangeMessageContext::dtor);
-				REL::Relocation<func_t> func{ REL::ID(542100) };
+				static REL::Relocation<func_t> func{ REL::ID(542100) };
 				return func(this);
 			}
 		};
@@ -252,62 +252,62 @@ namespace RE
 
 		[[nodiscard]] static PlayerCharacter* GetSingleton()
 		{
-			REL::Relocation<NiPointer<PlayerCharacter>*> singleton{ REL::ID(303410) };
+			static REL::Relocation<NiPointer<PlayerCharacter>*> singleton{ REL::ID(303410) };
 			return singleton->get();
 		}
 
 		[[nodiscard]] static PlayerCharacter* GetSingletonPtr()
 		{
-			REL::Relocation<PlayerCharacter**> singleton{ REL::ID(303410) };
+			static REL::Relocation<PlayerCharacter**> singleton{ REL::ID(303410) };
 			return *singleton;
 		}
 
 		TESAmmo* GetCurrentAmmo()
 		{
 			using func_t = decltype(&PlayerCharacter::GetCurrentAmmo);
-			REL::Relocation<func_t> func{ REL::ID(660416), 0x10 };
+			static REL::Relocation<func_t> func{ REL::ID(660416), 0x10 };
 			return func(this);
 		}
 
 		std::uint32_t GetCurrentAmmoCount()
 		{
 			using func_t = decltype(&PlayerCharacter::GetCurrentAmmoCount);
-			REL::Relocation<func_t> func{ REL::ID(293822), 0x23 };
+			static REL::Relocation<func_t> func{ REL::ID(293822), 0x23 };
 			return func(this);
 		}
 
 		BGSObjectInstanceT<TESObjectWEAP> GetCurrentWeapon()
 		{
 			using func_t = decltype(&PlayerCharacter::GetCurrentWeapon);
-			REL::Relocation<func_t> func{ REL::ID(832872) };
+			static REL::Relocation<func_t> func{ REL::ID(832872) };
 			return func(this);
 		}
 
 		void RemoveLastUsedPowerArmor()
 		{
 			using func_t = decltype(&PlayerCharacter::RemoveLastUsedPowerArmor);
-			REL::Relocation<func_t> func{ REL::ID(1488486) };
+			static REL::Relocation<func_t> func{ REL::ID(1488486) };
 			return func(this);
 		}
 
 		void SelectPerk(std::uint32_t a_formID, std::int8_t a_rank = 0)
 		{
 			using func_t = decltype(&PlayerCharacter::SelectPerk);
-			REL::Relocation<func_t> func{ REL::ID(1397326) };
+			static REL::Relocation<func_t> func{ REL::ID(1397326) };
 			return func(this, a_formID, a_rank);
 		}
 
 		void SetAutoReload(bool a_auto)
 		{
 			using func_t = decltype(&PlayerCharacter::SetAutoReload);
-			REL::Relocation<func_t> func{ REL::ID(1232532), 0x60 };
+			static REL::Relocation<func_t> func{ REL::ID(1232532), 0x60 };
 			return func(this, a_auto);
 		}
 
 		void SetEscaping(bool a_flag, bool a_escaped)
 		{
 			using func_t = decltype(&PlayerCharacter::SetEscaping);
-			REL::Relocation<func_t> func{ REL::ID(25528) };
+			static REL::Relocation<func_t> func{ REL::ID(25528) };
 			return func(this, a_flag, a_escaped);
 		}
 
@@ -135,7 +135,7 @@ namespace RE
 		PlayerInputHandler* ctor(PlayerControlsData& a_data)
 		{
 			using func_t = decltype(&PlayerInputHandler::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1240396), 0xC0 };
+			static REL::Relocation<func_t> func{ REL::ID(1240396), 0xC0 };
 			return func(this, a_data);
 		}
 	};
@@ -166,7 +166,7 @@ namespace RE
 		HeldStateHandler* ctor(PlayerControlsData& a_data)
 		{
 			using func_t = decltype(&HeldStateHandler::ctor);
-			REL::Relocation<func_t> func{ REL::ID(908502), 0xD0 };
+			static REL::Relocation<func_t> func{ REL::ID(908502), 0xD0 };
 			return func(this, a_data);
 		}
 	};
@@ -221,7 +221,7 @@ namespace RE
 		AttackBlockHandler* ctor(PlayerControlsData& a_data)
 		{
 			using func_t = decltype(&AttackBlockHandler::ctor);
-			REL::Relocation<func_t> func{ REL::ID(908502) };
+			static REL::Relocation<func_t> func{ REL::ID(908502) };
 			return func(this, a_data);
 		}
 	};
@@ -261,7 +261,7 @@ namespace RE
 		ReadyWeaponHandler* ctor(PlayerControlsData& a_data)
 		{
 			using func_t = decltype(&ReadyWeaponHandler::ctor);
-			REL::Relocation<func_t> func{ REL::ID(590232), 0211 };
+			static REL::Relocation<func_t> func{ REL::ID(590232), 0211 };
 			return func(this, a_data);
 		}
 	};
@@ -290,14 +290,14 @@ namespace RE
 
 		static PlayerControls* GetSingleton()
 		{
-			REL::Relocation<PlayerControls**> singleton{ REL::ID(544871) };
+			static REL::Relocation<PlayerControls**> singleton{ REL::ID(544871) };
 			return *singleton;
 		}
 
 		bool DoAction(DEFAULT_OBJECT a_action, ActionInput::ACTIONPRIORITY a_priority)
 		{
 			using func_t = decltype(&PlayerControls::DoAction);
-			REL::Relocation<func_t> func{ REL::ID(818081) };
+			static REL::Relocation<func_t> func{ REL::ID(818081) };
 			return func(this, a_action, a_priority);
 		}
 
@@ -335,7 +335,7 @@ namespace RE
 		void DoRegisterHandler(PlayerInputHandler* a_handler, bool a_isHeldStateHandler)
 		{
 			using func_t = decltype(&PlayerControls::DoRegisterHandler);
-			REL::Relocation<func_t> func{ REL::ID(177801) };
+			static REL::Relocation<func_t> func{ REL::ID(177801) };
 			return func(this, a_handler, a_isHeldStateHandler);
 		}
 	};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "RE/Bethesda/CRC.h"
+
+namespace RE
+{
+	class TESFile;
+
+	struct TESFileCollection;
+
+	namespace detail
+	{
+		// the loaded plugins, indexed by name, each with its masters resolved up front. a catalog is never
+		// changed once built; a new one replaces it when the game's file collection changes
+		template <class File>
+		class BasicPluginCatalog
+		{
+		public:
+			using file_type = File;
+
+			BasicPluginCatalog(
+				std::span<File* const> a_files,
+				std::span<File* const> a_lightFiles,
+				std::uint64_t a_generation) :
+				_files(a_files.begin(), a_files.end()),
+				_lightFiles(a_lightFiles.begin(), a_lightFiles.end()),
+				_generation(a_generation)
+			{
+				_index.reserve(_files.size() + _lightFiles.size());
+				for (const auto files : { std::span{ _files }, std::span{ _lightFiles } }) {
+					for (const auto file : files) {
+						if (file) {
+							index(file);
+						}
+					}
+				}
+			}
+
+			// counts up with every rebuild, for anything derived from a catalog to tell when it is stale
+			[[nodiscard]] std::uint64_t generation() const noexcept { return _generation; }
+
+			[[nodiscard]] std::span<File* const> files() const noexcept { return _files; }
+			[[nodiscard]] std::span<File* const> light_files() const noexcept { return _lightFiles; }
+			[[nodiscard]] std::size_t size() const noexcept { return _index.size(); }
+
+			[[nodiscard]] File* find(std::string_view a_name) const noexcept
+			{
+				const auto it = _index.find(a_name);
+				return it != _index.end() ? it->second.file : nullptr;
+			}
+
+			// the masters the file was built against, without the ones the game could not resolve
+			[[nodiscard]] std::span<File* const> masters(std::string_view a_name) const noexcept
+			{
+				const auto it = _index.find(a_name);
+				return it != _index.end() ?
+                           std::span{ _masters }.subspan(it->second.first, it->second.count) :
+                           std::span<File* const>{};
+			}
+
+		private:
+			struct entry_t
+			{
+			public:
+				// members
+				File* file{ nullptr };
+				std::uint32_t first{ 0 };
+				std::uint32_t count{ 0 };
+			};
+
+			// plugin names compare without case, as the game's do
+			struct hasher
+			{
+			public:
+				[[nodiscard]] std::size_t operator()(std::string_view a_name) const noexcept
+				{
+					return CRC32::update_lower(0, a_name);
+				}
+			};
+
+			struct key_equal
+			{
+			public:
+				[[nodiscard]] bool operator()(std::string_view a_lhs, std::string_view a_rhs) const noexcept
+				{
+					return std::ranges::equal(a_lhs, a_rhs, [](char a_l, char a_r) {
+						return lower(a_l) == lower(a_r);
+					});
+				}
+			};
+
+			[[nodiscard]] static std::uint8_t lower(char a_char) noexcept
+			{
+				return static_cast<std::uint8_t>(std::tolower(static_cast<unsigned char>(a_char)));
+			}
+
+			void index(File* a_file)
+			{
+				entry_t entry{ a_file, static_cast<std::uint32_t>(_masters.size()), 0 };
+				for (const auto master : std::span{ a_file->masterPtrs, a_file->masterCount }) {
+					if (master) {
+						_masters.push_back(master);
+						++entry.count;
+					}
+				}
+				_index.emplace(std::string_view{ a_file->filename }, entry);
+			}
+
+			// members
+			std::vector<File*> _files;
+			std::vector<File*> _lightFiles;
+			std::vector<File*> _masters;
+			std::unordered_map<std::string_view, entry_t, hasher, key_equal> _index;
+			std::uint64_t _generation;
+		};
+	}
+
+	class PluginCatalog :
+		public detail::BasicPluginCatalog<TESFile>
+	{
+	private:
+		using super = detail::BasicPluginCatalog<TESFile>;
+
+	public:
+		// the catalog of what the game has loaded, rebuilt on the first call after its file collection
+		// changes, or nullptr before there is a data handler. a catalog is never freed once handed out, so
+		// the pointer stays good for as long as the caller likes
+		[[nodiscard]] static const PluginCatalog* GetSingleton();
+
+	private:
+		// the collection's arrays are only ever appended to or reallocated as plugins load, so where they
+		// are and how long they are is enough to tell a change
+		struct fingerprint_t
+		{
+		public:
+			[[nodiscard]] friend bool operator==(const fingerprint_t&, const fingerprint_t&) = default;
+
+			// members
+			const void* files{ nullptr };
+			std::size_t filesSize{ 0 };
+			const void* lightFiles{ nullptr };
+			std::size_t lightFilesSize{ 0 };
+		};
+
+		PluginCatalog(const TESFileCollection& a_collection, std::uint64_t a_generation);
+
+		[[nodiscard]] static fingerprint_t GetFingerprint(const TESFileCollection& a_collection) noexcept;
+
+		// members
+		fingerprint_t _fingerprint;
+	};
+}
@@ -23,7 +23,7 @@ namespace RE
 		[[nodiscard]] inline bool ActorInPowerArmor(const Actor& a_actor)
 		{
 			using func_t = decltype(&ActorInPowerArmor);
-			REL::Relocation<func_t> func{ REL::ID(1176757) };
+			static REL::Relocation<func_t> func{ REL::ID(1176757) };
 			return func(a_actor);
 		}
 
@@ -35,28 +35,28 @@ namespace RE
 		[[nodiscard]] inline BGSKeyword* GetArmorKeyword()
 		{
 			using func_t = decltype(&GetArmorKeyword);
-			REL::Relocation<func_t> func{ REL::ID(961172) };
+			static REL::Relocation<func_t> func{ REL::ID(961172) };
 			return func();
 		}
 
 		[[nodiscard]] inline BGSKeyword* GetBatteryKeyword()
 		{
 			using func_t = decltype(&GetBatteryKeyword);
-			REL::Relocation<func_t> func{ REL::ID(1493537) };
+			static REL::Relocation<func_t> func{ REL::ID(1493537) };
 			return func();
 		}
 
 		[[nodiscard]] inline TESAmmo* GetDefaultBatteryObject()
 		{
 			using func_t = decltype(&GetDefaultBatteryObject);
-			REL::Relocation<func_t> func{ REL::ID(1279247) };
+			static REL::Relocation<func_t> func{ REL::ID(1279247) };
 			return func();
 		}
 
 		inline void SyncFurnitureVisualsToInventory(TESObjectREFR* a_furniture, bool a_force3DUpdate, BGSInventoryItem* a_tempItemToAdd, bool a_hideCore)
 		{
 			using func_t = decltype(&SyncFurnitureVisualsToInventory);
-			REL::Relocation<func_t> func{ REL::ID(1078979) };
+			static REL::Relocation<func_t> func{ REL::ID(1078979) };
 			return func(a_furniture, a_force3DUpdate, a_tempItemToAdd, a_hideCore);
 		}
 
@@ -83,7 +83,7 @@ namespace RE
 
 		[[nodiscard]] static PowerArmorGeometry* GetSingleton()
 		{
-			REL::Relocation<PowerArmorGeometry**> singleton{ REL::ID(1365745) };
+			static REL::Relocation<PowerArmorGeometry**> singleton{ REL::ID(1365745) };
 			return *singleton;
 		}
 
@@ -23,14 +23,14 @@ namespace RE
 		void MapCodeMethodToASFunction(const char* a_functionName, std::int32_t a_functionID)
 		{
 			using func_t = decltype(&SWFToCodeFunctionHandler::MapCodeMethodToASFunction);
-			REL::Relocation<func_t> func{ REL::ID(1263128) };
+			static REL::Relocation<func_t> func{ REL::ID(1263128) };
 			return func(this, a_functionName, a_functionID);
 		}
 
 		void RegisterCodeObject(Scaleform::GFx::Movie& a_movie, Scaleform::GFx::Value& a_menuObj)
 		{
 			using func_t = decltype(&SWFToCodeFunctionHandler::RegisterCodeObject);
-			REL::Relocation<func_t> func{ REL::ID(67637) };
+			static REL::Relocation<func_t> func{ REL::ID(67637) };
 			return func(this, a_movie, a_menuObj);
 		}
 	};
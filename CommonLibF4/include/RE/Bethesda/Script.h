@@ -259,13 +259,13 @@ namespace RE
 
 		[[nodiscard]] static std::span<SCRIPT_FUNCTION, 522> GetConsoleFunctions()
 		{
-			REL::Relocation<SCRIPT_FUNCTION(*)[522]> functions{ REL::ID(901511) };
+			static REL::Relocation<SCRIPT_FUNCTION(*)[522]> functions{ REL::ID(901511) };
 			return { *functions };
 		}
 
 		[[nodiscard]] static std::span<SCRIPT_FUNCTION, 819> GetScriptFunctions()
 		{
-			REL::Relocation<SCRIPT_FUNCTION(*)[819]> functions{ REL::ID(75173) };
+			static REL::Relocation<SCRIPT_FUNCTION(*)[819]> functions{ REL::ID(75173) };
 			return { *functions };
 		}
 
@@ -304,14 +304,14 @@ namespace RE
 		{
 			static_assert((std::is_pointer_v<Args> && ...), "arguments must all be pointers");
 			using func_t = bool(const SCRIPT_PARAMETER*, const char*, std::uint32_t&, TESObjectREFR*, TESObjectREFR*, Script*, ScriptLocals*, ...);
-			REL::Relocation<func_t> func{ REL::ID(1607) };
+			static REL::Relocation<func_t> func{ REL::ID(1607) };
 			return func(a_parameters, a_compiledParams, a_offset, a_refObject, a_container, a_script, a_scriptLocals, a_args...);
 		}
 
 		void CompileAndRun(ScriptCompiler* a_compiler, COMPILER_NAME a_compilerIndex, TESObjectREFR* a_ownerObject)
 		{
 			using func_t = decltype(&Script::CompileAndRun);
-			REL::Relocation<func_t> func{ REL::ID(526625) };
+			static REL::Relocation<func_t> func{ REL::ID(526625) };
 			return func(this, a_compiler, a_compilerIndex, a_ownerObject);
 		}
 
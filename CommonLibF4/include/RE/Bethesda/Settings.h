@@ -339,13 +339,13 @@ namespace RE
 		[[nodiscard]] static void InitCollection()
 		{
 			using func_t = decltype(&GameSettingCollection::InitCollection);
-			REL::Relocation<func_t> func{ REL::ID(948832) };
+			static REL::Relocation<func_t> func{ REL::ID(948832) };
 			return func();
 		}
 
 		[[nodiscard]] static GameSettingCollection* GetSingleton()
 		{
-			REL::Relocation<GameSettingCollection**> singleton{ REL::ID(8308) };
+			static REL::Relocation<GameSettingCollection**> singleton{ REL::ID(8308) };
 			return *singleton;
 		}
 	};
@@ -360,7 +360,7 @@ namespace RE
 
 		[[nodiscard]] static INISettingCollection* GetSingleton()
 		{
-			REL::Relocation<INISettingCollection**> singleton{ REL::ID(791183) };
+			static REL::Relocation<INISettingCollection**> singleton{ REL::ID(791183) };
 			return *singleton;
 		}
 
@@ -385,7 +385,7 @@ namespace RE
 
 		[[nodiscard]] static INIPrefSettingCollection* GetSingleton()
 		{
-			REL::Relocation<INIPrefSettingCollection**> singleton{ REL::ID(767844) };
+			static REL::Relocation<INIPrefSettingCollection**> singleton{ REL::ID(767844) };
 			return *singleton;
 		}
 	};
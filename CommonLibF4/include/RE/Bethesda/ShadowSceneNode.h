@@ -47,7 +47,7 @@ namespace RE
 		void ProcessQueuedLights(BSCullingProcess* a_cullingprocess)
 		{
 			using func_t = decltype(&ShadowSceneNode::ProcessQueuedLights);
-			REL::Relocation<func_t> func{ REL::ID(1369106) };
+			static REL::Relocation<func_t> func{ REL::ID(1369106) };
 			return func(this, a_cullingprocess);
 		}
 
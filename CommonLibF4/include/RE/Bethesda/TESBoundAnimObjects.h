@@ -280,7 +280,7 @@ namespace RE
 		[[nodiscard]] TESContainer* GetContainer()
 		{
 			using func_t = decltype(&TESFurniture::GetContainer);
-			REL::Relocation<func_t> func{ REL::ID(1049933) };
+			static REL::Relocation<func_t> func{ REL::ID(1049933) };
 			return func(this);
 		}
 
@@ -386,7 +386,7 @@ namespace RE
 
         [[nodiscard]] static BSTHashMap<const TESNPC*, BSTArray<BGSHeadPart*>>& GetAlternateHeadPartListMap()
 		{
-			REL::Relocation<BSTHashMap<const TESNPC*, BSTArray<BGSHeadPart*>>*> map{ REL::ID(1306546), -0x8 };
+			static REL::Relocation<BSTHashMap<const TESNPC*, BSTArray<BGSHeadPart*>>*> map{ REL::ID(1306546), -0x8 };
 			return *map;
 		}
 
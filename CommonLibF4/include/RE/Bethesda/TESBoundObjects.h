@@ -102,7 +102,7 @@ namespace RE
 		void ApplyMods(BSTSmartPointer<TBO_InstanceData>& a_dest, const BGSObjectInstanceExtra* a_extra) const
 		{
 			using func_t = decltype(&TESBoundObject::ApplyMods);
-			REL::Relocation<func_t> func{ REL::ID(113585) };
+			static REL::Relocation<func_t> func{ REL::ID(113585) };
 			return func(this, a_dest, a_extra);
 		}
 
@@ -632,14 +632,14 @@ namespace RE
 		[[nodiscard]] MELEE_ATTACK_SPEED GetMeleeAttackSpeed()
 		{
 			using func_t = decltype(&TESObjectWEAP::GetMeleeAttackSpeed);
-			REL::Relocation<func_t> func{ REL::ID(817670) };
+			static REL::Relocation<func_t> func{ REL::ID(817670) };
 			return func(this);
 		}
 
 		[[nodiscard]] static const char* GetMeleeAttackSpeedLabel(MELEE_ATTACK_SPEED a_speed)
 		{
 			using func_t = decltype(&TESObjectWEAP::GetMeleeAttackSpeedLabel);
-			REL::Relocation<func_t> func{ REL::ID(178784) };
+			static REL::Relocation<func_t> func{ REL::ID(178784) };
 			return func(a_speed);
 		}
 
@@ -684,7 +684,7 @@ namespace RE
 		[[nodiscard]] static bool GetReloadsWithAmmoRef(const TESAmmo* a_ammo)
 		{
 			using func_t = decltype(&TESAmmo::GetReloadsWithAmmoRef);
-			REL::Relocation<func_t> func{ REL::ID(1035622) };
+			static REL::Relocation<func_t> func{ REL::ID(1035622) };
 			return func(a_ammo);
 		}
 
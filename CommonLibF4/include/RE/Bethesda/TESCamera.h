@@ -66,7 +66,7 @@ namespace RE
 		TESCameraState(TESCamera& cam, std::uint32_t ID)
 		{
 			typedef TESCameraState* func_t(TESCameraState*, TESCamera&, std::uint32_t);
-			REL::Relocation<func_t> func{ REL::ID(1277606), 0x3 };
+			static REL::Relocation<func_t> func{ REL::ID(1277606), 0x3 };
 			func(this, cam, ID);
 		}
 
@@ -101,7 +101,7 @@ namespace RE
 		TESCamera()
 		{
 			typedef TESCamera* func_t(TESCamera*);
-			REL::Relocation<func_t> func{ REL::ID(807071) };
+			static REL::Relocation<func_t> func{ REL::ID(807071) };
 			func(this);
 		}
 
@@ -115,28 +115,28 @@ namespace RE
 		void AddRotationInput(float y, float x)
 		{
 			using func_t = decltype(&TESCamera::AddRotationInput);
-			REL::Relocation<func_t> func{ REL::ID(1324925), 0x10 };
+			static REL::Relocation<func_t> func{ REL::ID(1324925), 0x10 };
 			return func(this, y, x);
 		}
 
 		void AddTranslationInput(float x, float y, float z)
 		{
 			using func_t = decltype(&TESCamera::AddTranslationInput);
-			REL::Relocation<func_t> func{ REL::ID(1324925), 0x30 };
+			static REL::Relocation<func_t> func{ REL::ID(1324925), 0x30 };
 			return func(this, x, y, z);
 		}
 
 		void AddZoomInput(float newZoom)
 		{
 			using func_t = decltype(&TESCamera::AddZoomInput);
-			REL::Relocation<func_t> func{ REL::ID(1324925), 0x60 };
+			static REL::Relocation<func_t> func{ REL::ID(1324925), 0x60 };
 			return func(this, newZoom);
 		}
 
 		bool GetCameraRoot(NiPointer<NiNode>& a_node)
 		{
 			using func_t = decltype(&TESCamera::GetCameraRoot);
-			REL::Relocation<func_t> func{ REL::ID(261092) };
+			static REL::Relocation<func_t> func{ REL::ID(261092) };
 			return func(this, a_node);
 		}
 
@@ -257,7 +257,7 @@ namespace RE
 
 		[[nodiscard]] static PlayerCamera* GetSingleton()
 		{
-			REL::Relocation<PlayerCamera**> singleton{ REL::ID(1171980) };
+			static REL::Relocation<PlayerCamera**> singleton{ REL::ID(1171980) };
 			return *singleton;
 		}
 
@@ -74,14 +74,14 @@ namespace RE
 		[[nodiscard]] float GetComparisonValue()
 		{
 			using func_t = decltype(&TESConditionItem::GetComparisonValue);
-			REL::Relocation<func_t> func{ REL::ID(1373349) };
+			static REL::Relocation<func_t> func{ REL::ID(1373349) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool IsTrue(TESObjectREFR* a_actionRef, TESObjectREFR* a_targetRef)
 		{
 			using func_t = decltype(&TESConditionItem::IsTrue);
-			REL::Relocation<func_t> func{ REL::ID(1453240) };
+			static REL::Relocation<func_t> func{ REL::ID(1453240) };
 			return func(this, a_actionRef, a_targetRef);
 		}
 
@@ -104,14 +104,14 @@ namespace RE
 		[[nodiscard]] bool IsTrue(TESObjectREFR* a_actionRef, TESObjectREFR* a_targetRef) const
 		{
 			using func_t = decltype(&TESCondition::IsTrue);
-			REL::Relocation<func_t> func{ REL::ID(1275731) };
+			static REL::Relocation<func_t> func{ REL::ID(1275731) };
 			return func(this, a_actionRef, a_targetRef);
 		}
 
 		[[nodiscard]] bool IsTrueForAllButFunction(ConditionCheckParams& a_paramData, SCRIPT_OUTPUT a_function) const
 		{
 			using func_t = decltype(&TESCondition::IsTrueForAllButFunction);
-			REL::Relocation<func_t> func{ REL::ID(1182457) };
+			static REL::Relocation<func_t> func{ REL::ID(1182457) };
 			return func(this, a_paramData, a_function);
 		}
 
@@ -65,28 +65,28 @@ namespace RE
 	public:
 		[[nodiscard]] static TESDataHandler* GetSingleton()
 		{
-			REL::Relocation<TESDataHandler**> singleton{ REL::ID(711558) };
+			static REL::Relocation<TESDataHandler**> singleton{ REL::ID(711558) };
 			return *singleton;
 		}
 
 		[[nodiscard]] bool AddFormToDataHandler(TESForm* a_form)
 		{
 			using func_t = decltype(&TESDataHandler::AddFormToDataHandler);
-			REL::Relocation<func_t> func{ REL::ID(350112) };
+			static REL::Relocation<func_t> func{ REL::ID(350112) };
 			return func(this, a_form);
 		}
 
 		[[nodiscard]] bool CheckModsLoaded(bool a_everModded)
 		{
 			using func_t = decltype(&TESDataHandler::CheckModsLoaded);
-			REL::Relocation<func_t> func{ REL::ID(1432894) };
+			static REL::Relocation<func_t> func{ REL::ID(1432894) };
 			return func(this, a_everModded);
 		}
 
 		[[nodiscard]] ObjectRefHandle CreateReferenceAtLocation(NEW_REFR_DATA& a_data)
 		{
 			using func_t = decltype(&TESDataHandler::CreateReferenceAtLocation);
-			REL::Relocation<func_t> func{ REL::ID(500304) };
+			static REL::Relocation<func_t> func{ REL::ID(500304) };
 			return func(this, a_data);
 		}
 
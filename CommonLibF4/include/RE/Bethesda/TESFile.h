@@ -101,14 +101,14 @@ namespace RE
 		[[nodiscard]] bool CloseTES(bool a_forceClose)
 		{
 			using func_t = decltype(&TESFile::CloseTES);
-			REL::Relocation<func_t> func{ REL::ID(766555) };
+			static REL::Relocation<func_t> func{ REL::ID(766555) };
 			return func(this, a_forceClose);
 		}
 
 		[[nodiscard]] bool GetChunkData(void* a_data, std::uint32_t a_maxSize)
 		{
 			using func_t = bool (RE::TESFile::*)(void*, uint32_t);
-			REL::Relocation<func_t> func{ REL::ID(188910) };
+			static REL::Relocation<func_t> func{ REL::ID(188910) };
 			return func(this, a_data, a_maxSize);
 		}
 
@@ -131,35 +131,35 @@ namespace RE
 		[[nodiscard]] std::uint32_t GetTESChunk()
 		{
 			using func_t = decltype(&TESFile::GetTESChunk);
-			REL::Relocation<func_t> func{ REL::ID(641361) };
+			static REL::Relocation<func_t> func{ REL::ID(641361) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool NextChunk()
 		{
 			using func_t = decltype(&TESFile::NextChunk);
-			REL::Relocation<func_t> func{ REL::ID(1252764) };
+			static REL::Relocation<func_t> func{ REL::ID(1252764) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool NextForm(bool a_skipIgnored)
 		{
 			using func_t = decltype(&TESFile::NextForm);
-			REL::Relocation<func_t> func{ REL::ID(644374) };
+			static REL::Relocation<func_t> func{ REL::ID(644374) };
 			return func(this, a_skipIgnored);
 		}
 
 		[[nodiscard]] bool NextGroup()
 		{
 			using func_t = decltype(&TESFile::NextGroup);
-			REL::Relocation<func_t> func{ REL::ID(339855) };
+			static REL::Relocation<func_t> func{ REL::ID(339855) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool OpenTES(char* a_path, const char* a_filename, NiFile::OpenMode a_accessMode, bool a_lock)
 		{
 			using func_t = bool (TESFile::*)(char*, const char*, NiFile::OpenMode, bool);
-			REL::Relocation<func_t> func{ REL::ID(728465) };
+			static REL::Relocation<func_t> func{ REL::ID(728465) };
 			return func(this, a_path, a_filename, a_accessMode, a_lock);
 		}
 
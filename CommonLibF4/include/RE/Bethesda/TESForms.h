@@ -637,7 +637,7 @@ namespace RE
 			std::int32_t operator()(const TESForm* a_arg1, const TESForm* a_arg2)
 			{
 				using func_t = decltype(&FormSortFunc::operator());
-				REL::Relocation<func_t> func{ REL::ID(705530) };
+				static REL::Relocation<func_t> func{ REL::ID(705530) };
 				return func(this, a_arg1, a_arg2);
 			}
 		};
@@ -720,7 +720,7 @@ namespace RE
 		static void AddCompileIndex(std::uint32_t& a_id, TESFile* a_file)
 		{
 			using func_t = decltype(&TESForm::AddCompileIndex);
-			REL::Relocation<func_t> func{ REL::ID(1315637) };
+			static REL::Relocation<func_t> func{ REL::ID(1315637) };
 			return func(a_id, a_file);
 		}
 
@@ -729,8 +729,8 @@ namespace RE
 				BSTHashMap<std::uint32_t, TESForm*>*,
 				std::reference_wrapper<BSReadWriteLock>>
 		{
-			REL::Relocation<BSTHashMap<std::uint32_t, TESForm*>**> allForms{ REL::ID(422985) };
-			REL::Relocation<BSReadWriteLock*> allFormsMapLock{ REL::ID(691815) };
+			static REL::Relocation<BSTHashMap<std::uint32_t, TESForm*>**> allForms{ REL::ID(422985) };
+			static REL::Relocation<BSReadWriteLock*> allFormsMapLock{ REL::ID(691815) };
 			return { *allForms, *allFormsMapLock };
 		}
 
@@ -739,8 +739,8 @@ namespace RE
 				BSTHashMap<BSFixedString, TESForm*>*,
 				std::reference_wrapper<BSReadWriteLock>>
 		{
-			REL::Relocation<BSTHashMap<BSFixedString, TESForm*>**> allFormsByEditorID{ REL::ID(642758) };
-			REL::Relocation<BSReadWriteLock*> allFormsEditorIDMapLock{ REL::ID(910917) };
+			static REL::Relocation<BSTHashMap<BSFixedString, TESForm*>**> allFormsByEditorID{ REL::ID(642758) };
+			static REL::Relocation<BSReadWriteLock*> allFormsEditorIDMapLock{ REL::ID(910917) };
 			return { *allFormsByEditorID, *allFormsEditorIDMapLock };
 		}
 
@@ -752,7 +752,7 @@ namespace RE
 		[[nodiscard]] TESFile* GetFile(std::int32_t a_index = -1) const
 		{
 			using func_t = decltype(&TESForm::GetFile);
-			REL::Relocation<func_t> func{ REL::ID(1376557) };
+			static REL::Relocation<func_t> func{ REL::ID(1376557) };
 			return func(this, a_index);
 		}
 
@@ -796,14 +796,14 @@ namespace RE
 
 		[[nodiscard]] static std::span<FORM_ENUM_STRING, 159> GetFormEnumString()
 		{
-			REL::Relocation<FORM_ENUM_STRING(*)[159]> functions{ REL::ID(1309967) };
+			static REL::Relocation<FORM_ENUM_STRING(*)[159]> functions{ REL::ID(1309967) };
 			return { *functions };
 		}
 
 		[[nodiscard]] static ENUM_FORM_ID GetFormTypeFromString(const char* a_formTypeString)
 		{
 			using func_t = decltype(&TESForm::GetFormTypeFromString);
-			REL::Relocation<func_t> func{ REL::ID(565203) };
+			static REL::Relocation<func_t> func{ REL::ID(565203) };
 			return func(a_formTypeString);
 		}
 
@@ -871,7 +871,7 @@ namespace RE
 		void SetTemporary()
 		{
 			using func_t = decltype(&TESForm::SetTemporary);
-			REL::Relocation<func_t> func{ REL::ID(482454) };
+			static REL::Relocation<func_t> func{ REL::ID(482454) };
 			return func(this);
 		}
 
@@ -931,7 +931,7 @@ namespace RE
 		[[nodiscard]] static auto GetTypedKeywords()
 			-> std::optional<std::span<BSTArray<BGSKeyword*>, stl::to_underlying(KeywordType::kTotal)>>
 		{
-			REL::Relocation<BSTArray<BGSKeyword*>(*)[stl::to_underlying(KeywordType::kTotal)]> keywords{ REL::ID(1095775) };
+			static REL::Relocation<BSTArray<BGSKeyword*>(*)[stl::to_underlying(KeywordType::kTotal)]> keywords{ REL::ID(1095775) };
 			if (*keywords) {
 				return { *keywords };
 			} else {
@@ -1463,63 +1463,63 @@ namespace RE
 		[[nodiscard]] bhkWorld* GetbhkWorld() const
 		{
 			using func_t = decltype(&TESObjectCELL::GetbhkWorld);
-			REL::Relocation<func_t> func{ REL::ID(1326073) };
+			static REL::Relocation<func_t> func{ REL::ID(1326073) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool GetCantWaitHere()
 		{
 			using func_t = decltype(&TESObjectCELL::GetCantWaitHere);
-			REL::Relocation<func_t> func{ REL::ID(376940) };
+			static REL::Relocation<func_t> func{ REL::ID(376940) };
 			return func(this);
 		}
 
 		[[nodiscard]] std::int32_t GetDataX()
 		{
 			using func_t = decltype(&TESObjectCELL::GetDataX);
-			REL::Relocation<func_t> func{ REL::ID(445210) };
+			static REL::Relocation<func_t> func{ REL::ID(445210) };
 			return func(this);
 		}
 
 		[[nodiscard]] std::int32_t GetDataY()
 		{
 			using func_t = decltype(&TESObjectCELL::GetDataY);
-			REL::Relocation<func_t> func{ REL::ID(1322816) };
+			static REL::Relocation<func_t> func{ REL::ID(1322816) };
 			return func(this);
 		}
 
 		[[nodiscard]] BGSEncounterZone* GetEncounterZone() const
 		{
 			using func_t = decltype(&TESObjectCELL::GetEncounterZone);
-			REL::Relocation<func_t> func{ REL::ID(1414637) };
+			static REL::Relocation<func_t> func{ REL::ID(1414637) };
 			return func(this);
 		}
 
 		[[nodiscard]] BGSLocation* GetLocation() const
 		{
 			using func_t = decltype(&TESObjectCELL::GetLocation);
-			REL::Relocation<func_t> func{ REL::ID(868663) };
+			static REL::Relocation<func_t> func{ REL::ID(868663) };
 			return func(this);
 		}
 
 		[[nodiscard]] TESForm* GetOwner()
 		{
 			using func_t = decltype(&TESObjectCELL::GetOwner);
-			REL::Relocation<func_t> func{ REL::ID(910422) };
+			static REL::Relocation<func_t> func{ REL::ID(910422) };
 			return func(this);
 		}
 
 		[[nodiscard]] TESRegionList* GetRegionList(bool a_createIfMissing)
 		{
 			using func_t = decltype(&TESObjectCELL::GetRegionList);
-			REL::Relocation<func_t> func{ REL::ID(1565031) };
+			static REL::Relocation<func_t> func{ REL::ID(1565031) };
 			return func(this, a_createIfMissing);
 		}
 
 		[[nodiscard]] NiAVObject* Pick(bhkPickData& pd)
 		{
 			using func_t = decltype(&TESObjectCELL::Pick);
-			REL::Relocation<func_t> func{ REL::ID(434717) };
+			static REL::Relocation<func_t> func{ REL::ID(434717) };
 			return func(this, pd);
 		}
 
@@ -1903,14 +1903,14 @@ namespace RE
 		void AddScriptAddedForm(TESForm* a_form)
 		{
 			using func_t = decltype(&BGSListForm::AddScriptAddedForm);
-			REL::Relocation<func_t> func{ REL::ID(1064874) };
+			static REL::Relocation<func_t> func{ REL::ID(1064874) };
 			return func(this, a_form);
 		}
 
 		[[nodiscard]] bool ContainsItem(const TESForm* a_form)
 		{
 			using func_t = decltype(&BGSListForm::ContainsItem);
-			REL::Relocation<func_t> func{ REL::ID(688500) };
+			static REL::Relocation<func_t> func{ REL::ID(688500) };
 			return func(this, a_form);
 		}
 
@@ -2336,7 +2336,7 @@ namespace RE
 		std::uint32_t GetConvertedDescription(BSFixedString& a_result)
 		{
 			using func_t = decltype(&BGSMessage::GetConvertedDescription);
-			REL::Relocation<func_t> func{ REL::ID(8331) };
+			static REL::Relocation<func_t> func{ REL::ID(8331) };
 			return func(this, a_result);
 		}
 
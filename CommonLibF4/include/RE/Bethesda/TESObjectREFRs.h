@@ -227,7 +227,7 @@ namespace RE
 		BGSObjectInstance* ctor(TESForm* a_object, TBO_InstanceData* a_instanceData)
 		{
 			using func_t = decltype(&BGSObjectInstance::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1095748) };
+			static REL::Relocation<func_t> func{ REL::ID(1095748) };
 			return func(this, a_object, a_instanceData);
 		}
 	};
@@ -297,7 +297,7 @@ namespace RE
 			bool a_alwaysContinue = false)
 		{
 			using func_t = decltype(&BGSInventoryList::FindAndWriteStackDataForItem);
-			REL::Relocation<func_t> func{ REL::ID(1354005) };
+			static REL::Relocation<func_t> func{ REL::ID(1354005) };
 			return func(this, a_object, a_compareFunc, a_writeFunc, a_objCompFn, a_alwaysContinue);
 		}
 
@@ -328,7 +328,7 @@ namespace RE
 		void ctor(const TESContainer* a_container, std::uint32_t* a_owner)
 		{
 			using func_t = decltype(&BGSInventoryList::ctor);
-			REL::Relocation<func_t> func{ REL::ID(845050) };
+			static REL::Relocation<func_t> func{ REL::ID(845050) };
 			return func(this, a_container, a_owner);
 		}
 	};
@@ -385,7 +385,7 @@ namespace RE
 		void Dtor()
 		{
 			using func_t = decltype(&BIPOBJECT::Dtor);
-			REL::Relocation<func_t> func{ REL::ID(765242) };
+			static REL::Relocation<func_t> func{ REL::ID(765242) };
 			return func(this);
 		}
 	};
@@ -423,14 +423,14 @@ namespace RE
 		[[nodiscard]] LOCK_LEVEL GetLockLevel(TESObjectREFR* a_owner)
 		{
 			using func_t = decltype(&REFR_LOCK::GetLockLevel);
-			REL::Relocation<func_t> func{ REL::ID(782953) };
+			static REL::Relocation<func_t> func{ REL::ID(782953) };
 			return func(this, a_owner);
 		}
 
 		void SetLocked(bool a_locked)
 		{
 			using func_t = decltype(&REFR_LOCK::SetLocked);
-			REL::Relocation<func_t> func{ REL::ID(157617) };
+			static REL::Relocation<func_t> func{ REL::ID(157617) };
 			return func(this, a_locked);
 		}
 
@@ -611,28 +611,28 @@ namespace RE
 		bool ActivateRef(TESObjectREFR* a_actionRef, TESBoundObject* a_objectToGet, std::int32_t a_count, bool a_defaultProcessingOnly, bool a_fromScript, bool a_looping)
 		{
 			using func_t = decltype(&TESObjectREFR::ActivateRef);
-			REL::Relocation<func_t> func{ REL::ID(753531) };
+			static REL::Relocation<func_t> func{ REL::ID(753531) };
 			return func(this, a_actionRef, a_objectToGet, a_count, a_defaultProcessingOnly, a_fromScript, a_looping);
 		}
 
 		void AddInventoryItem(TESBoundObject* a_object, BSTSmartPointer<ExtraDataList> a_extra, std::uint32_t a_count, TESObjectREFR* a_oldContainer, const INSTANCE_FILTER* a_filter, TESObjectREFR* a_overrideRef)
 		{
 			using func_t = decltype(&TESObjectREFR::AddInventoryItem);
-			REL::Relocation<func_t> func{ REL::ID(78185) };
+			static REL::Relocation<func_t> func{ REL::ID(78185) };
 			return func(this, a_object, a_extra, a_count, a_oldContainer, a_filter, a_overrideRef);
 		}
 
 		void AddLockChange()
 		{
 			using func_t = decltype(&TESObjectREFR::AddLockChange);
-			REL::Relocation<func_t> func{ REL::ID(1578706) };
+			static REL::Relocation<func_t> func{ REL::ID(1578706) };
 			return func(this);
 		}
 
 		void Enable(bool a_resetInventory)
 		{
 			using func_t = decltype(&TESObjectREFR::Enable);
-			REL::Relocation<func_t> func{ REL::ID(1396707) };
+			static REL::Relocation<func_t> func{ REL::ID(1396707) };
 			return func(this, a_resetInventory);
 		}
 
@@ -651,7 +651,7 @@ namespace RE
 		[[nodiscard]] BGSLocation* GetCurrentLocation() const
 		{
 			using func_t = decltype(&TESObjectREFR::GetCurrentLocation);
-			REL::Relocation<func_t> func{ REL::ID(1135470) };
+			static REL::Relocation<func_t> func{ REL::ID(1135470) };
 			return func(this);
 		}
 
@@ -660,7 +660,7 @@ namespace RE
 		[[nodiscard]] TESForm* GetOwner()
 		{
 			using func_t = decltype(&TESObjectREFR::GetOwner);
-			REL::Relocation<func_t> func{ REL::ID(1323437) };
+			static REL::Relocation<func_t> func{ REL::ID(1323437) };
 			return func(this);
 		}
 
@@ -669,98 +669,98 @@ namespace RE
 		[[nodiscard]] std::int64_t GetGoldAmount()
 		{
 			using func_t = decltype(&TESObjectREFR::GetGoldAmount);
-			REL::Relocation<func_t> func{ REL::ID(564356) };
+			static REL::Relocation<func_t> func{ REL::ID(564356) };
 			return func(this);
 		}
 
 		[[nodiscard]] ObjectRefHandle GetHandle()
 		{
 			using func_t = decltype(&TESObjectREFR::GetHandle);
-			REL::Relocation<func_t> func{ REL::ID(1573130) };
+			static REL::Relocation<func_t> func{ REL::ID(1573130) };
 			return func(this);
 		}
 
 		[[nodiscard]] std::uint32_t GetInventoryObjectCount(const TESBoundObject* a_object)
 		{
 			using func_t = decltype(&TESObjectREFR::GetInventoryObjectCount);
-			REL::Relocation<func_t> func{ REL::ID(333415) };
+			static REL::Relocation<func_t> func{ REL::ID(333415) };
 			return func(this, a_object);
 		}
 
 		[[nodiscard]] TESObjectREFR* GetLinkedRef(BGSKeyword* a_keyword)
 		{
 			using func_t = decltype(&TESObjectREFR::GetLinkedRef);
-			REL::Relocation<func_t> func{ REL::ID(897287) };
+			static REL::Relocation<func_t> func{ REL::ID(897287) };
 			return func(this, a_keyword);
 		}
 
 		[[nodiscard]] REFR_LOCK* GetLock()
 		{
 			using func_t = decltype(&TESObjectREFR::GetLock);
-			REL::Relocation<func_t> func{ REL::ID(930785) };
+			static REL::Relocation<func_t> func{ REL::ID(930785) };
 			return func(this);
 		}
 
 		[[nodiscard]] float GetWeightInContainer()
 		{
 			using func_t = decltype(&TESObjectREFR::GetWeightInContainer);
-			REL::Relocation<func_t> func{ REL::ID(1377567) };
+			static REL::Relocation<func_t> func{ REL::ID(1377567) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool IsCrimeToActivate()
 		{
 			using func_t = decltype(&TESObjectREFR::IsCrimeToActivate);
-			REL::Relocation<func_t> func{ REL::ID(836011) };
+			static REL::Relocation<func_t> func{ REL::ID(836011) };
 			return func(this);
 		}
 
 		[[nodiscard]] bool IsInWater()
 		{
 			using func_t = decltype(&TESObjectREFR::IsInWater);
-			REL::Relocation<func_t> func{ REL::ID(315318) };
+			static REL::Relocation<func_t> func{ REL::ID(315318) };
 			return func(this);
 		}
 
 		void MoveRefToNewSpace(TESObjectCELL* a_interior, TESWorldSpace* a_world)
 		{
 			using func_t = decltype(&TESObjectREFR::MoveRefToNewSpace);
-			REL::Relocation<func_t> func{ REL::ID(629658) };
+			static REL::Relocation<func_t> func{ REL::ID(629658) };
 			return func(this, a_interior, a_world);
 		}
 
 		void SetAngleOnReference(const NiPoint3& a_point)
 		{
 			using func_t = decltype(&TESObjectREFR::SetAngleOnReference);
-			REL::Relocation<func_t> func{ REL::ID(1049748) };
+			static REL::Relocation<func_t> func{ REL::ID(1049748) };
 			return func(this, a_point);
 		}
 
 		void SetLinkedRef(Actor* a_actor, BGSKeyword* a_keyword)
 		{
 			using func_t = decltype(&TESObjectREFR::SetLinkedRef);
-			REL::Relocation<func_t> func{ REL::ID(192840) };
+			static REL::Relocation<func_t> func{ REL::ID(192840) };
 			return func(this, a_actor, a_keyword);
 		}
 
 		void SetLocationOnReference(const NiPoint3& a_point)
 		{
 			using func_t = decltype(&TESObjectREFR::SetLocationOnReference);
-			REL::Relocation<func_t> func{ REL::ID(1101832) };
+			static REL::Relocation<func_t> func{ REL::ID(1101832) };
 			return func(this, a_point);
 		}
 
 		void SetWantsDelete(bool a_delete)
 		{
 			using func_t = decltype(&TESObjectREFR::SetWantsDelete);
-			REL::Relocation<func_t> func{ REL::ID(761346) };
+			static REL::Relocation<func_t> func{ REL::ID(761346) };
 			return func(this, a_delete);
 		}
 
 		bool WornHasKeyword(BGSKeyword* a_keyword)
 		{
 			using func_t = decltype(&TESObjectREFR::WornHasKeyword);
-			REL::Relocation<func_t> func{ REL::ID(900857) };
+			static REL::Relocation<func_t> func{ REL::ID(900857) };
 			return func(this, a_keyword);
 		}
 
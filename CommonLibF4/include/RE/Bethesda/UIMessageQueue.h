@@ -14,14 +14,14 @@ namespace RE
 	public:
 		[[nodiscard]] static UIMessageQueue* GetSingleton()
 		{
-			REL::Relocation<UIMessageQueue**> singleton{ REL::ID(82123) };
+			static REL::Relocation<UIMessageQueue**> singleton{ REL::ID(82123) };
 			return *singleton;
 		}
 
 		void AddMessage(const BSFixedString& a_menu, UI_MESSAGE_TYPE a_type)
 		{
 			using func_t = decltype(&UIMessageQueue::AddMessage);
-			REL::Relocation<func_t> func{ REL::ID(1182019) };
+			static REL::Relocation<func_t> func{ REL::ID(1182019) };
 			return func(this, a_menu, a_type);
 		}
 
@@ -48,7 +48,7 @@ namespace RE
 
 		[[nodiscard]] static VATS* GetSingleton()
 		{
-			REL::Relocation<VATS**> singleton{ REL::ID(570121) };
+			static REL::Relocation<VATS**> singleton{ REL::ID(570121) };
 			return *singleton;
 		}
 
@@ -112,6 +112,7 @@
 #include "RE/Bethesda/BSDevices/BSInterfaceDevice.h"
 #include "RE/Bethesda/BSDevices/XPrefSettings.h"
 #include "RE/Bethesda/BSExtraData.h"
+#include "RE/Bethesda/BSExtraDataAlg.h"
 #include "RE/Bethesda/BSGeometry.h"
 #include "RE/Bethesda/BSGraphics/BSGraphics.h"
 #include "RE/Bethesda/BSGraphics/BSGraphicsHandles.h"
@@ -402,10 +403,12 @@
 #include "RE/Bethesda/ControlMap.h"
 #include "RE/Bethesda/CreateNS.h"
 #include "RE/Bethesda/DrawWorld.h"
+#include "RE/Bethesda/EventDispatcher.h"
 #include "RE/Bethesda/Events.h"
 #include "RE/Bethesda/FavoritesManager.h"
 #include "RE/Bethesda/FormComponents.h"
 #include "RE/Bethesda/FormFactory.h"
+#include "RE/Bethesda/FormLookupCache.h"
 #include "RE/Bethesda/FormUtil.h"
 #include "RE/Bethesda/GamePlayFormulas.h"
 #include "RE/Bethesda/GameScript.h"
@@ -433,6 +436,7 @@
 #include "RE/Bethesda/PipboyManager.h"
 #include "RE/Bethesda/PlayerCharacter.h"
 #include "RE/Bethesda/PlayerControls.h"
+#include "RE/Bethesda/PluginCatalog.h"
 #include "RE/Bethesda/PowerArmor.h"
 #include "RE/Bethesda/PowerUtils.h"
 #include "RE/Bethesda/ProcessLists.h"
@@ -968,6 +972,7 @@
 #include "RE/NetImmerse/NiUpdateData.h"
 #include "RE/NiRTTI_IDs.h"
 #include "RE/RTTI.h"
+#include "RE/RTTICache.h"
 #include "RE/RTTI_IDs.h"
 #include "RE/Scaleform/GFx/GFx_AS3.h"
 #include "RE/Scaleform/GFx/GFx_ASMovieRootBase.h"
@@ -1327,6 +1332,7 @@
 #include "RE/Shared/Water/BGSWaterAudio.h"
 #include "RE/Shared/Water/BGSWaterCollisionManager.h"
 #include "RE/Shared/Water/TESWater.h"
+#include "RE/SnapshotDomain.h"
 #include "RE/VTABLE_IDs.h"
 #include "RE/msvc/functional.h"
 #include "RE/msvc/memory.h"
@@ -25,14 +25,14 @@ namespace RE
 		[[nodiscard]] static NiControllerManager* GetNiControllerManager(const NiObjectNET* a_object)
 		{
 			using func_t = decltype(&NiControllerManager::GetNiControllerManager);
-			REL::Relocation<func_t> func{ REL::ID(1013515) };
+			static REL::Relocation<func_t> func{ REL::ID(1013515) };
 			return func(a_object);
 		}
 
 		[[nodiscard]] NiControllerSequence* GetSequenceByName(const BSFixedString& a_name)
 		{
 			using func_t = decltype(&NiControllerManager::GetSequenceByName);
-			REL::Relocation<func_t> func{ REL::ID(846648) };
+			static REL::Relocation<func_t> func{ REL::ID(846648) };
 			return func(this, a_name);
 		}
 
@@ -29,7 +29,7 @@ namespace RE
 		bool Activate(std::uint8_t a_priority, bool a_startOver, float a_weight, float a_easeInTime, NiControllerSequence* a_timeSyncSeq, bool a_transition)
 		{
 			using func_t = decltype(&NiControllerSequence::Activate);
-			REL::Relocation<func_t> func{ REL::ID(829033) };
+			static REL::Relocation<func_t> func{ REL::ID(829033) };
 			return func(this, a_priority, a_startOver, a_weight, a_easeInTime, a_timeSyncSeq, a_transition);
 		}
 
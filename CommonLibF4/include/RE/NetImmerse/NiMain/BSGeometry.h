@@ -144,14 +144,14 @@ namespace RE
 		BSShaderProperty* QShaderProperty()
 		{
 			using func_t = decltype(&BSGeometry::QShaderProperty);
-			REL::Relocation<func_t> func{ REL::ID(1286348) };
+			static REL::Relocation<func_t> func{ REL::ID(1286348) };
 			return func(this);
 		}
 
 		void SetProperty(NiShadeProperty* a_property)
 		{
 			using func_t = decltype(&BSGeometry::SetProperty);
-			REL::Relocation<func_t> func{ REL::ID(254895), -0x18 };
+			static REL::Relocation<func_t> func{ REL::ID(254895), -0x18 };
 			return func(this, a_property);
 		}
 
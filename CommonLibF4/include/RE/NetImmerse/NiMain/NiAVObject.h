@@ -121,7 +121,7 @@ namespace RE
 		void Update(NiUpdateData& a_data)
 		{
 			using func_t = decltype(&NiAVObject::Update);
-			REL::Relocation<func_t> func{ REL::ID(121052) };
+			static REL::Relocation<func_t> func{ REL::ID(121052) };
 			return func(this, a_data);
 		}
 
@@ -57,7 +57,7 @@ namespace RE
 		NiAlphaProperty* ctor()
 		{
 			using func_t = decltype(&NiAlphaProperty::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1487963) };
+			static REL::Relocation<func_t> func{ REL::ID(1487963) };
 			return func(this);
 		}
 	};
@@ -30,7 +30,7 @@ namespace RE
 		static NiObject* CreateObject()
 		{
 			using func_t = decltype(&NiCamera::CreateObject);
-			REL::Relocation<func_t> func{ REL::ID(398143) };
+			static REL::Relocation<func_t> func{ REL::ID(398143) };
 			return func();
 		}
 
@@ -42,21 +42,21 @@ namespace RE
 		NiFrustum& GetViewFrustrum()
 		{
 			using func_t = decltype(&NiCamera::GetViewFrustrum);
-			REL::Relocation<func_t> func{ REL::ID(1057731) };
+			static REL::Relocation<func_t> func{ REL::ID(1057731) };
 			return func(this);
 		}
 
 		NiRect<float>& GetViewPort()
 		{
 			using func_t = decltype(&NiCamera::GetViewPort);
-			REL::Relocation<func_t> func{ REL::ID(688575), 0x5 };
+			static REL::Relocation<func_t> func{ REL::ID(688575), 0x5 };
 			return func(this);
 		}
 
 		bool LookAtWorldPoint(NiPoint3& p1, NiPoint3& p2)
 		{
 			using func_t = decltype(&NiCamera::LookAtWorldPoint);
-			REL::Relocation<func_t> func{ REL::ID(702948) };
+			static REL::Relocation<func_t> func{ REL::ID(702948) };
 			return func(this, p1, p2);
 		}
 
@@ -85,14 +85,14 @@ namespace RE
 		void SetViewFrustum(NiFrustum& a_frustum)
 		{
 			using func_t = decltype(&NiCamera::SetViewFrustum);
-			REL::Relocation<func_t> func{ REL::ID(24787) };
+			static REL::Relocation<func_t> func{ REL::ID(24787) };
 			return func(this, a_frustum);
 		}
 
 		void SetViewPort(NiRect<float>& a_viewport)
 		{
 			using func_t = decltype(&NiCamera::SetViewPort);
-			REL::Relocation<func_t> func{ REL::ID(1320828) };
+			static REL::Relocation<func_t> func{ REL::ID(1320828) };
 			return func(this, a_viewport);
 		}
 
@@ -29,13 +29,13 @@ namespace RE
 		NiCloningProcess* ctor(std::uint32_t unk)
 		{
 			using func_t = decltype(&NiCloningProcess::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1510731), 0x3 };
+			static REL::Relocation<func_t> func{ REL::ID(1510731), 0x3 };
 			return func(this, unk);
 		}
 		void* dtor()
 		{
 			using func_t = decltype(&NiCloningProcess::dtor);
-			REL::Relocation<func_t> func{ REL::ID(241551) };
+			static REL::Relocation<func_t> func{ REL::ID(241551) };
 			return func(this);
 		}
 	};
@@ -90,7 +90,7 @@ namespace RE
 		NiCullingProcess* ctor(NiVisibleArray* a_array)
 		{
 			using func_t = decltype(&NiCullingProcess::ctor);
-			REL::Relocation<func_t> func{ REL::ID(12355) };
+			static REL::Relocation<func_t> func{ REL::ID(12355) };
 			return func(this, a_array);
 		}
 	};
@@ -38,7 +38,7 @@ namespace RE
 		NiFrustumPlanes* ctor()
 		{
 			using func_t = decltype(&NiFrustumPlanes::ctor);
-			REL::Relocation<func_t> func{ REL::ID(1221948) };
+			static REL::Relocation<func_t> func{ REL::ID(1221948) };
 			return func(this);
 		}
 	};
@@ -17,7 +17,7 @@ namespace RE
 		bool ToEulerAnglesXYZ(float* angleX, float* angleY, float* angleZ)
 		{
 			using func_t = decltype(&NiMatrix3::ToEulerAnglesXYZ);
-			REL::Relocation<func_t> func{ REL::ID(34114) };
+			static REL::Relocation<func_t> func{ REL::ID(34114) };
 			return func(this, angleX, angleY, angleZ);
 		}
 
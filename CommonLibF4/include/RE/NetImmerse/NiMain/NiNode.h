@@ -24,7 +24,7 @@ namespace RE
 			children(a_numChildren)
 		{
 			stl::emplace_vtable(this);
-			REL::Relocation<std::uintptr_t> childrenVTable{ REL::ID(390064) };
+			static REL::Relocation<std::uintptr_t> childrenVTable{ REL::ID(390064) };
 			reinterpret_cast<std::uintptr_t&>(children) = childrenVTable.address();
 		}
 
@@ -42,7 +42,7 @@ namespace RE
 		static NiObject* CreateObject()
 		{
 			using func_t = decltype(&NiNode::CreateObject);
-			REL::Relocation<func_t> func{ REL::ID(695914), 0x6 };
+			static REL::Relocation<func_t> func{ REL::ID(695914), 0x6 };
 			return func();
 		}
 
@@ -88,35 +88,35 @@ namespace RE
 		NiObject* DynamicCast(const NiRTTI* type) const
 		{
 			using func_t = decltype(&NiObject::DynamicCast);
-			REL::Relocation<func_t> func{ REL::ID(80812) };
+			static REL::Relocation<func_t> func{ REL::ID(80812) };
 			return func(this, type);
 		}
 
 		NiObject* Clone(void)
 		{
 			using func_t = decltype(&NiObject::Clone);
-			REL::Relocation<func_t> func{ REL::ID(604942) };
+			static REL::Relocation<func_t> func{ REL::ID(604942) };
 			return func(this);
 		}
 
 		NiObject* CloneParam(NiCloningProcess& a_process)
 		{
 			using func_t = decltype(&NiObject::CloneParam);
-			REL::Relocation<func_t> func{ REL::ID(418201) };
+			static REL::Relocation<func_t> func{ REL::ID(418201) };
 			return func(this, a_process);
 		}
 
 		NiObject* CreateSharedClone(NiCloningProcess& a_process)
 		{
 			using func_t = decltype(&NiObject::CreateSharedClone);
-			REL::Relocation<func_t> func{ REL::ID(1029727) };
+			static REL::Relocation<func_t> func{ REL::ID(1029727) };
 			return func(this, a_process);
 		}
 
 		NiObject* CreateDeepCopy(NiPointer<NiObject>& a_object)
 		{
 			using func_t = decltype(&NiObject::CreateDeepCopy);
-			REL::Relocation<func_t> func{ REL::ID(750380) };
+			static REL::Relocation<func_t> func{ REL::ID(750380) };
 			return func(this, a_object);
 		}
 
@@ -24,14 +24,14 @@ namespace RE
 	private:
 		NiPlane* ctor() {
 			using func_t = decltype(&NiPlane::ctor);
-			REL::Relocation<func_t> func{ REL::ID(327814) };
+			static REL::Relocation<func_t> func{ REL::ID(327814) };
 			return func(this);
 		}
 
 		NiPlane* ctorCopy(NiPlane& a_copy)
 		{
 			using func_t = decltype(&NiPlane::ctorCopy);
-			REL::Relocation<func_t> func{ REL::ID(476025), 0xF };
+			static REL::Relocation<func_t> func{ REL::ID(476025), 0xF };
 			return func(this, a_copy);
 		}
 	};
@@ -9,7 +9,7 @@ namespace RE
 		void ToRotation(NiMatrix3& a_rotation)
 		{
 			using func_t = decltype(&NiQuaternion::ToRotation);
-			REL::Relocation<func_t> func{ REL::ID(1379385) };
+			static REL::Relocation<func_t> func{ REL::ID(1379385) };
 			return func(this, a_rotation);
 		}
 
@@ -5,14 +5,14 @@ namespace RE
 	inline void* NiMalloc(std::size_t a_num)
 	{
 		using func_t = decltype(&NiMalloc);
-		REL::Relocation<func_t> func{ REL::ID(974443) };
+		static REL::Relocation<func_t> func{ REL::ID(974443) };
 		return func(a_num);
 	}
 
 	inline void NiFree(void* a_ptr)
 	{
 		using func_t = decltype(&NiFree);
-		REL::Relocation<func_t> func{ REL::ID(242362) };
+		static REL::Relocation<func_t> func{ REL::ID(242362) };
 		return func(a_ptr);
 	}
 
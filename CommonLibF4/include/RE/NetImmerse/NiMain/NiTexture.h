@@ -34,28 +34,28 @@ namespace RE
 		static NiTexture* Create(const BSFixedString& name, [[maybe_unused]] bool a1, bool a2)
 		{
 			using func_t = decltype(&NiTexture::Create);
-			REL::Relocation<func_t> func{ REL::ID(1071950) };
+			static REL::Relocation<func_t> func{ REL::ID(1071950) };
 			return func(name, a1, a2);
 		}
 
 		static NiTexture* CreateEmpty(const BSFixedString& name, bool isDDX, [[maybe_unused]] bool a1)
 		{
 			using func_t = decltype(&NiTexture::CreateEmpty);
-			REL::Relocation<func_t> func{ REL::ID(1255534) };
+			static REL::Relocation<func_t> func{ REL::ID(1255534) };
 			return func(name, isDDX, a1);
 		}
 
 		static void SetAllowDegrade(bool degrade)
 		{
 			using func_t = decltype(&NiTexture::SetAllowDegrade);
-			REL::Relocation<func_t> func{ REL::ID(948181) };
+			static REL::Relocation<func_t> func{ REL::ID(948181) };
 			return func(degrade);
 		}
 
 		void SetRendererTexture(BSGraphics::Texture* texture)
 		{
 			using func_t = decltype(&NiTexture::SetRendererTexture);
-			REL::Relocation<func_t> func{ REL::ID(320514), 0x10 };
+			static REL::Relocation<func_t> func{ REL::ID(320514), 0x10 };
 			return func(this, texture);
 		}
 
@@ -32,27 +32,27 @@ namespace RE
 		void SetNameConst(const BSFixedString& a_name)
 		{
 			using func_t = decltype(&NiObjectNET::SetNameConst);
-			REL::Relocation<func_t> func{ REL::ID(493272) };
+			static REL::Relocation<func_t> func{ REL::ID(493272) };
 			return func(this, a_name);
 		}
 
 		static char GetDefaultAppendCharacter(void)
 		{
 			using func_t = decltype(&NiObjectNET::GetDefaultAppendCharacter);
-			REL::Relocation<func_t> func{ REL::ID(468580), 0xE };
+			static REL::Relocation<func_t> func{ REL::ID(468580), 0xE };
 			return func();
 		}
 
 		static CopyType GetDefaultCopyType(void)
 		{
 			using func_t = decltype(&NiObjectNET::GetDefaultCopyType);
-			REL::Relocation<func_t> func{ REL::ID(468580), 0x1E };
+			static REL::Relocation<func_t> func{ REL::ID(468580), 0x1E };
 			return func();
 		}
 
 		static void SetDefaultCopyType(CopyType a_copy) {
 			using func_t = decltype(&NiObjectNET::SetDefaultCopyType);
-			REL::Relocation<func_t> func{ REL::ID(1129741), 0x30 };
+			static REL::Relocation<func_t> func{ REL::ID(1129741), 0x30 };
 			return func(a_copy);
 		}
 
@@ -45,7 +45,7 @@ namespace RE
 		NiUpdateData* ctor(float time, std::uint32_t flags)
 		{
 			using func_t = decltype(&NiUpdateData::ctor);
-			REL::Relocation<func_t> func{ REL::ID(927837), 0x10 };
+			static REL::Relocation<func_t> func{ REL::ID(927837), 0x10 };
 			return func(this, time, flags);
 		}
 	};
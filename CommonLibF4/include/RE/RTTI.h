@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RE/RTTICache.h"
+
 namespace RE
 {
 	namespace msvc
@@ -113,7 +115,7 @@ namespace RE
 	inline void* RTDynamicCast(void* a_inptr, std::int32_t a_vfDelta, void* a_srcType, void* a_targetType, std::int32_t a_isReference)
 	{
 		using func_t = decltype(&RTDynamicCast);
-		REL::Relocation<func_t> func{ REL::ID(84112) };
+		static REL::Relocation<func_t> func{ REL::ID(84112) };
 		return func(a_inptr, a_vfDelta, a_srcType, a_targetType, a_isReference);
 	}
 
@@ -204,15 +206,23 @@ namespace RE
 	To fallout_cast(From* a_from)  //
 		requires(detail::cast_is_valid_v<To, From*>)
 	{
-		REL::Relocation<void*> from{ detail::remove_cvpr_t<From>::RTTI };
-		REL::Relocation<void*> to{ detail::remove_cvpr_t<To>::RTTI };
-		return static_cast<To>(
-			RE::RTDynamicCast(
-				const_cast<void*>(
-					static_cast<const volatile void*>(a_from)),
-				0,
-				from.get(),
-				to.get(),
-				false));
+		using source_t = detail::remove_cvpr_t<From>;
+		using target_t = detail::remove_cvpr_t<To>;
+
+		if constexpr (std::is_convertible_v<From*, To>) {
+			return a_from;
+		} else {
+			static REL::Relocation<void*> from{ source_t::RTTI };
+			static REL::Relocation<void*> to{ target_t::RTTI };
+			return static_cast<To>(
+				detail::get_dynamic_cast_cache().cast(
+					const_cast<void*>(
+						static_cast<const volatile void*>(a_from)),
+					from.get(),
+					to.get(),
+					[&](void* a_ptr) {
+						return RE::RTDynamicCast(a_ptr, 0, from.get(), to.get(), false);
+					}));
+		}
 	}
 }
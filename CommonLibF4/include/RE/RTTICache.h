@@ -0,0 +1,122 @@
+#pragma once
+
+namespace RE
+{
+	namespace detail
+	{
+		// remembers how dynamic casts resolved, by the virtual table of the object cast from and the types cast
+		// between. a virtual table names one subobject of one complete type, so the pair always adjusts this by
+		// the same amount, or always fails. entries are never removed, and a full table just stops remembering
+		class DynamicCastCache
+		{
+		public:
+			static constexpr std::size_t CAPACITY = 1u << 12;
+			static constexpr std::size_t MAX_PROBES = 16;
+			static constexpr auto FAILS = (std::numeric_limits<std::ptrdiff_t>::min)();
+
+			// the adjustment to this, FAILS if the cast fails, or nothing if it has not been seen yet
+			[[nodiscard]] std::optional<std::ptrdiff_t> find(const void* a_vtable, const void* a_source, const void* a_target) const noexcept
+			{
+				const auto hash = hash_key(a_vtable, a_source, a_target);
+				for (std::size_t i = 0; i < MAX_PROBES; ++i) {
+					const auto& slot = _slots[(hash + i) & (CAPACITY - 1)];
+					const auto state = slot.state.load(std::memory_order_acquire);
+					if (state == kEmpty) {
+						break;
+					} else if (state == kReady && slot.matches(a_vtable, a_source, a_target)) {
+						return slot.adjust;
+					}
+				}
+				return std::nullopt;
+			}
+
+			// claims a slot for the key, unless another thread got there first or the probe runs out
+			void insert(const void* a_vtable, const void* a_source, const void* a_target, std::ptrdiff_t a_adjust) noexcept
+			{
+				const auto hash = hash_key(a_vtable, a_source, a_target);
+				for (std::size_t i = 0; i < MAX_PROBES; ++i) {
+					auto& slot = _slots[(hash + i) & (CAPACITY - 1)];
+					auto state = slot.state.load(std::memory_order_acquire);
+					if (state == kEmpty && slot.state.compare_exchange_strong(state, kBusy, std::memory_order_acquire)) {
+						slot.vtable = a_vtable;
+						slot.source = a_source;
+						slot.target = a_target;
+						slot.adjust = a_adjust;
+						slot.state.store(kReady, std::memory_order_release);
+						_size.fetch_add(1, std::memory_order_relaxed);
+						return;
+					} else if (state == kBusy || (state == kReady && slot.matches(a_vtable, a_source, a_target))) {
+						return;  // someone is already resolving this key, or one that collides with it
+					}
+				}
+			}
+
+			// a_slow is the real dynamic cast, which is only called for pairs that have not been seen before
+			template <class F>
+			[[nodiscard]] void* cast(void* a_from, const void* a_source, const void* a_target, F&& a_slow)
+			{
+				if (!a_from) {
+					return nullptr;
+				}
+
+				const auto vtable = *static_cast<const void* const*>(a_from);
+				if (const auto adjust = find(vtable, a_source, a_target); adjust) {
+					return *adjust != FAILS ? static_cast<std::byte*>(a_from) + *adjust : nullptr;
+				}
+
+				const auto result = static_cast<void*>(a_slow(a_from));
+				insert(
+					vtable,
+					a_source,
+					a_target,
+					result ? static_cast<std::byte*>(result) - static_cast<std::byte*>(a_from) : FAILS);
+				return result;
+			}
+
+			[[nodiscard]] std::size_t size() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+		private:
+			enum : std::uint32_t
+			{
+				kEmpty,
+				kBusy,
+				kReady
+			};
+
+			struct slot_t
+			{
+			public:
+				[[nodiscard]] bool matches(const void* a_vtable, const void* a_source, const void* a_target) const noexcept
+				{
+					return vtable == a_vtable && source == a_source && target == a_target;
+				}
+
+				// members
+				std::atomic<std::uint32_t> state{ kEmpty };
+				const void* vtable{ nullptr };  // the rest are only written before state becomes ready
+				const void* source{ nullptr };
+				const void* target{ nullptr };
+				std::ptrdiff_t adjust{ 0 };
+			};
+
+			[[nodiscard]] static std::size_t hash_key(const void* a_vtable, const void* a_source, const void* a_target) noexcept
+			{
+				constexpr std::uint64_t golden = 0x9E3779B97F4A7C15;
+				auto hash = reinterpret_cast<std::uintptr_t>(a_vtable) * golden;
+				hash = (hash ^ reinterpret_cast<std::uintptr_t>(a_source)) * golden;
+				hash = (hash ^ reinterpret_cast<std::uintptr_t>(a_target)) * golden;
+				return static_cast<std::size_t>(hash >> 32);
+			}
+
+			// members
+			std::array<slot_t, CAPACITY> _slots{};
+			std::atomic<std::size_t> _size{ 0 };
+		};
+
+		[[nodiscard]] inline DynamicCastCache& get_dynamic_cast_cache() noexcept
+		{
+			static DynamicCastCache cache;
+			return cache;
+		}
+	}
+}
@@ -312,49 +312,49 @@ namespace RE::Scaleform::GFx
 			void ObjectAddRef(Value* a_val, void* a_obj)
 			{
 				using func_t = decltype(&ObjectInterface::ObjectRelease);
-				REL::Relocation<func_t> func{ REL::ID(244786) };
+				static REL::Relocation<func_t> func{ REL::ID(244786) };
 				return func(this, a_val, a_obj);
 			}
 
 			void ObjectRelease(Value* a_val, void* a_obj)
 			{
 				using func_t = decltype(&ObjectInterface::ObjectRelease);
-				REL::Relocation<func_t> func{ REL::ID(856221) };
+				static REL::Relocation<func_t> func{ REL::ID(856221) };
 				return func(this, a_val, a_obj);
 			}
 
 			bool HasMember(void* a_data, const char* a_name, bool a_isdobj) const
 			{
 				using func_t = decltype(&ObjectInterface::HasMember);
-				REL::Relocation<func_t> func{ REL::ID(788691) };
+				static REL::Relocation<func_t> func{ REL::ID(788691) };
 				return func(this, a_data, a_name, a_isdobj);
 			}
 
 			bool GetMember(void* a_data, const char* a_name, Value* a_val, bool a_isdobj) const
 			{
 				using func_t = decltype(&ObjectInterface::GetMember);
-				REL::Relocation<func_t> func{ REL::ID(1517430) };
+				static REL::Relocation<func_t> func{ REL::ID(1517430) };
 				return func(this, a_data, a_name, a_val, a_isdobj);
 			}
 
 			bool SetMember(void* a_data, const char* a_name, const Value& a_value, bool a_isdobj)
 			{
 				using func_t = decltype(&ObjectInterface::SetMember);
-				REL::Relocation<func_t> func{ REL::ID(1360149) };
+				static REL::Relocation<func_t> func{ REL::ID(1360149) };
 				return func(this, a_data, a_name, a_value, a_isdobj);
 			}
 
 			bool Invoke(void* a_data, Value* a_result, const char* a_name, const Value* a_args, std::size_t a_numArgs, bool a_isdobj)
 			{
 				using func_t = decltype(&ObjectInterface::Invoke);
-				REL::Relocation<func_t> func{ REL::ID(655847) };
+				static REL::Relocation<func_t> func{ REL::ID(655847) };
 				return func(this, a_data, a_result, a_name, a_args, a_numArgs, a_isdobj);
 			}
 
 			bool PushBack(void* a_data, const Value& a_value)
 			{
 				using func_t = decltype(&ObjectInterface::PushBack);
-				REL::Relocation<func_t> func{ REL::ID(1330475) };
+				static REL::Relocation<func_t> func{ REL::ID(1330475) };
 				return func(this, a_data, a_value);
 			}
 
@@ -852,7 +852,7 @@ namespace RE::Scaleform::GFx
 		void Release()
 		{
 			using func_t = decltype(&Movie::Release);
-			REL::Relocation<func_t> func{ REL::ID(404814) };
+			static REL::Relocation<func_t> func{ REL::ID(404814) };
 			return func(this);
 		}
 
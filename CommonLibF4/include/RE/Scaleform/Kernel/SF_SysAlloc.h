@@ -37,14 +37,14 @@ namespace RE::Scaleform
 		bool InitHeapEngine(const void* a_heapDesc) override  // 01
 		{
 			using func_t = decltype(&SysAlloc::InitHeapEngine);
-			REL::Relocation<func_t> func{ REL::ID(1047970) };
+			static REL::Relocation<func_t> func{ REL::ID(1047970) };
 			return func(this, a_heapDesc);
 		}
 
 		bool ShutdownHeapEngine() override  // 02
 		{
 			using func_t = decltype(&SysAlloc::ShutdownHeapEngine);
-			REL::Relocation<func_t> func{ REL::ID(1207169) };
+			static REL::Relocation<func_t> func{ REL::ID(1207169) };
 			return func(this);
 		}
 
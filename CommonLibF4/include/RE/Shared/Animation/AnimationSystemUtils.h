@@ -38,21 +38,21 @@ namespace RE
 		inline bool GetEventSourcePointerFromGraphManager(BSTSmartPointer<BSAnimationGraphManager>& a_animGraphMgr, std::uint32_t a_num, BSTEventSource<BSAnimationGraphEvent>*& a_source)
 		{
 			using func_t = decltype(&AnimationSystemUtils::GetEventSourcePointerFromGraphManager);
-			REL::Relocation<func_t> func{ REL::ID(323983) };
+			static REL::Relocation<func_t> func{ REL::ID(323983) };
 			return func(a_animGraphMgr, a_num, a_source);
 		}
 
 		inline bool GetEventSourcePointerFromReference(TESObjectREFR& a_object, BSTEventSource<BSAnimationGraphEvent>*& a_source, std::uint32_t a_num)
 		{
 			using func_t = decltype(&AnimationSystemUtils::GetEventSourcePointerFromReference);
-			REL::Relocation<func_t> func{ REL::ID(137530) };
+			static REL::Relocation<func_t> func{ REL::ID(137530) };
 			return func(a_object, a_source, a_num);
 		}
 
 		inline bool ActivateGamebryoSequence(NiAVObject* a_object, const BSFixedString& a_name)
 		{
 			using func_t = decltype(&AnimationSystemUtils::ActivateGamebryoSequence);
-			REL::Relocation<func_t> func{ REL::ID(628888) };
+			static REL::Relocation<func_t> func{ REL::ID(628888) };
 			return func(a_object, a_name);
 		}
 	}
@@ -48,31 +48,31 @@ namespace RE
 		bool SetGraphVariableBool(const BSFixedString& asVariableName, bool newVal)
 		{
 			using func_t = decltype(&IAnimationGraphManagerHolder::SetGraphVariableBool);
-			REL::Relocation<func_t> func{ REL::ID(1437197) };
+			static REL::Relocation<func_t> func{ REL::ID(1437197) };
 			return func(this, asVariableName, newVal);
 		}
 		bool SetGraphVariableInt(const BSFixedString& asVariableName, int newVal)
 		{
 			using func_t = decltype(&IAnimationGraphManagerHolder::SetGraphVariableInt);
-			REL::Relocation<func_t> func{ REL::ID(732926) };
+			static REL::Relocation<func_t> func{ REL::ID(732926) };
 			return func(this, asVariableName, newVal);
 		}
 		bool SetGraphVariableFloat(const BSFixedString& asVariableName, float newVal)
 		{
 			using func_t = decltype(&IAnimationGraphManagerHolder::SetGraphVariableFloat);
-			REL::Relocation<func_t> func{ REL::ID(27400) };
+			static REL::Relocation<func_t> func{ REL::ID(27400) };
 			return func(this, asVariableName, newVal);
 		}
 		bool SetGraphVariableNiPoint3(const BSFixedString& asVariableName, NiPoint3 newVal)
 		{
 			using func_t = decltype(&IAnimationGraphManagerHolder::SetGraphVariableNiPoint3);
-			REL::Relocation<func_t> func{ REL::ID(905324) };
+			static REL::Relocation<func_t> func{ REL::ID(905324) };
 			return func(this, asVariableName, newVal);
 		}
 		bool SetGraphVariableNiQuaternion(const BSFixedString& asVariableName, NiQuaternion newVal)
 		{
 			using func_t = decltype(&IAnimationGraphManagerHolder::SetGraphVariableNiQuaternion);
-			REL::Relocation<func_t> func{ REL::ID(1343874) };
+			static REL::Relocation<func_t> func{ REL::ID(1343874) };
 			return func(this, asVariableName, newVal);
 		}
 	};
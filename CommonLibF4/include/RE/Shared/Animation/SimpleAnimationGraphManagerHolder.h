@@ -22,7 +22,7 @@ namespace RE
 		bool CreateBackgroundSimpleManager(NiAVObject& a_object, IO_TASK_PRIORITY a_priority)
 		{
 			using func_t = decltype(&SimpleAnimationGraphManagerHolder::CreateBackgroundSimpleManager);
-			REL::Relocation<func_t> func{ REL::ID(505018) };
+			static REL::Relocation<func_t> func{ REL::ID(505018) };
 			return func(this, a_object, a_priority);
 		}
 
@@ -14,21 +14,21 @@ namespace RE
 	public:
 		[[nodiscard]] static TES* GetSingleton()
 		{
-			REL::Relocation<TES**> singleton{ REL::ID(1194835) };
+			static REL::Relocation<TES**> singleton{ REL::ID(1194835) };
 			return *singleton;
 		}
 
 		TESWorldSpace* GetWorldSpace()
 		{
 			using func_t = decltype(&TES::GetWorldSpace);
-			REL::Relocation<func_t> func{ REL::ID(778800) };
+			static REL::Relocation<func_t> func{ REL::ID(778800) };
 			return func(this);
 		}
 
 		TESObjectCell* GetSkyCell()
 		{
 			using func_t = decltype(&TES::GetSkyCell);
-			REL::Relocation<func_t> func{ REL::ID(993788) };
+			static REL::Relocation<func_t> func{ REL::ID(993788) };
 			return func(this);
 		}
 
@@ -15,7 +15,7 @@ namespace RE
 
 		static BGSDecalManager* GetSingleton()
 		{
-			REL::Relocation<BGSDecalManager**> singleton{ REL::ID(716374) };
+			static REL::Relocation<BGSDecalManager**> singleton{ REL::ID(716374) };
 			return *singleton;
 		}
 
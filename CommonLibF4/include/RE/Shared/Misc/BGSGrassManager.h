@@ -11,7 +11,7 @@ namespace RE
 	public:
 		[[nodiscard]] static BGSGrassManager* GetSingleton()
 		{
-			REL::Relocation<BGSGrassManager**> singleton{ REL::ID(347939) };
+			static REL::Relocation<BGSGrassManager**> singleton{ REL::ID(347939) };
 			return *singleton;
 		}
 
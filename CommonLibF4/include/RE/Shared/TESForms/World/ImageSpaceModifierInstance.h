@@ -62,14 +62,14 @@ namespace RE
 		static ImageSpaceModifierInstanceForm* Trigger(const BSFixedString& a_name)
 		{
 			using func_t = decltype(&ImageSpaceModifierInstanceForm::Trigger);
-			REL::Relocation<func_t> func{ REL::ID(1216312) };
+			static REL::Relocation<func_t> func{ REL::ID(1216312) };
 			return func(a_name);
 		}
 
 		static void Stop(const BSFixedString& a_name)
 		{
 			using func_t = decltype(&ImageSpaceModifierInstanceForm::Stop);
-			REL::Relocation<func_t> func{ REL::ID(549773) };
+			static REL::Relocation<func_t> func{ REL::ID(549773) };
 			return func(a_name);
 		}
 
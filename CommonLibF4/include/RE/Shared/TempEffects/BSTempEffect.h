@@ -67,14 +67,14 @@ namespace RE
 		BSTempEffect* ctor()
 		{
 			using func_t = decltype(&BSTempEffect::ctor);
-			REL::Relocation<func_t> func{ REL::ID(3328) };
+			static REL::Relocation<func_t> func{ REL::ID(3328) };
 			return func(this);
 		}
 
 		BSTempEffect* ctor2(TESObjectCELL* a_cell, float a_time)
 		{
 			using func_t = decltype(&BSTempEffect::ctor2);
-			REL::Relocation<func_t> func{ REL::ID(176918) };
+			static REL::Relocation<func_t> func{ REL::ID(176918) };
 			return func(this, a_cell, a_time);
 		}
 	};
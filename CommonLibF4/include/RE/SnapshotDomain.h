@@ -0,0 +1,70 @@
+#pragma once
+
+namespace RE
+{
+	namespace detail
+	{
+		inline constexpr std::size_t SNAPSHOT_STRIPES = 0x10;
+
+		// hands threads out round robin, so that up to SNAPSHOT_STRIPES of them never share a stripe
+		[[nodiscard]] inline std::size_t thread_stripe() noexcept
+		{
+			static std::atomic<std::size_t> next{ 0 };
+			static thread_local const auto stripe = next.fetch_add(1, std::memory_order_relaxed) % SNAPSHOT_STRIPES;
+			return stripe;
+		}
+
+		// read-copy-update over two reader counts per stripe: entering and leaving touch only the calling
+		// thread's stripe, while a writer flips the epoch twice and waits out the readers of each side in
+		// every stripe before it frees anything
+		class SnapshotDomain
+		{
+		public:
+			class reader_guard
+			{
+			public:
+				explicit reader_guard(const SnapshotDomain& a_domain) noexcept :
+					_readers(a_domain._stripes[thread_stripe()].readers[a_domain._epoch.load() & 1])
+				{
+					++_readers;
+				}
+
+				reader_guard(const reader_guard&) = delete;
+				reader_guard(reader_guard&&) = delete;
+
+				~reader_guard() { _readers.fetch_sub(1, std::memory_order_release); }
+
+				reader_guard& operator=(const reader_guard&) = delete;
+				reader_guard& operator=(reader_guard&&) = delete;
+
+			private:
+				std::atomic<std::uint32_t>& _readers;
+			};
+
+			// returns once no reader can still see anything unpublished before the call
+			void synchronize() const noexcept
+			{
+				for (std::size_t i = 0; i < 2; ++i) {
+					const auto epoch = _epoch.fetch_add(1);
+					for (const auto& stripe : _stripes) {
+						while (stripe.readers[epoch & 1].load() != 0) {
+							std::this_thread::yield();
+						}
+					}
+				}
+			}
+
+		private:
+			struct alignas(0x40) stripe_t
+			{
+			public:
+				// members
+				std::array<std::atomic<std::uint32_t>, 2> readers{};
+			};
+
+			// members
+			mutable std::atomic<std::uint32_t> _epoch{ 0 };
+			mutable std::array<stripe_t, SNAPSHOT_STRIPES> _stripes{};
+		};
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+// generated by scripts/id_generate.py
+namespace REL
+{
+	namespace detail
+	{
+		// every id the library resolves, sorted, so F4SE::Init can resolve them in one sweep
+		inline constexpr std::array<std::uint64_t, 764> LIBRARY_IDS{
+			764, 1607, 2562, 3328, 4042, 5426, 8308, 8331, 9236, 10442,
+			12355, 15937, 16045, 16321, 19696, 24787, 25528, 27400, 33539, 33658,
+			34114, 34412, 40925, 43433, 43983, 45807, 60674, 61252, 63218, 65166,
+			66546, 66597, 67637, 68625, 69261, 74587, 74749, 75173, 78185, 79066,
+			80812, 81339, 81406, 81787, 82123, 84112, 88091, 88488, 89563, 91810,
+			92696, 95118, 99795, 103011, 106578, 106892, 109630, 109702, 110930, 111275,
+			111648, 113585, 121052, 127974, 129892, 137530, 140387, 147297, 150211, 152177,
+			157617, 161040, 161235, 161743, 163409, 164912, 166230, 170742, 171771, 175576,
+			175796, 176918, 177801, 178075, 178085, 178784, 182949, 184463, 185153, 187096,
+			187113, 188910, 190238, 192840, 193329, 194808, 197682, 198281, 200912, 206895,
+			207644, 209891, 222813, 224532, 226148, 226372, 228366, 230928, 236955, 239190,
+			240214, 241551, 242362, 242538, 244233, 244786, 254895, 261092, 262786, 265501,
+			267930, 275798, 277641, 278402, 288964, 289864, 289935, 293822, 294691, 298633,
+			300623, 302888, 303410, 307381, 311146, 312533, 312883, 315318, 315427, 320514,
+			323518, 323983, 325206, 325252, 326895, 327814, 332518, 333415, 336186, 339855,
+			340630, 343176, 343213, 344866, 345043, 346773, 347939, 350112, 352046, 353960,
+			358512, 364155, 367992, 373342, 376940, 378876, 379932, 379998, 380177, 380891,
+			382332, 384264, 390064, 394640, 398143, 404814, 405390, 405603, 407460, 407532,
+			410363, 410500, 412086, 416649, 418201, 419974, 421543, 421579, 422985, 423200,
+			424286, 425866, 426737, 426990, 430292, 430381, 434717, 438299, 442479, 443081,
+			445184, 445210, 452591, 453212, 454316, 455011, 456256, 457340, 461710, 468580,
+			469959, 472297, 474137, 476025, 476687, 482454, 482744, 484974, 485633, 485648,
+			487858, 489521, 491493, 493272, 500304, 501899, 505018, 507142, 515799, 520184,
+			520890, 522068, 523613, 526625, 526727, 526783, 531584, 533106, 541793, 542100,
+			543218, 543595, 544646, 544871, 548587, 549773, 553234, 554863, 557671, 559542,
+			561749, 563587, 564356, 565203, 567603, 569432, 570121, 571037, 572286, 573549,
+			576234, 578487, 583255, 583584, 583997, 590232, 591200, 593605, 593818, 594991,
+			596187, 600795, 603621, 604942, 605837, 613616, 628888, 629579, 629658, 636327,
+			636411, 637314, 638606, 641361, 642758, 644374, 646841, 646887, 647156, 648543,
+			652767, 655847, 657126, 659184, 660416, 661617, 663107, 669336, 672256, 672405,
+			673185, 676851, 679373, 685859, 688500, 688575, 689441, 690952, 691815, 693228,
+			695696, 695914, 696410, 697019, 700869, 701969, 702948, 704517, 705530, 706318,
+			707810, 709728, 711558, 713423, 714336, 716374, 719279, 724778, 726763, 728465,
+			730034, 731482, 732926, 736815, 737625, 747470, 750380, 750682, 751660, 753531,
+			755490, 756304, 760865, 761249, 761346, 762897, 762999, 763948, 765242, 766555,
+			767844, 770035, 770140, 776503, 777279, 778043, 778687, 778800, 782953, 783380,
+			787908, 788691, 788799, 788895, 791183, 793042, 795983, 796946, 799546, 807071,
+			809145, 817283, 817670, 817727, 818081, 823570, 825410, 829033, 832872, 833923,
+			835184, 835323, 836011, 838886, 843650, 844985, 845050, 846648, 847741, 848563,
+			849008, 852814, 855637, 856221, 862142, 863029, 863406, 865881, 868663, 870924,
+			875116, 876001, 878080, 879298, 880926, 885783, 888419, 893703, 897225, 897287,
+			897539, 899120, 900802, 900857, 901511, 901626, 905324, 905705, 907092, 908502,
+			910422, 910917, 912279, 912291, 915329, 918107, 922599, 922938, 923307, 927837,
+			928518, 930001, 930785, 937304, 938370, 939898, 947344, 948181, 948832, 949839,
+			950217, 951267, 952687, 958611, 959572, 959652, 961172, 964859, 967277, 974443,
+			977675, 981533, 988029, 989661, 990965, 993788, 996227, 999442, 1000678, 1004883,
+			1006044, 1012004, 1013228, 1013515, 1015879, 1017544, 1024513, 1028217, 1029727, 1035436,
+			1035622, 1036693, 1039253, 1041558, 1042515, 1047917, 1047970, 1048465, 1048494, 1049748,
+			1049933, 1053584, 1054567, 1056093, 1057231, 1057731, 1058127, 1058211, 1060450, 1061864,
+			1062418, 1064874, 1065016, 1065592, 1066398, 1071829, 1071950, 1078979, 1079111, 1081933,
+			1085394, 1087134, 1089189, 1094113, 1095748, 1095775, 1096263, 1101379, 1101832, 1103472,
+			1107298, 1107859, 1108112, 1109888, 1110986, 1112285, 1120904, 1123850, 1126369, 1129741,
+			1134204, 1135470, 1136607, 1137654, 1140080, 1143155, 1144014, 1148686, 1154936, 1159619,
+			1160067, 1160841, 1161595, 1161724, 1163005, 1163130, 1171980, 1172680, 1174072, 1174340,
+			1176757, 1180004, 1181584, 1182019, 1182457, 1187686, 1190448, 1191277, 1191757, 1194835,
+			1198116, 1200959, 1201550, 1204430, 1207169, 1208720, 1208863, 1211381, 1212084, 1216312,
+			1220834, 1221948, 1222521, 1223055, 1225102, 1225249, 1225688, 1227993, 1229383, 1231665,
+			1232532, 1235449, 1238666, 1240396, 1241790, 1242168, 1243386, 1246373, 1247917, 1247963,
+			1251703, 1252764, 1255534, 1256126, 1257653, 1259999, 1263128, 1267198, 1268435, 1270079,
+			1270929, 1274450, 1274842, 1275731, 1277606, 1279207, 1279247, 1279453, 1280130, 1284221,
+			1286348, 1288513, 1291190, 1291591, 1292493, 1295596, 1296646, 1300345, 1304977, 1306546,
+			1307082, 1307263, 1309368, 1309529, 1309722, 1309967, 1310228, 1312083, 1315637, 1316475,
+			1318193, 1320496, 1320828, 1321110, 1321341, 1321764, 1322816, 1323437, 1323703, 1324037,
+			1324925, 1326073, 1327069, 1330475, 1334794, 1335675, 1337764, 1343874, 1346879, 1350784,
+			1354005, 1359409, 1360149, 1365745, 1367004, 1367353, 1368313, 1369106, 1370368, 1372435,
+			1373349, 1374542, 1374956, 1375091, 1376336, 1376557, 1376648, 1376729, 1377567, 1378294,
+			1379385, 1382765, 1388308, 1390486, 1391151, 1396536, 1396707, 1397326, 1397856, 1403529,
+			1403591, 1404410, 1405563, 1407033, 1407520, 1414637, 1415090, 1416254, 1416967, 1417289,
+			1419793, 1424022, 1425097, 1425657, 1426810, 1429302, 1430301, 1431014, 1432487, 1432894,
+			1433009, 1436639, 1437197, 1444212, 1444875, 1444949, 1444952, 1449576, 1452752, 1453240,
+			1454788, 1460935, 1463640, 1464304, 1465690, 1468639, 1474995, 1477730, 1482704, 1487963,
+			1488486, 1490431, 1491228, 1491349, 1491502, 1493537, 1495042, 1495205, 1495929, 1502425,
+			1502917, 1503497, 1508189, 1508457, 1510731, 1512872, 1513035, 1514864, 1514984, 1515099,
+			1516202, 1517430, 1519438, 1519575, 1522194, 1523343, 1524657, 1526234, 1533262, 1541862,
+			1544159, 1547000, 1547604, 1548060, 1551978, 1552322, 1554334, 1555929, 1558409, 1561984,
+			1565031, 1569384, 1569706, 1569773, 1570634, 1571567, 1573130, 1573164, 1573363, 1577199,
+			1578434, 1578706, 1582181, 1583365,
+		};
+	}
+}
@@ -1,6 +1,13 @@
 #pragma once
 
 #include <cstdint>
+
+#ifndef _WIN32
+#	include <cinttypes>
+#	include <fstream>
+#	include <sys/mman.h>
+#	include <unistd.h>
+#endif
 #define REL_MAKE_MEMBER_FUNCTION_POD_TYPE_HELPER_IMPL(a_nopropQual, a_propQual, ...)              \
 	template <                                                                                    \
 		class R,                                                                                  \
@@ -185,8 +192,262 @@ namespace REL
 		}
 	}
 
+	// changes the protection of the pages a PatchTransaction writes to
+	class PageProtector
+	{
+	public:
+		virtual ~PageProtector() = default;
+
+		// makes pages writable from a_address, stopping early where their protection changes, and returns
+		// how many bytes it covered (0 on failure) along with the protection those bytes had before
+		[[nodiscard]] virtual std::size_t unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) = 0;
+		[[nodiscard]] virtual bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) = 0;
+		virtual void flush(std::uintptr_t a_address, std::size_t a_size) noexcept = 0;
+		[[nodiscard]] virtual std::size_t page_size() const noexcept = 0;
+
+		[[nodiscard]] static PageProtector& get() noexcept;
+	};
+
+#ifndef _WIN32
+	// the same over mprotect, for builds off windows. mprotect does not report the old protection, so it
+	// is read back from /proc/self/maps
+	class MprotectPageProtector :
+		public PageProtector
+	{
+	public:
+		struct mapping_t
+		{
+		public:
+			// members
+			std::uintptr_t begin{ 0 };
+			std::uintptr_t end{ 0 };
+			std::uint32_t protection{ 0 };
+		};
+
+		[[nodiscard]] std::size_t unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) override
+		{
+			const auto mapping = find(a_address);
+			if (!mapping) {
+				return 0;
+			}
+
+			const auto size = (std::min)(a_size, static_cast<std::size_t>(mapping->end - a_address));
+			if (::mprotect(reinterpret_cast<void*>(a_address), size, PROT_READ | PROT_WRITE | PROT_EXEC) != 0) {
+				return 0;
+			}
+
+			a_old = mapping->protection;
+			return size;
+		}
+
+		[[nodiscard]] bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) override
+		{
+			return ::mprotect(reinterpret_cast<void*>(a_address), a_size, static_cast<int>(a_protection)) == 0;
+		}
+
+		void flush(std::uintptr_t a_address, std::size_t a_size) noexcept override
+		{
+			const auto begin = reinterpret_cast<char*>(a_address);
+			__builtin___clear_cache(begin, begin + a_size);
+		}
+
+		[[nodiscard]] std::size_t page_size() const noexcept override
+		{
+			return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		}
+
+		// the mapping which holds a_address, with its protection as PROT_ flags
+		[[nodiscard]] static std::optional<mapping_t> find(std::uintptr_t a_address)
+		{
+			std::ifstream maps{ "/proc/self/maps" };
+			for (std::string line; std::getline(maps, line);) {
+				mapping_t mapping{};
+				char perms[5]{};
+				if (std::sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR " %4s", &mapping.begin, &mapping.end, perms) == 3 &&
+					mapping.begin <= a_address && a_address < mapping.end) {
+					mapping.protection =
+						(perms[0] == 'r' ? PROT_READ : 0) |
+						(perms[1] == 'w' ? PROT_WRITE : 0) |
+						(perms[2] == 'x' ? PROT_EXEC : 0);
+					return mapping;
+				}
+			}
+			return std::nullopt;
+		}
+	};
+#endif
+
+	// queues writes to code, then applies them with one protection change per run of pages and a single
+	// instruction cache flush. safe_write and safe_fill join the innermost open transaction on their thread,
+	// so reads made while it is open still see memory as it was before the transaction.
+	// whatever is still queued when it closes is committed then, and a failure at that point is fatal, so
+	// call commit() yourself to find out whether the writes went through
+	class PatchTransaction
+	{
+	public:
+		PatchTransaction() :
+			PatchTransaction(PageProtector::get())
+		{}
+
+		explicit PatchTransaction(PageProtector& a_protector) noexcept :
+			_protector(a_protector),
+			_outer(std::exchange(_current, this))
+		{}
+
+		PatchTransaction(const PatchTransaction&) = delete;
+		PatchTransaction(PatchTransaction&&) = delete;
+
+		~PatchTransaction()
+		{
+			_current = _outer;
+			if (!commit()) {
+				stl::report_and_fail("failed to apply a patch transaction"sv);
+			}
+		}
+
+		PatchTransaction& operator=(const PatchTransaction&) = delete;
+		PatchTransaction& operator=(PatchTransaction&&) = delete;
+
+		[[nodiscard]] static PatchTransaction* current() noexcept { return _current; }
+
+		[[nodiscard]] bool empty() const noexcept { return _writes.empty(); }
+		[[nodiscard]] std::size_t size() const noexcept { return _writes.size(); }
+
+		void write(std::uintptr_t a_dst, const void* a_src, std::size_t a_count)
+		{
+			if (a_count > 0) {
+				const auto src = static_cast<const std::uint8_t*>(a_src);
+				_writes.push_back({ a_dst, _bytes.size(), a_count });
+				_bytes.insert(_bytes.end(), src, src + a_count);
+			}
+		}
+
+		template <std::integral T>
+		void write(std::uintptr_t a_dst, const T& a_data)
+		{
+			write(a_dst, std::addressof(a_data), sizeof(T));
+		}
+
+		template <class T>
+		void write(std::uintptr_t a_dst, std::span<T> a_data)
+		{
+			write(a_dst, a_data.data(), a_data.size_bytes());
+		}
+
+		void fill(std::uintptr_t a_dst, std::uint8_t a_value, std::size_t a_count)
+		{
+			if (a_count > 0) {
+				_writes.push_back({ a_dst, _bytes.size(), a_count });
+				_bytes.insert(_bytes.end(), a_count, a_value);
+			}
+		}
+
+		// applies every queued write in order, or none of them if a page could not be made writable,
+		// and returns whether they were applied. the queue is empty afterwards either way
+		[[nodiscard]] bool commit()
+		{
+			if (_writes.empty()) {
+				return true;
+			}
+
+			std::vector<protection_t> changed;
+			bool success = true;
+			for (const auto& [address, size] : page_runs()) {
+				for (auto pos = address; success && pos < address + size;) {
+					std::uint32_t old{ 0 };
+					const auto len = std::min(_protector.unprotect(pos, address + size - pos, old), address + size - pos);
+					if (len > 0) {
+						changed.push_back({ pos, len, old });
+						pos += len;
+					} else {
+						success = false;
+					}
+				}
+			}
+
+			auto lo = std::numeric_limits<std::uintptr_t>::max();
+			std::uintptr_t hi = 0;
+			if (success) {
+				for (const auto& write : _writes) {
+					std::memcpy(reinterpret_cast<void*>(write.address), _bytes.data() + write.offset, write.size);
+					lo = std::min(lo, write.address);
+					hi = std::max(hi, write.address + write.size);
+				}
+			}
+
+			for (const auto& [address, size, old] : changed) {
+				success = _protector.protect(address, size, old) && success;
+			}
+
+			if (lo < hi) {
+				_protector.flush(lo, hi - lo);
+			}
+
+			discard();
+			return success;
+		}
+
+		void discard() noexcept
+		{
+			_writes.clear();
+			_bytes.clear();
+		}
+
+	private:
+		struct write_t
+		{
+			std::uintptr_t address;
+			std::size_t offset;
+			std::size_t size;
+		};
+
+		struct protection_t
+		{
+			std::uintptr_t address;
+			std::size_t size;
+			std::uint32_t old;
+		};
+
+		// the pages under every write, merged into runs of adjacent pages
+		[[nodiscard]] std::vector<std::pair<std::uintptr_t, std::size_t>> page_runs() const
+		{
+			const auto page = _protector.page_size();
+			std::vector<std::pair<std::uintptr_t, std::uintptr_t>> pages;
+			pages.reserve(_writes.size());
+			for (const auto& write : _writes) {
+				const auto end = write.address + write.size;
+				pages.emplace_back(write.address - write.address % page, end + (page - end % page) % page);
+			}
+			std::sort(pages.begin(), pages.end());
+
+			std::vector<std::pair<std::uintptr_t, std::size_t>> runs;
+			auto [first, last] = pages.front();
+			for (const auto& [begin, end] : pages) {
+				if (begin > last) {
+					runs.emplace_back(first, last - first);
+					first = begin;
+				}
+				last = std::max(last, end);
+			}
+			runs.emplace_back(first, last - first);
+			return runs;
+		}
+
+		static inline thread_local PatchTransaction* _current{ nullptr };
+
+		PageProtector& _protector;
+		PatchTransaction* _outer{ nullptr };
+		std::vector<write_t> _writes;
+		std::vector<std::uint8_t> _bytes;
+	};
+
 	inline void safe_write(std::uintptr_t a_dst, const void* a_src, std::size_t a_count)
 	{
+		if (const auto transaction = PatchTransaction::current(); transaction) {
+			transaction->write(a_dst, a_src, a_count);
+			return;
+		}
+
 		std::uint32_t old{ 0 };
 		auto success =
 			WinAPI::VirtualProtect(
@@ -221,6 +482,11 @@ namespace REL
 
 	inline void safe_fill(std::uintptr_t a_dst, std::uint8_t a_value, std::size_t a_count)
 	{
+		if (const auto transaction = PatchTransaction::current(); transaction) {
+			transaction->fill(a_dst, a_value, a_count);
+			return;
+		}
+
 		std::uint32_t old{ 0 };
 		auto success =
 			WinAPI::VirtualProtect(
@@ -470,6 +736,44 @@ namespace REL
 		std::uintptr_t _base{ 0 };
 	};
 
+	namespace detail
+	{
+		struct preload_node
+		{
+			std::span<const std::uint64_t> ids;
+			const preload_node* next{ nullptr };
+		};
+
+		// nodes are linked during static initialization, before anything can read the list
+		inline constinit const preload_node* preload_head{ nullptr };
+	}
+
+	// registers ids a plugin uses on top of the library's own, so F4SE::Init resolves them in the same sweep
+	// i.e. static REL::PreloadIDs<1425657, 267930> preload;
+	template <std::uint64_t... IDs>
+	class PreloadIDs
+	{
+	public:
+		PreloadIDs() noexcept :
+			_node{ IDS, detail::preload_head }
+		{
+			detail::preload_head = std::addressof(_node);
+		}
+
+		PreloadIDs(const PreloadIDs&) = delete;
+		PreloadIDs(PreloadIDs&&) = delete;
+
+		~PreloadIDs() = default;
+
+		PreloadIDs& operator=(const PreloadIDs&) = delete;
+		PreloadIDs& operator=(PreloadIDs&&) = delete;
+
+	private:
+		static constexpr std::array<std::uint64_t, sizeof...(IDs)> IDS{ IDs... };
+
+		detail::preload_node _node;
+	};
+
 	class IDDatabase
 	{
 	private:
@@ -479,10 +783,64 @@ namespace REL
 			std::uint64_t offset;
 		};
 
+		// v2 databases start with a header instead of the v1 mapping count
+		struct header_t
+		{
+			enum Flag : std::uint32_t
+			{
+				kNone = 0,
+				kDense = 1u << 0,  // a dense block of offsets, indexed by id, follows the packed mappings
+			};
+
+			// members
+			std::uint64_t magic;       // 00
+			std::uint32_t format;      // 08
+			std::uint32_t flags;       // 0C
+			std::uint64_t count;       // 10 - number of mappings
+			std::uint64_t idLimit;     // 18 - largest id + 1
+			std::uint64_t packedSize;  // 20 - size of the packed mappings, in bytes
+		};
+		static_assert(sizeof(header_t) == 0x28);
+
+		// offset indices hold the same mappings as their database, sorted by offset, then id
+		struct offsets_header_t
+		{
+			// members
+			std::uint64_t magic;       // 00
+			std::uint32_t format;      // 08
+			std::uint32_t pad0C;       // 0C
+			std::uint64_t count;       // 10 - number of mappings
+			std::uint64_t sourceSize;  // 18 - size of the database, in bytes
+			std::uint64_t sourceHash;  // 20 - see source_hash
+		};
+		static_assert(sizeof(offsets_header_t) == 0x28);
+
 	public:
+		enum class Strategy
+		{
+			kSearch,  // binary search over the id2offset mappings, if the database has any
+			kDense,   // direct index into a table of offsets, indexed by id
+		};
+
+		// "ADDRLIB\0", which can never be mistaken for the mapping count of a v1 database
+		static constexpr std::uint64_t MAGIC = 0x0042494C52444441;
+		static constexpr std::uint32_t FORMAT = 2;
+
+		// "ADDROFS\0", the offset index written alongside each database
+		static constexpr std::uint64_t OFFSETS_MAGIC = 0x0053464F52444441;
+		static constexpr std::uint32_t OFFSETS_FORMAT = 2;
+
 		IDDatabase(const IDDatabase&) = delete;
 		IDDatabase(IDDatabase&&) = delete;
 
+		explicit IDDatabase(std::filesystem::path a_path) :
+			_path(std::move(a_path))
+		{
+			load(_path);
+		}
+
+		~IDDatabase() = default;
+
 		IDDatabase& operator=(const IDDatabase&) = delete;
 		IDDatabase& operator=(IDDatabase&&) = delete;
 
@@ -490,123 +848,494 @@ namespace REL
 		{
 		public:
 			using value_type = mapping_t;
-			using container_type = std::vector<value_type>;
+			using container_type = std::span<const value_type>;
 			using size_type = typename container_type::size_type;
-			using const_iterator = typename container_type::const_iterator;
-			using const_reverse_iterator = typename container_type::const_reverse_iterator;
+			using const_iterator = typename container_type::iterator;
+			using const_reverse_iterator = typename container_type::reverse_iterator;
+
+			struct nearest_t
+			{
+				std::uint64_t id;   // the closest mapping at or below the offset
+				std::size_t delta;  // the distance from that mapping to the offset
+			};
 
+			// maps the offset index written alongside the database, and only builds
+			// the index itself, using the given policy, if that file is missing or stale
 			template <class ExecutionPolicy>
-			explicit Offset2ID(ExecutionPolicy&& a_policy)  // NOLINT(bugprone-forwarding-reference-overload)
+			Offset2ID(const IDDatabase& a_iddb, ExecutionPolicy&& a_policy)  // NOLINT(bugprone-forwarding-reference-overload)
 				requires(std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>)
 			{
-				const auto id2offset = IDDatabase::get().get_id2offset();
-				_offset2id.reserve(id2offset.size());
-				_offset2id.insert(_offset2id.begin(), id2offset.begin(), id2offset.end());
-				std::sort(
-					a_policy,
-					_offset2id.begin(),
-					_offset2id.end(),
-					[](auto&& a_lhs, auto&& a_rhs) {
-						return a_lhs.offset < a_rhs.offset;
+				if (map(a_iddb)) {
+					return;
+				}
+
+				_storage.reserve(a_iddb.size());
+				if (!a_iddb._packed.empty()) {  // packed mappings are already sorted by offset
+					a_iddb.unpack([&](std::uint64_t a_id, std::uint64_t a_offset) {
+						_storage.push_back({ a_id, a_offset });
 					});
+				} else {
+					const auto id2offset = a_iddb.get_id2offset();
+					_storage.insert(_storage.begin(), id2offset.begin(), id2offset.end());
+					std::sort(
+						a_policy,
+						_storage.begin(),
+						_storage.end(),
+						[](auto&& a_lhs, auto&& a_rhs) {
+							return a_lhs.offset != a_rhs.offset ?
+                                       a_lhs.offset < a_rhs.offset :
+                                       a_lhs.id < a_rhs.id;
+						});
+				}
+				_offset2id = _storage;
 			}
 
+			template <class ExecutionPolicy>
+			explicit Offset2ID(ExecutionPolicy&& a_policy)  // NOLINT(bugprone-forwarding-reference-overload)
+				requires(std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>)
+				:
+				Offset2ID(IDDatabase::get(), std::forward<ExecutionPolicy>(a_policy))
+			{}
+
+			explicit Offset2ID(const IDDatabase& a_iddb) :
+				Offset2ID(a_iddb, std::execution::sequenced_policy{})
+			{}
+
 			Offset2ID() :
 				Offset2ID(std::execution::sequenced_policy{})
 			{}
 
+			Offset2ID(const Offset2ID&) = delete;
+			Offset2ID(Offset2ID&&) noexcept = default;
+
+			~Offset2ID() = default;
+
+			Offset2ID& operator=(const Offset2ID&) = delete;
+			Offset2ID& operator=(Offset2ID&&) noexcept = default;
+
+			// the id mapped to exactly this offset
 			[[nodiscard]] std::uint64_t operator()(std::size_t a_offset) const
 			{
 				if (_offset2id.empty()) {
 					stl::report_and_fail("data is empty"sv);
 				}
 
-				const mapping_t elem{ 0, a_offset };
-				const auto it = std::lower_bound(
+				const auto id = find(a_offset);
+				if (!id) {
+					stl::report_and_fail("offset not found"sv);
+				}
+
+				return *id;
+			}
+
+			[[nodiscard]] std::optional<std::uint64_t> find(std::size_t a_offset) const noexcept
+			{
+				const auto it = lower_bound(a_offset);
+				return it != _offset2id.end() && it->offset == a_offset ?
+                           std::make_optional(it->id) :
+                           std::nullopt;
+			}
+
+			// the closest id at or below the offset, for addresses inside a function or object
+			[[nodiscard]] std::optional<nearest_t> nearest(std::size_t a_offset) const noexcept
+			{
+				auto it = std::upper_bound(
 					_offset2id.begin(),
 					_offset2id.end(),
-					elem,
+					a_offset,
 					[](auto&& a_lhs, auto&& a_rhs) {
-						return a_lhs.offset < a_rhs.offset;
+						return a_lhs < a_rhs.offset;
 					});
-				if (it == _offset2id.end()) {
-					stl::report_and_fail("offset not found"sv);
+				if (it == _offset2id.begin()) {
+					return std::nullopt;
 				}
 
-				return it->id;
+				it = lower_bound(static_cast<std::size_t>((--it)->offset));
+				return nearest_t{ it->id, a_offset - static_cast<std::size_t>(it->offset) };
 			}
 
 			[[nodiscard]] const_iterator begin() const noexcept { return _offset2id.begin(); }
-			[[nodiscard]] const_iterator cbegin() const noexcept { return _offset2id.cbegin(); }
+			[[nodiscard]] const_iterator cbegin() const noexcept { return _offset2id.begin(); }
 
 			[[nodiscard]] const_iterator end() const noexcept { return _offset2id.end(); }
-			[[nodiscard]] const_iterator cend() const noexcept { return _offset2id.cend(); }
+			[[nodiscard]] const_iterator cend() const noexcept { return _offset2id.end(); }
 
 			[[nodiscard]] const_reverse_iterator rbegin() const noexcept { return _offset2id.rbegin(); }
-			[[nodiscard]] const_reverse_iterator crbegin() const noexcept { return _offset2id.crbegin(); }
+			[[nodiscard]] const_reverse_iterator crbegin() const noexcept { return _offset2id.rbegin(); }
 
 			[[nodiscard]] const_reverse_iterator rend() const noexcept { return _offset2id.rend(); }
-			[[nodiscard]] const_reverse_iterator crend() const noexcept { return _offset2id.crend(); }
+			[[nodiscard]] const_reverse_iterator crend() const noexcept { return _offset2id.rend(); }
 
 			[[nodiscard]] size_type size() const noexcept { return _offset2id.size(); }
 
+			// whether the index is mapped from disk, rather than built at runtime
+			[[nodiscard]] bool is_mapped() const noexcept { return _mmap.is_open(); }
+
 		private:
+			[[nodiscard]] const_iterator lower_bound(std::size_t a_offset) const noexcept
+			{
+				return std::lower_bound(
+					_offset2id.begin(),
+					_offset2id.end(),
+					a_offset,
+					[](auto&& a_lhs, auto&& a_rhs) {
+						return a_lhs.offset < a_rhs;
+					});
+			}
+
+			[[nodiscard]] bool map(const IDDatabase& a_iddb)
+			{
+				if (!_mmap.open(offsets_path(a_iddb._path))) {
+					return false;
+				}
+
+				const auto header = reinterpret_cast<const offsets_header_t*>(_mmap.data());
+				const std::span source{ reinterpret_cast<const std::byte*>(a_iddb._mmap.data()), a_iddb._mmap.size() };
+				const auto valid =
+					_mmap.size() >= sizeof(offsets_header_t) &&
+					header->magic == OFFSETS_MAGIC &&
+					header->format == OFFSETS_FORMAT &&
+					header->count == a_iddb.size() &&
+					header->count <= (_mmap.size() - sizeof(offsets_header_t)) / sizeof(mapping_t) &&
+					header->sourceSize == source.size() &&
+					header->sourceHash == source_hash(source);
+				if (!valid) {  // stale or foreign, so rebuild it instead
+					_mmap.close();
+					return false;
+				}
+
+				_offset2id = std::span{
+					reinterpret_cast<const mapping_t*>(_mmap.data() + sizeof(offsets_header_t)),
+					static_cast<std::size_t>(header->count)
+				};
+				return true;
+			}
+
+			mmio::mapped_file_source _mmap;
+			std::vector<value_type> _storage;
 			container_type _offset2id;
 		};
 
 		[[nodiscard]] static IDDatabase& get()
 		{
-			static IDDatabase singleton;
+			static IDDatabase singleton{
+				fmt::format(
+					"Data/F4SE/Plugins/version-{}.bin",
+					Module::get().version().string())
+			};
 			return singleton;
 		}
 
 		[[nodiscard]] std::size_t id2offset(std::uint64_t a_id) const
 		{
-			if (_id2offset.empty()) {
-				stl::report_and_fail("data is empty"sv);
+			return found_or_fail(find(a_id));
+		}
+
+		[[nodiscard]] std::size_t id2offset(std::uint64_t a_id, Strategy a_strategy) const
+		{
+			switch (a_strategy) {
+			case Strategy::kDense:
+				if (_strategy != Strategy::kDense) {
+					stl::report_and_fail("dense index is unavailable"sv);
+				}
+				return found_or_fail(dense_find(a_id));
+			case Strategy::kSearch:
+				// v2 databases with a dense block keep no mappings to search, and the block answers the same
+				return found_or_fail(
+					_id2offset.empty() && _strategy == Strategy::kDense ?
+                        dense_find(a_id) :
+                        search_find(a_id));
+			default:
+				stl::report_and_fail("unhandled strategy"sv);
 			}
+		}
 
-			const mapping_t elem{ a_id, 0 };
-			const auto it = std::lower_bound(
-				_id2offset.begin(),
-				_id2offset.end(),
-				elem,
-				[](auto&& a_lhs, auto&& a_rhs) {
-					return a_lhs.id < a_rhs.id;
-				});
-			if (it == _id2offset.end()) {
-				stl::report_and_fail("id not found"sv);
+		// id2offset, for ids which may not be in the database
+		[[nodiscard]] std::optional<std::size_t> find(std::uint64_t a_id) const noexcept
+		{
+			return _strategy == Strategy::kDense ?
+                       dense_find(a_id) :
+                       search_find(a_id);
+		}
+
+		// resolves the given ids, and every id registered through PreloadIDs, in one ordered sweep over the
+		// mappings instead of one search per id at first use, and returns the number found. later lookups of
+		// those ids search only the resolved table. not thread safe, so call it before relocations are resolved
+		std::size_t preload(std::span<const std::uint64_t> a_ids)
+		{
+			std::vector<std::uint64_t> ids(a_ids.begin(), a_ids.end());
+			for (auto node = detail::preload_head; node; node = node->next) {
+				ids.insert(ids.end(), node->ids.begin(), node->ids.end());
+			}
+			std::sort(ids.begin(), ids.end());
+			ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+			if (_strategy == Strategy::kDense) {  // lookups are already a single load
+				return static_cast<std::size_t>(std::count_if(ids.begin(), ids.end(), [&](auto&& a_id) {
+					return dense_find(a_id).has_value();
+				}));
+			}
+
+			std::vector<mapping_t> preloaded;
+			preloaded.reserve(ids.size());
+			const auto less = [](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.id < a_rhs.id;
+			};
+			auto first = _id2offset.begin();
+			const auto last = _id2offset.end();
+			for (const auto id : ids) {
+				// gallop forward from the previous match, then search the bracketed range
+				const mapping_t elem{ id, 0 };
+				std::ptrdiff_t step = 1;
+				auto bound = first;
+				while (std::distance(bound, last) > step && less(*(bound + step), elem)) {
+					bound += step;
+					step *= 2;
+				}
+
+				first = std::lower_bound(bound, std::distance(bound, last) > step ? bound + step + 1 : last, elem, less);
+				if (first == last) {
+					break;
+				} else if (first->id == id) {
+					preloaded.push_back(*first);
+				}
 			}
 
-			return static_cast<std::size_t>(it->offset);
+			_preloaded = std::move(preloaded);
+			return _preloaded.size();
 		}
 
+		// identifies the database an offset index was written from. fnv-1a over 8 byte words, with
+		// the last word zero padded, which is quick enough to check each time the index is mapped
+		[[nodiscard]] static std::uint64_t source_hash(std::span<const std::byte> a_bytes) noexcept
+		{
+			constexpr std::uint64_t prime = 0x100000001B3;
+			std::uint64_t hash = 0xCBF29CE484222325;
+			for (std::size_t i = 0; i < a_bytes.size(); i += sizeof(std::uint64_t)) {
+				std::uint64_t word = 0;
+				std::memcpy(std::addressof(word), a_bytes.data() + i, (std::min)(sizeof(word), a_bytes.size() - i));
+				hash = (hash ^ word) * prime;
+			}
+			return hash;
+		}
+
+		// version-1-10-163-0.bin -> version-1-10-163-0.offsets.bin
+		[[nodiscard]] static std::filesystem::path offsets_path(std::filesystem::path a_database)
+		{
+			return a_database.replace_extension(".offsets.bin");
+		}
+
+		[[nodiscard]] const std::filesystem::path& path() const noexcept { return _path; }
+		[[nodiscard]] std::uint32_t format() const noexcept { return _format; }
+		[[nodiscard]] std::size_t size() const noexcept { return _size; }
+		[[nodiscard]] Strategy strategy() const noexcept { return _strategy; }
+
 	protected:
 		friend class Offset2ID;
 
 		[[nodiscard]] std::span<const mapping_t> get_id2offset() const noexcept { return _id2offset; }
 
 	private:
-		IDDatabase() { load(); }
-		~IDDatabase() = default;
+		// the dense table is only built if it would be no larger than the mappings it indexes
+		static constexpr std::size_t DENSE_SPREAD = sizeof(mapping_t) / sizeof(std::uint32_t);
+		static constexpr auto INVALID_OFFSET = (std::numeric_limits<std::uint32_t>::max)();
 
-		void load()
+		[[nodiscard]] static std::size_t found_or_fail(std::optional<std::size_t> a_offset)
+		{
+			if (!a_offset) {
+				stl::report_and_fail("id not found"sv);
+			}
+
+			return *a_offset;
+		}
+
+		[[nodiscard]] std::optional<std::size_t> dense_find(std::uint64_t a_id) const noexcept
+		{
+			return a_id < _offsets.size() && _offsets[a_id] != INVALID_OFFSET ?
+                       std::make_optional(static_cast<std::size_t>(_offsets[a_id])) :
+                       std::nullopt;
+		}
+
+		[[nodiscard]] std::optional<std::size_t> search_find(std::uint64_t a_id) const noexcept
+		{
+			const mapping_t elem{ a_id, 0 };
+			const auto less = [](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.id < a_rhs.id;
+			};
+
+			if (!_preloaded.empty()) {
+				const auto it = std::lower_bound(_preloaded.begin(), _preloaded.end(), elem, less);
+				if (it != _preloaded.end() && it->id == a_id) {
+					return static_cast<std::size_t>(it->offset);
+				}
+			}
+
+			const auto it = std::lower_bound(_id2offset.begin(), _id2offset.end(), elem, less);
+			return it != _id2offset.end() && it->id == a_id ?
+                       std::make_optional(static_cast<std::size_t>(it->offset)) :
+                       std::nullopt;
+		}
+
+		void build_index()
+		{
+			_index.clear();
+			_offsets = {};
+			_strategy = Strategy::kSearch;
+
+			// mappings are sorted by id, so the last id bounds the table
+			if (_id2offset.empty() ||
+				_id2offset.back().id >= _id2offset.size() * DENSE_SPREAD) {
+				return;
+			}
+
+			const auto oversized = std::any_of(
+				_id2offset.begin(),
+				_id2offset.end(),
+				[](auto&& a_elem) {
+					return a_elem.offset >= INVALID_OFFSET;
+				});
+			if (oversized) {
+				return;
+			}
+
+			_index.resize(static_cast<std::size_t>(_id2offset.back().id + 1), INVALID_OFFSET);
+			for (const auto& [id, offset] : _id2offset) {
+				auto& elem = _index[static_cast<std::size_t>(id)];
+				if (elem == INVALID_OFFSET) {  // match the first mapping a binary search would find
+					elem = static_cast<std::uint32_t>(offset);
+				}
+			}
+			_offsets = _index;
+			_strategy = Strategy::kDense;
+		}
+
+		void load(const std::filesystem::path& a_path)
 		{
-			const auto version = Module::get().version();
-			const auto path = fmt::format(
-				"Data/F4SE/Plugins/version-{}.bin",
-				version.string());
-			if (!_mmap.open(path)) {
-				stl::report_and_fail(fmt::format("failed to open: {}", path));
+			if (!_mmap.open(a_path)) {
+				stl::report_and_fail(fmt::format("failed to open: {}", a_path.string()));
 			}
+
+			if (_mmap.size() >= sizeof(header_t) &&
+				reinterpret_cast<const header_t*>(_mmap.data())->magic == MAGIC) {
+				load_v2();
+			} else {
+				load_v1();
+			}
+		}
+
+		void load_v1()
+		{
+			if (_mmap.size() < sizeof(std::uint64_t)) {
+				stl::report_and_fail("database is truncated"sv);
+			}
+
+			_format = 1;
 			_id2offset = std::span{
 				reinterpret_cast<const mapping_t*>(_mmap.data() + sizeof(std::uint64_t)),
 				*reinterpret_cast<const std::uint64_t*>(_mmap.data())
 			};
+			if (_id2offset.size_bytes() > _mmap.size() - sizeof(std::uint64_t)) {
+				stl::report_and_fail("database is truncated"sv);
+			}
+
+			_size = _id2offset.size();
+			build_index();
 		}
 
+		void load_v2()
+		{
+			const auto& header = *reinterpret_cast<const header_t*>(_mmap.data());
+			if (header.format != FORMAT) {
+				stl::report_and_fail(fmt::format("unsupported database format: {}", header.format));
+			}
+
+			const auto denseSize = (header.flags & header_t::kDense) != 0 ?
+                                       header.idLimit * sizeof(std::uint32_t) :
+                                       0;
+			const auto denseBegin = packed_end(header);
+			if (header.packedSize > _mmap.size() - sizeof(header_t) ||
+				(denseSize > 0 && (denseBegin > _mmap.size() || denseSize > _mmap.size() - denseBegin))) {
+				stl::report_and_fail("database is truncated"sv);
+			}
+
+			_format = header.format;
+			_size = static_cast<std::size_t>(header.count);
+			_packed = std::span{
+				reinterpret_cast<const std::uint8_t*>(_mmap.data() + sizeof(header_t)),
+				static_cast<std::size_t>(header.packedSize)
+			};
+
+			if (denseSize > 0) {  // use the dense block straight out of the mapping
+				_offsets = std::span{
+					reinterpret_cast<const std::uint32_t*>(_mmap.data() + denseBegin),
+					static_cast<std::size_t>(header.idLimit)
+				};
+				_strategy = Strategy::kDense;
+			} else {
+				_mappings.reserve(_size);
+				unpack([&](std::uint64_t a_id, std::uint64_t a_offset) {
+					_mappings.push_back({ a_id, a_offset });
+				});
+				std::sort(
+					_mappings.begin(),
+					_mappings.end(),
+					[](auto&& a_lhs, auto&& a_rhs) {
+						return a_lhs.id != a_rhs.id ?
+                                   a_lhs.id < a_rhs.id :
+                                   a_lhs.offset < a_rhs.offset;
+					});
+				_id2offset = _mappings;
+				_strategy = Strategy::kSearch;
+			}
+		}
+
+		// the dense block is aligned to its element size
+		[[nodiscard]] static std::size_t packed_end(const header_t& a_header) noexcept
+		{
+			const auto end = sizeof(header_t) + static_cast<std::size_t>(a_header.packedSize);
+			return (end + (alignof(std::uint32_t) - 1)) & ~(alignof(std::uint32_t) - 1);
+		}
+
+		// packed mappings are sorted by offset, and stored as pairs of LEB128 varints:
+		// the distance from the previous offset, followed by the id
+		template <class F>
+		void unpack(F a_visitor) const
+		{
+			auto read = [it = _packed.begin(), end = _packed.end()]() mutable {
+				std::uint64_t result = 0;
+				for (std::uint32_t shift = 0; shift < 64; shift += 7) {
+					if (it == end) {
+						stl::report_and_fail("packed mappings are truncated"sv);
+					}
+
+					const auto byte = *it++;
+					result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+					if ((byte & 0x80) == 0) {
+						return result;
+					}
+				}
+				stl::report_and_fail("packed mappings are malformed"sv);
+			};
+
+			std::uint64_t offset = 0;
+			for (std::size_t i = 0; i < _size; ++i) {
+				offset += read();
+				const auto id = read();
+				a_visitor(id, offset);
+			}
+		}
+
+		std::filesystem::path _path;
 		mmio::mapped_file_source _mmap;
 		std::span<const mapping_t> _id2offset;
+		std::span<const std::uint32_t> _offsets;
+		std::span<const std::uint8_t> _packed;
+		std::vector<mapping_t> _mappings;
+		std::vector<mapping_t> _preloaded;
+		std::vector<std::uint32_t> _index;
+		std::size_t _size{ 0 };
+		std::uint32_t _format{ 0 };
+		Strategy _strategy{ Strategy::kSearch };
 	};
 
 	class Offset
@@ -0,0 +1,53 @@
+import os
+import re
+
+SOURCE_TYPES = (
+	".h",
+	".cpp",
+)
+
+# vtables and rtti are only resolved on demand, so they are left out of the list
+EXCLUDE = (
+	"IDList.h",
+	"NiRTTI_IDs.h",
+	"RTTI_IDs.h",
+	"VTABLE_IDs.h",
+)
+
+PATTERN = re.compile(r"REL::ID\(\s*(\d+)\s*\)")
+
+def make_list(a_directories):
+	ids = set()
+	for directory in a_directories:
+		for root, dirs, files in os.walk(directory):
+			for file in files:
+				if file.endswith(SOURCE_TYPES) and file not in EXCLUDE:
+					with open(os.path.join(root, file), "r", encoding="utf-8") as src:
+						for match in PATTERN.finditer(src.read()):
+							ids.add(int(match.group(1)))
+
+	ids = sorted(ids)
+	out = open(os.path.join("include/REL", "IDList.h"), "w", encoding="utf-8")
+	out.write("#pragma once\n")
+	out.write("\n")
+	out.write("// generated by scripts/id_generate.py\n")
+	out.write("namespace REL\n")
+	out.write("{\n")
+	out.write("\tnamespace detail\n")
+	out.write("\t{\n")
+	out.write("\t\t// every id the library resolves, sorted, so F4SE::Init can resolve them in one sweep\n")
+	out.write("\t\tinline constexpr std::array<std::uint64_t, {}> LIBRARY_IDS{{\n".format(len(ids)))
+	for i in range(0, len(ids), 10):
+		out.write("\t\t\t{},\n".format(", ".join(str(id) for id in ids[i:i + 10])))
+	out.write("\t\t};\n")
+	out.write("\t}\n")
+	out.write("}\n")
+
+def main():
+	cur = os.path.dirname(os.path.realpath(__file__))
+	os.chdir(cur + "/..")
+	make_list([ "include", "src" ])
+
+
+if __name__ == "__main__":
+	main()
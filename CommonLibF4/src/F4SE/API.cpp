@@ -3,6 +3,7 @@
 #include "F4SE/Interfaces.h"
 #include "F4SE/Logger.h"
 #include "F4SE/Trampoline.h"
+#include "REL/IDList.h"
 
 namespace F4SE
 {
@@ -59,7 +60,12 @@ namespace F4SE
 		}
 
 		(void)REL::Module::get();
-		(void)REL::IDDatabase::get();
+		auto& iddb = REL::IDDatabase::get();
+
+		const auto start = std::chrono::steady_clock::now();
+		const auto preloaded = iddb.preload(REL::detail::LIBRARY_IDS);
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		log::info(FMT_STRING("resolved {} ids in {:.3f}ms"), preloaded, elapsed.count());
 
 		auto& storage = detail::APIStorage::get();
 		const auto& intfc = *a_intfc;
@@ -15,45 +15,45 @@ namespace RE
 	{
 		RendererWindow* GetCurrentRenderWindow()
 		{
-			REL::Relocation<RendererWindow**> pCurrentRenderWindow{ REL::ID(91810) };
+			static REL::Relocation<RendererWindow**> pCurrentRenderWindow{ REL::ID(91810) };
 			return *pCurrentRenderWindow;
 		}
 
 		ID3D11Device* GetDevice()
 		{
-			REL::Relocation<ID3D11Device**> pDevice{ REL::ID(1454788) };
+			static REL::Relocation<ID3D11Device**> pDevice{ REL::ID(1454788) };
 			return *pDevice;
 		}
 
 		ID3D11DeviceContext* GetMainContext()
 		{
-			REL::Relocation<ID3D11DeviceContext**> pMainContext{ REL::ID(311146) };
+			static REL::Relocation<ID3D11DeviceContext**> pMainContext{ REL::ID(311146) };
 			return *pMainContext;
 		}
 
 		ID3D11DeviceContext* GetImmediateContext()
 		{
-			REL::Relocation<ID3D11DeviceContext**> pImmediateContext{ REL::ID(1396536) };
+			static REL::Relocation<ID3D11DeviceContext**> pImmediateContext{ REL::ID(1396536) };
 			return *pImmediateContext;
 		}
 
 		Context* GetDefaultContext()
 		{
-			REL::Relocation<Context**> pDefaultContext{ REL::ID(33539) };
+			static REL::Relocation<Context**> pDefaultContext{ REL::ID(33539) };
 			return *pDefaultContext;
 		}
 
 		RendererShadowState& GetRendererShadowState()
 		{
 			using func_t = decltype(&BSGraphics::GetRendererShadowState);
-			REL::Relocation<func_t> func{ REL::ID(697019), 0x60 };
+			static REL::Relocation<func_t> func{ REL::ID(697019), 0x60 };
 			return func();
 		}
 
 		RendererShadowState& GetLastDrawCallRendererShadowState()
 		{
 			using func_t = decltype(&BSGraphics::GetLastDrawCallRendererShadowState);
-			REL::Relocation<func_t> func{ REL::ID(1307082), 0xC9 };
+			static REL::Relocation<func_t> func{ REL::ID(1307082), 0xC9 };
 			return func();
 		}
 	}
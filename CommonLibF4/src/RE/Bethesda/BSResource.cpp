@@ -8,7 +8,7 @@ namespace RE
 		ErrorCode GetOrCreateStream(const char* a_fileName, BSTSmartPointer<Stream>& a_result, bool a_writable, Location* a_optionalStart)
 		{
 			using func_t = decltype(&GetOrCreateStream);
-			REL::Relocation<func_t> func{ REL::ID(1143155) };
+			static REL::Relocation<func_t> func{ REL::ID(1143155) };
 			return func(a_fileName, a_result, a_writable, a_optionalStart);
 		}
 	}
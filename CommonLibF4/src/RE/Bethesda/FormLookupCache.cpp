@@ -0,0 +1,83 @@
+#include "RE/Bethesda/FormLookupCache.h"
+
+#include "RE/Bethesda/BSCore/BSAutoLock.h"
+#include "RE/Bethesda/BSSystem/BSFixedString.h"
+#include "RE/Bethesda/TESForms.h"
+
+namespace RE
+{
+	namespace
+	{
+		[[nodiscard]] std::string_view GetEditorID(const TESForm* a_form)
+		{
+			const auto editorID = a_form->GetFormEditorID();
+			return editorID ? editorID : ""sv;
+		}
+	}
+
+	FormLookupCache& FormLookupCache::GetSingleton()
+	{
+		static FormLookupCache singleton;
+		return singleton;
+	}
+
+	void FormLookupCache::Build()
+	{
+		const auto& [forms, formsLock] = TESForm::GetAllForms();
+		const auto& [editorIDs, editorIDsLock] = TESForm::GetAllFormsByEditorID();
+
+		std::unique_ptr<snapshot_type> snapshot;
+		{
+			const BSAutoReadLock l1{ formsLock };
+			const BSAutoReadLock l2{ editorIDsLock };
+			snapshot = std::make_unique<snapshot_type>(
+				forms ? forms->size() : 0,
+				editorIDs ? editorIDs->size() : 0);
+
+			// created forms come and go too often to be worth copying, so they always go to the game
+			if (forms) {
+				for (const auto& elem : *forms) {
+					if (elem.second && !elem.second->IsCreated()) {
+						snapshot->ids.insert(elem.first, elem.second);
+					}
+				}
+			}
+
+			if (editorIDs) {
+				for (const auto& elem : *editorIDs) {
+					if (elem.second && !elem.second->IsCreated()) {
+						snapshot->editorIDs.insert(elem.first, elem.second);
+					}
+				}
+			}
+		}
+
+		Publish(std::move(snapshot));
+	}
+
+	TESForm* FormLookupCache::GetFormByID(std::uint32_t a_formID) const
+	{
+		const auto form = Find(a_formID);
+		return form ? form : TESForm::GetFormByID(a_formID);
+	}
+
+	TESForm* FormLookupCache::GetFormByEditorID(std::string_view a_editorID) const
+	{
+		const auto form = Find(a_editorID);
+		return form ? form : TESForm::GetFormByEditorID(a_editorID);
+	}
+
+	void FormLookupCache::OnFormCreated(TESForm* a_form)
+	{
+		if (a_form && !a_form->IsCreated()) {
+			Insert(a_form->GetFormID(), GetEditorID(a_form), a_form);
+		}
+	}
+
+	void FormLookupCache::OnFormDeleted(const TESForm* a_form)
+	{
+		if (a_form) {
+			Erase(a_form->GetFormID(), GetEditorID(a_form));
+		}
+	}
+}
@@ -6,10 +6,10 @@ namespace RE
 {
 	void MenuCursor::ConstrainForPipboy()
 	{
-		REL::Relocation<Setting*> tlx{ REL::ID(60674) };
-		REL::Relocation<Setting*> tly{ REL::ID(719279) };
-		REL::Relocation<Setting*> width{ REL::ID(1376729) };
-		REL::Relocation<Setting*> height{ REL::ID(452591) };
+		static REL::Relocation<Setting*> tlx{ REL::ID(60674) };
+		static REL::Relocation<Setting*> tly{ REL::ID(719279) };
+		static REL::Relocation<Setting*> width{ REL::ID(1376729) };
+		static REL::Relocation<Setting*> height{ REL::ID(452591) };
 		SetCursorConstraintsRaw(
 			tlx->GetUInt(),
 			tly->GetUInt(),
@@ -19,10 +19,10 @@ namespace RE
 
 	void MenuCursor::ConstrainForPipboyPA()
 	{
-		REL::Relocation<Setting*> tlx{ REL::ID(1110986) };
-		REL::Relocation<Setting*> tly{ REL::ID(187113) };
-		REL::Relocation<Setting*> width{ REL::ID(844985) };
-		REL::Relocation<Setting*> height{ REL::ID(1503497) };
+		static REL::Relocation<Setting*> tlx{ REL::ID(1110986) };
+		static REL::Relocation<Setting*> tly{ REL::ID(187113) };
+		static REL::Relocation<Setting*> width{ REL::ID(844985) };
+		static REL::Relocation<Setting*> height{ REL::ID(1503497) };
 		SetCursorConstraintsRaw(
 			tlx->GetUInt(),
 			tly->GetUInt(),
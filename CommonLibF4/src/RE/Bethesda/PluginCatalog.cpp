@@ -0,0 +1,52 @@
+#include "RE/Bethesda/PluginCatalog.h"
+
+#include "RE/Bethesda/TESDataHandler.h"
+
+namespace RE
+{
+	const PluginCatalog* PluginCatalog::GetSingleton()
+	{
+		// the collection only changes while plugins load, so there are only ever a few catalogs. each is kept
+		// until exit, which lets the hot path be one load
+		static std::atomic<const PluginCatalog*> current{ nullptr };
+		static std::vector<std::unique_ptr<const PluginCatalog>> catalogs;
+		static std::mutex lock;
+
+		const auto data = TESDataHandler::GetSingleton();
+		if (!data) {
+			return nullptr;
+		}
+
+		const auto& collection = data->compiledFileCollection;
+		const auto fingerprint = GetFingerprint(collection);
+		if (const auto catalog = current.load(std::memory_order_acquire); catalog && catalog->_fingerprint == fingerprint) {
+			return catalog;
+		}
+
+		// one caller rebuilds, and anyone who waited on it takes its catalog
+		const std::lock_guard l{ lock };
+		auto catalog = current.load(std::memory_order_relaxed);
+		if (!catalog || catalog->_fingerprint != fingerprint) {
+			const auto generation = catalog ? catalog->generation() + 1 : 1;
+			catalog = catalogs.emplace_back(new PluginCatalog(collection, generation)).get();
+			current.store(catalog, std::memory_order_release);
+		}
+		return catalog;
+	}
+
+	PluginCatalog::PluginCatalog(const TESFileCollection& a_collection, std::uint64_t a_generation) :
+		super(a_collection.files, a_collection.smallFiles, a_generation),
+		_fingerprint(GetFingerprint(a_collection))
+	{}
+
+	auto PluginCatalog::GetFingerprint(const TESFileCollection& a_collection) noexcept
+		-> fingerprint_t
+	{
+		return {
+			a_collection.files.data(),
+			a_collection.files.size(),
+			a_collection.smallFiles.data(),
+			a_collection.smallFiles.size()
+		};
+	}
+}
@@ -36,7 +36,7 @@ namespace RE
 		if (!water) {
 			water = IsExterior() && worldSpace ? worldSpace->GetWaterType() : nullptr;
 			if (!water) {
-				REL::Relocation<TESWaterForm**> defaultWater{ REL::ID(289864) };
+				static REL::Relocation<TESWaterForm**> defaultWater{ REL::ID(289864) };
 				water = *defaultWater;
 			}
 		}
@@ -46,6 +46,60 @@
 
 namespace REL
 {
+	namespace
+	{
+		class VirtualPageProtector final :
+			public PageProtector
+		{
+		public:
+			[[nodiscard]] std::size_t unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) override
+			{
+				::MEMORY_BASIC_INFORMATION info{};
+				if (::VirtualQuery(reinterpret_cast<::LPCVOID>(a_address), std::addressof(info), sizeof(info)) == 0) {
+					return 0;
+				}
+
+				// VirtualProtect only reports the old protection of the first page, so stop where the region does
+				const auto end = reinterpret_cast<std::uintptr_t>(info.BaseAddress) + info.RegionSize;
+				const auto size = std::min<std::size_t>(a_size, end - a_address);
+				::DWORD old{ 0 };
+				if (::VirtualProtect(reinterpret_cast<::LPVOID>(a_address), size, PAGE_EXECUTE_READWRITE, std::addressof(old)) == 0) {
+					return 0;
+				}
+
+				a_old = static_cast<std::uint32_t>(old);
+				return size;
+			}
+
+			[[nodiscard]] bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) override
+			{
+				::DWORD old{ 0 };
+				return ::VirtualProtect(reinterpret_cast<::LPVOID>(a_address), a_size, static_cast<::DWORD>(a_protection), std::addressof(old)) != 0;
+			}
+
+			void flush(std::uintptr_t a_address, std::size_t a_size) noexcept override
+			{
+				::FlushInstructionCache(::GetCurrentProcess(), reinterpret_cast<::LPCVOID>(a_address), a_size);
+			}
+
+			[[nodiscard]] std::size_t page_size() const noexcept override
+			{
+				static const auto size = [] {
+					::SYSTEM_INFO info{};
+					::GetSystemInfo(std::addressof(info));
+					return static_cast<std::size_t>(info.dwPageSize);
+				}();
+				return size;
+			}
+		};
+	}
+
+	PageProtector& PageProtector::get() noexcept
+	{
+		static VirtualPageProtector singleton;
+		return singleton;
+	}
+
 	void Module::load_segments()
 	{
 		auto dosHeader = reinterpret_cast<const ::IMAGE_DOS_HEADER*>(_base);
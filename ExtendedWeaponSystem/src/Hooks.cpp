@@ -13,7 +13,7 @@
 
 #pragma region MenuOpenCloseEventSink
 BSEventNotifyControl MenuOpenCloseEventSink::ProcessEvent(const MenuOpenCloseEvent& a_event, BSTEventSource<MenuOpenCloseEvent>* a_source) {
-	const BSFixedString LoadingMenu("LoadingMenu");
+	constexpr fixed_literal<"LoadingMenu"> LoadingMenu;
 	WeaponInfo& Info = WeaponInfo::getInstance();
 	if (a_event.menuName == LoadingMenu && a_event.opening) {
 		logInfo("Loading...");
@@ -24,19 +24,11 @@ namespace Papyrus
 			return result;
 		}
 
-		inline std::vector<RE::BGSHeadPart*> GetHeadParts(
+		inline std::span<RE::BGSHeadPart*> GetHeadParts(
 			const RE::TESNPC& a_self,
 			bool a_overlays)
 		{
-			const auto parts = a_self.GetHeadParts(a_overlays);
-			std::vector<RE::BGSHeadPart*> result(parts.size(), nullptr);
-			std::copy_n(
-				std::execution::unseq,
-				parts.begin(),
-				parts.size(),
-				result.begin());
-
-			return result;
+			return a_self.GetHeadParts(a_overlays);
 		}
 
 		inline RE::BGSOutfit* GetOutfit(
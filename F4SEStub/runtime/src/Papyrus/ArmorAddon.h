@@ -6,16 +6,9 @@ namespace Papyrus
 {
 	namespace ArmorAddon
 	{
-		inline std::vector<RE::TESRace*> GetAdditionalRaces(const RE::TESObjectARMA& a_self)
+		inline std::span<RE::TESRace* const> GetAdditionalRaces(const RE::TESObjectARMA& a_self)
 		{
-			std::vector<RE::TESRace*> result(a_self.additionalRaces.size(), nullptr);
-			std::copy_n(
-				std::execution::unseq,
-				a_self.additionalRaces.begin(),
-				a_self.additionalRaces.size(),
-				result.begin());
-
-			return result;
+			return a_self.additionalRaces;
 		}
 
 		inline void Bind(RE::BSScript::IVirtualMachine& a_vm)
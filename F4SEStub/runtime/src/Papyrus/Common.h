@@ -1,6 +1,6 @@
 #pragma once
 
-#define BIND(a_method, ...) a_vm.BindNativeMethod(obj, #a_method##sv, a_method __VA_OPT__(, ) __VA_ARGS__)
+#define BIND(a_method, ...) a_vm.BindNativeMethod<a_method>(obj, #a_method##sv __VA_OPT__(, ) __VA_ARGS__)
 
 namespace Papyrus
 {
@@ -6,16 +6,9 @@ namespace Papyrus
 {
 	namespace EquipSlot
 	{
-		inline std::vector<RE::BGSEquipSlot*> GetParents(const RE::BGSEquipSlot& a_self)
+		inline std::span<RE::BGSEquipSlot* const> GetParents(const RE::BGSEquipSlot& a_self)
 		{
-			std::vector<RE::BGSEquipSlot*> result(a_self.parentSlots.size(), nullptr);
-			std::copy_n(
-				std::execution::unseq,
-				a_self.parentSlots.begin(),
-				a_self.parentSlots.size(),
-				result.begin());
-
-			return result;
+			return a_self.parentSlots;
 		}
 
 		inline void Bind(RE::BSScript::IVirtualMachine& a_vm)
@@ -6,6 +6,8 @@ namespace Papyrus
 {
 	namespace Game
 	{
+		using PluginInfo = structure_wrapper<"Game", "PluginInfo">;
+
 		namespace detail
 		{
 			[[nodiscard]] inline RE::Setting* GetGameSetting(const RE::BSFixedString& a_setting)
@@ -20,9 +22,83 @@ namespace Papyrus
 
 				return nullptr;
 			}
-		}
 
-		using PluginInfo = structure_wrapper<"Game", "PluginInfo">;
+			struct plugin_info_t
+			{
+			public:
+				// members
+				std::uint8_t index{ 0 };
+				std::string name;
+				std::string author;
+				std::string description;
+			};
+
+			struct plugin_infos_t
+			{
+			public:
+				// members
+				std::uint64_t generation{ 0 };
+				std::vector<plugin_info_t> infos;
+			};
+
+			// one set of infos per catalog, kept like the catalogs are, so a reader never has to pin one
+			struct plugin_infos_cache_t
+			{
+			public:
+				// members
+				std::atomic<const plugin_infos_t*> current{ nullptr };
+				std::vector<std::unique_ptr<const plugin_infos_t>> built;
+				std::mutex lock;
+			};
+
+			// only the metadata is kept between calls, until the plugins change. the structs are packed
+			// fresh each time, so a script editing one it was handed never shows up for another caller
+			[[nodiscard]] inline std::vector<PluginInfo> GetPluginInfos(
+				plugin_infos_cache_t& a_cache,
+				bool a_light)
+			{
+				const auto catalog = RE::PluginCatalog::GetSingleton();
+				if (!catalog) {
+					return {};
+				}
+
+				auto cached = a_cache.current.load(std::memory_order_acquire);
+				if (!cached || cached->generation != catalog->generation()) {
+					const std::lock_guard l{ a_cache.lock };
+					cached = a_cache.current.load(std::memory_order_relaxed);
+					if (!cached || cached->generation != catalog->generation()) {
+						auto fresh = std::make_unique<plugin_infos_t>();
+						fresh->generation = catalog->generation();
+
+						const auto mods = a_light ? catalog->light_files() : catalog->files();
+						fresh->infos.reserve(mods.size());
+						for (const auto mod : mods) {
+							fresh->infos.push_back({
+								mod->GetCompileIndex(),
+								std::string{ mod->GetFilename() },
+								std::string{ std::string_view{ mod->createdBy } },
+								std::string{ std::string_view{ mod->summary } } });
+						}
+
+						cached = a_cache.built.emplace_back(std::move(fresh)).get();
+						a_cache.current.store(cached, std::memory_order_release);
+					}
+				}
+
+				std::vector<PluginInfo> result;
+				const PluginInfo::builder make{ "index"sv, "name"sv, "author"sv, "description"sv };
+				result.reserve(cached->infos.size());
+				for (const auto& info : cached->infos) {
+					result.push_back(make(
+						info.index,
+						std::string_view{ info.name },
+						std::string_view{ info.author },
+						std::string_view{ info.description }));
+				}
+
+				return result;
+			}
+		}
 
 		inline RE::CameraState GetCameraState(std::monostate)
 		{
@@ -39,36 +115,14 @@ namespace Papyrus
 
 		inline std::vector<PluginInfo> GetInstalledLightPlugins(std::monostate)
 		{
-			std::vector<PluginInfo> result;
-			const auto data = RE::TESDataHandler::GetSingleton();
-			if (data) {
-				for (const auto& mod : data->compiledFileCollection.smallFiles) {
-					auto& back = result.emplace_back();
-					back.insert("index"sv, mod->GetCompileIndex());
-					back.insert("name"sv, mod->GetFilename());
-					back.insert<std::string_view>("author"sv, mod->createdBy);
-					back.insert<std::string_view>("description"sv, mod->summary);
-				}
-			}
-
-			return result;
+			static detail::plugin_infos_cache_t cache;
+			return detail::GetPluginInfos(cache, true);
 		}
 
 		inline std::vector<PluginInfo> GetInstalledPlugins(std::monostate)
 		{
-			std::vector<PluginInfo> result;
-			const auto data = RE::TESDataHandler::GetSingleton();
-			if (data) {
-				for (const auto& mod : data->compiledFileCollection.files) {
-					auto& back = result.emplace_back();
-					back.insert("index"sv, mod->GetCompileIndex());
-					back.insert("name"sv, mod->GetFilename());
-					back.insert<std::string_view>("author"sv, mod->createdBy);
-					back.insert<std::string_view>("description"sv, mod->summary);
-				}
-			}
-
-			return result;
+			static detail::plugin_infos_cache_t cache;
+			return detail::GetPluginInfos(cache, false);
 		}
 
 		inline std::vector<std::string_view> GetPluginDependencies(
@@ -76,23 +130,9 @@ namespace Papyrus
 			RE::BSFixedString a_plugin)
 		{
 			std::vector<std::string_view> result;
-			const auto data = RE::TESDataHandler::GetSingleton();
-			if (!data) {
-				return result;
-			}
-
-			std::span<RE::TESFile*> masters;
-			for (const auto& mod : data->files) {
-				if (mod->GetFilename() == a_plugin) {
-					if (mod->GetCompileIndex() != 0xFFu) {
-						masters = std::span{ mod->masterPtrs, mod->masterCount };
-					}
-					break;
-				}
-			}
-
-			for (const auto master : masters) {
-				if (master) {
+			const auto catalog = RE::PluginCatalog::GetSingleton();
+			if (catalog) {
+				for (const auto master : catalog->masters(a_plugin)) {
 					result.push_back(master->GetFilename());
 				}
 			}
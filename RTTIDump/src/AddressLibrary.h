@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mmio/mmio.hpp>
+
+// an address library read from disk in either format, for when the game is not there to load it
+class AddressLibrary
+{
+public:
+	struct Pair
+	{
+	public:
+		// members
+		std::uint64_t id;
+		std::uint64_t offset;
+	};
+
+	explicit AddressLibrary(std::vector<Pair> a_mappings) :
+		_id2offset(std::move(a_mappings))
+	{
+		std::ranges::sort(_id2offset, [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.id != a_rhs.id ?
+                       a_lhs.id < a_rhs.id :
+                       a_lhs.offset < a_rhs.offset;
+		});
+
+		// where several ids share an offset the lowest wins, as it does for REL::IDDatabase::Offset2ID
+		_offset2id = _id2offset;
+		std::ranges::sort(_offset2id, [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.offset != a_rhs.offset ?
+                       a_lhs.offset < a_rhs.offset :
+                       a_lhs.id < a_rhs.id;
+		});
+	}
+
+	[[nodiscard]] static AddressLibrary load(const std::filesystem::path& a_path)
+	{
+		using namespace std::literals;
+
+		mmio::mapped_file_source file;
+		if (!file.open(a_path)) {
+			throw std::runtime_error("failed to open: "s + a_path.string());
+		}
+
+		const std::span input{ reinterpret_cast<const std::byte*>(file.data()), file.size() };
+		if (input.size() < sizeof(std::uint64_t)) {
+			throw std::runtime_error("database is truncated"s);
+		}
+
+		std::vector<Pair> mappings;
+		Header header{};
+		if (input.size() >= sizeof(Header)) {
+			std::memcpy(std::addressof(header), input.data(), sizeof(Header));
+		}
+
+		if (header.magic != MAGIC) {
+			std::uint64_t count = 0;
+			std::memcpy(std::addressof(count), input.data(), sizeof(count));
+			if (count > (input.size() - sizeof(count)) / sizeof(Pair)) {
+				throw std::runtime_error("database is truncated"s);
+			}
+			mappings.resize(static_cast<std::size_t>(count));
+			std::memcpy(mappings.data(), input.data() + sizeof(count), mappings.size() * sizeof(Pair));
+		} else if (header.format != 2) {
+			throw std::runtime_error("unsupported database format: "s + std::to_string(header.format));
+		} else if ((header.flags & ~Header::kDense) != 0) {
+			throw std::runtime_error("unsupported database flags: "s + std::to_string(header.flags));
+		} else if (truncated(header, input.size())) {
+			throw std::runtime_error("database is truncated"s);
+		} else {  // the packed mappings hold every mapping, so the dense block is only checked, never read
+			auto packed = input.subspan(sizeof(Header), static_cast<std::size_t>(header.packedSize));
+			mappings.reserve(static_cast<std::size_t>(header.count));
+			std::uint64_t offset = 0;
+			for (std::uint64_t i = 0; i < header.count; ++i) {
+				offset += read_varint(packed);
+				const auto id = read_varint(packed);
+				mappings.push_back({ id, offset });
+			}
+		}
+
+		return AddressLibrary{ std::move(mappings) };
+	}
+
+	[[nodiscard]] std::optional<std::uint64_t> id(std::uint64_t a_offset) const noexcept
+	{
+		const auto it = std::ranges::lower_bound(_offset2id, a_offset, std::less{}, &Pair::offset);
+		return it != _offset2id.end() && it->offset == a_offset ? std::make_optional(it->id) : std::nullopt;
+	}
+
+	[[nodiscard]] std::optional<std::uint64_t> offset(std::uint64_t a_id) const noexcept
+	{
+		const auto it = std::ranges::lower_bound(_id2offset, a_id, std::less{}, &Pair::id);
+		return it != _id2offset.end() && it->id == a_id ? std::make_optional(it->offset) : std::nullopt;
+	}
+
+private:
+	// "ADDRLIB\0", which can never be mistaken for the mapping count of a v1 database
+	static constexpr std::uint64_t MAGIC = 0x0042494C52444441;
+
+	struct Header
+	{
+	public:
+		enum : std::uint32_t
+		{
+			kDense = 1u << 0,  // a dense block of offsets, indexed by id, follows the packed mappings
+		};
+
+		// members
+		std::uint64_t magic;
+		std::uint32_t format;
+		std::uint32_t flags;
+		std::uint64_t count;
+		std::uint64_t idLimit;
+		std::uint64_t packedSize;
+	};
+	static_assert(sizeof(Header) == 0x28);
+
+	// the bounds REL::IDDatabase checks before it maps the file
+	[[nodiscard]] static bool truncated(const Header& a_header, std::size_t a_size) noexcept
+	{
+		if (a_header.packedSize > a_size - sizeof(Header)) {
+			return true;
+		} else if ((a_header.flags & Header::kDense) == 0) {
+			return false;
+		}
+
+		// the dense block is aligned to its element size
+		const auto packedEnd = sizeof(Header) + static_cast<std::size_t>(a_header.packedSize);
+		const auto denseBegin = (packedEnd + (alignof(std::uint32_t) - 1)) & ~(alignof(std::uint32_t) - 1);
+		const auto denseSize = a_header.idLimit * sizeof(std::uint32_t);
+		return denseBegin > a_size || denseSize > a_size - denseBegin;
+	}
+
+	[[nodiscard]] static std::uint64_t read_varint(std::span<const std::byte>& a_data)
+	{
+		using namespace std::literals;
+
+		std::uint64_t result = 0;
+		for (std::uint32_t shift = 0; shift < 64 && !a_data.empty(); shift += 7) {
+			const auto byte = static_cast<std::uint8_t>(a_data.front());
+			a_data = a_data.subspan(1);
+			result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) {
+				return result;
+			}
+		}
+		throw std::runtime_error("packed mappings are malformed"s);
+	}
+
+	// members
+	std::vector<Pair> _id2offset;
+	std::vector<Pair> _offset2id;
+};
@@ -0,0 +1,445 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// undecorates the names msvc gives type descriptors, printed as UnDecorateSymbolName prints them with the
+// flags RTTIDump passes it: without calling conventions, __ptr64, or class/struct/union/enum prefixes.
+// only the grammar which can appear in a type is understood, anything else fails the whole name
+class Demangler
+{
+public:
+	[[nodiscard]] static std::optional<std::string> demangle(std::string_view a_mangled)
+	{
+		if (a_mangled.starts_with('.')) {
+			a_mangled.remove_prefix(1);
+		}
+
+		Demangler demangler{ a_mangled };
+		try {
+			auto result = demangler.type();
+			return demangler._in.empty() ? std::make_optional(std::move(result)) : std::nullopt;
+		} catch (const error_t&) {
+			return std::nullopt;
+		}
+	}
+
+private:
+	struct error_t
+	{};
+
+	// names are referred back to by digit, up to ten of them, as are the function parameters whose
+	// encoding was longer than a character
+	struct backrefs_t
+	{
+	public:
+		// members
+		std::vector<std::pair<std::string, std::string>> names;  // [ key, name ]
+		std::vector<std::string> params;
+	};
+
+	explicit Demangler(std::string_view a_mangled) noexcept :
+		_in(a_mangled)
+	{}
+
+	[[nodiscard]] char peek() const noexcept { return _in.empty() ? '\0' : _in.front(); }
+
+	[[nodiscard]] bool consume(std::string_view a_prefix) noexcept
+	{
+		if (_in.starts_with(a_prefix)) {
+			_in.remove_prefix(a_prefix.size());
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	[[nodiscard]] bool consume(char a_prefix) noexcept { return consume(std::string_view{ std::addressof(a_prefix), 1 }); }
+
+	char next()
+	{
+		if (_in.empty()) {
+			throw error_t{};
+		}
+
+		const auto result = _in.front();
+		_in.remove_prefix(1);
+		return result;
+	}
+
+	void expect(char a_char)
+	{
+		if (!consume(a_char)) {
+			throw error_t{};
+		}
+	}
+
+	// digits count from 1, anything larger is hex spelled with A-P and ended by @
+	[[nodiscard]] std::int64_t number()
+	{
+		const bool negative = consume('?');
+		std::int64_t result = 0;
+		if (const auto ch = peek(); '0' <= ch && ch <= '9') {
+			result = next() - '0' + 1;
+		} else {
+			for (auto digit = next(); digit != '@'; digit = next()) {
+				if (digit < 'A' || 'P' < digit) {
+					throw error_t{};
+				}
+				result = result * 16 + (digit - 'A');
+			}
+		}
+		return negative ? -result : result;
+	}
+
+	[[nodiscard]] static std::string_view cv(char a_char)
+	{
+		switch (a_char) {
+		case 'A':
+			return {};
+		case 'B':
+			return " const";
+		case 'C':
+			return " volatile";
+		case 'D':
+			return " const volatile";
+		default:
+			throw error_t{};
+		}
+	}
+
+	[[nodiscard]] std::string type()
+	{
+		using namespace std::literals;
+
+		constexpr std::array primitives{
+			std::pair{ 'C', "signed char" },
+			std::pair{ 'D', "char" },
+			std::pair{ 'E', "unsigned char" },
+			std::pair{ 'F', "short" },
+			std::pair{ 'G', "unsigned short" },
+			std::pair{ 'H', "int" },
+			std::pair{ 'I', "unsigned int" },
+			std::pair{ 'J', "long" },
+			std::pair{ 'K', "unsigned long" },
+			std::pair{ 'M', "float" },
+			std::pair{ 'N', "double" },
+			std::pair{ 'O', "long double" },
+			std::pair{ 'X', "void" },
+		};
+		constexpr std::array extended{
+			std::pair{ 'D', "__int8" },
+			std::pair{ 'E', "unsigned __int8" },
+			std::pair{ 'F', "__int16" },
+			std::pair{ 'G', "unsigned __int16" },
+			std::pair{ 'H', "__int32" },
+			std::pair{ 'I', "unsigned __int32" },
+			std::pair{ 'J', "__int64" },
+			std::pair{ 'K', "unsigned __int64" },
+			std::pair{ 'L', "__int128" },
+			std::pair{ 'M', "unsigned __int128" },
+			std::pair{ 'N', "bool" },
+			std::pair{ 'Q', "char8_t" },
+			std::pair{ 'S', "char16_t" },
+			std::pair{ 'U', "char32_t" },
+			std::pair{ 'W', "wchar_t" },
+		};
+		const auto lookup = [](const auto& a_table, char a_char) -> std::string {
+			for (const auto& [ch, name] : a_table) {
+				if (ch == a_char) {
+					return name;
+				}
+			}
+			throw error_t{};
+		};
+
+		switch (const auto ch = next()) {
+		case '_':
+			return lookup(extended, next());
+		case 'T':
+		case 'U':
+		case 'V':
+			return qualified_name();
+		case 'W':
+			next();  // the underlying type
+			return qualified_name();
+		case 'P':
+		case 'Q':
+		case 'R':
+		case 'S':
+			return pointer(ch == 'Q' || ch == 'S' ? " const"sv : ""sv, "*"sv);
+		case 'A':
+		case 'B':
+			return pointer({}, "&"sv);
+		case 'Y':
+			return array();
+		case '?':
+			{
+				const auto qualifiers = cv(next());
+				return type() + std::string{ qualifiers };
+			}
+		case '$':
+			if (consume("$C"sv)) {
+				const auto qualifiers = cv(next());
+				return type() + std::string{ qualifiers };
+			} else if (consume("$Q"sv) || consume("$R"sv)) {
+				return pointer({}, "&&"sv);
+			} else if (consume("$T"sv)) {
+				return "std::nullptr_t";
+			} else if (consume("$A6"sv)) {
+				const auto [ret, params] = function();
+				return ret + " (" + params + ")";
+			} else if (consume("$BY"sv)) {
+				return array();
+			}
+			throw error_t{};
+		default:
+			return lookup(primitives, ch);
+		}
+	}
+
+	[[nodiscard]] std::string pointer(std::string_view a_self, std::string_view a_kind)
+	{
+		using namespace std::literals;
+
+		while (consume('E') || consume('F') || consume('I')) {}  // __ptr64, __unaligned, __restrict
+
+		if (consume('6')) {
+			const auto [ret, params] = function();
+			return ret + " (" + std::string{ a_kind } + std::string{ a_self } + ")(" + params + ")";
+		}
+
+		const auto qualifiers = cv(next());
+		return type() + std::string{ qualifiers } + " " + std::string{ a_kind } + std::string{ a_self };
+	}
+
+	[[nodiscard]] std::string array()
+	{
+		const auto dimensions = number();
+		std::string bounds;
+		for (std::int64_t i = 0; i < dimensions; ++i) {
+			bounds += "[" + std::to_string(number()) + "]";
+		}
+		return type() + " " + bounds;
+	}
+
+	// [ return type, parameters ]
+	[[nodiscard]] std::pair<std::string, std::string> function()
+	{
+		using namespace std::literals;
+
+		next();  // the calling convention
+
+		auto ret = consume('@') ? std::string{} : type();  // constructors return nothing
+
+		auto params = parameters();
+		if (!consume('Z') && !consume("_E"sv)) {
+			throw error_t{};
+		}
+		return { std::move(ret), std::move(params) };
+	}
+
+	[[nodiscard]] std::string parameters()
+	{
+		if (consume('X')) {
+			return "void";
+		}
+
+		std::string result;
+		const auto append = [&](std::string_view a_param) {
+			if (!result.empty()) {
+				result += ',';
+			}
+			result += a_param;
+		};
+
+		while (!consume('@')) {
+			if (consume('Z')) {
+				append("...");
+				break;
+			}
+
+			if (const auto ch = peek(); '0' <= ch && ch <= '9') {
+				const auto idx = static_cast<std::size_t>(next() - '0');
+				if (idx >= _backrefs.params.size()) {
+					throw error_t{};
+				}
+				append(_backrefs.params[idx]);
+			} else {
+				const auto size = _in.size();
+				auto param = type();
+				append(param);
+				if (size - _in.size() > 1 && _backrefs.params.size() < 10) {
+					_backrefs.params.push_back(std::move(param));
+				}
+			}
+		}
+
+		return result;
+	}
+
+	// fragments are mangled innermost first, and ended with @
+	[[nodiscard]] std::vector<std::string> fragments()
+	{
+		std::vector<std::string> result;
+		while (!consume('@')) {
+			result.push_back(fragment());
+		}
+
+		if (result.empty()) {
+			throw error_t{};
+		}
+		return result;
+	}
+
+	[[nodiscard]] std::string qualified_name() { return join(fragments()); }
+
+	[[nodiscard]] static std::string join(const std::vector<std::string>& a_fragments)
+	{
+		std::string result;
+		for (auto it = a_fragments.rbegin(); it != a_fragments.rend(); ++it) {
+			if (!result.empty()) {
+				result += "::";
+			}
+			result += *it;
+		}
+		return result;
+	}
+
+	[[nodiscard]] std::string fragment()
+	{
+		using namespace std::literals;
+
+		if (const auto ch = peek(); '0' <= ch && ch <= '9') {
+			const auto idx = static_cast<std::size_t>(next() - '0');
+			if (idx >= _backrefs.names.size()) {
+				throw error_t{};
+			}
+			return _backrefs.names[idx].second;
+		} else if (consume("?$"sv)) {
+			auto name = template_name();
+			memorize(name, name);
+			return name;
+		} else if (consume("?A"sv)) {
+			auto key = "?A"s + identifier();
+			auto name = "`anonymous namespace'"s;
+			memorize(std::move(key), name);
+			return name;
+		} else if (consume('?')) {
+			// a name local to a function: ?N?symbol
+			const auto scope = number();
+			expect('?');
+			return "`" + nested_symbol() + "'::`" + std::to_string(scope) + "'";
+		} else {
+			auto name = identifier();
+			memorize(name, name);
+			return name;
+		}
+	}
+
+	[[nodiscard]] std::string identifier()
+	{
+		const auto end = _in.find('@');
+		if (end == std::string_view::npos || end == 0) {
+			throw error_t{};
+		}
+
+		std::string result{ _in.substr(0, end) };
+		_in.remove_prefix(end + 1);
+		return result;
+	}
+
+	void memorize(std::string a_key, std::string a_name)
+	{
+		auto& names = _backrefs.names;
+		if (names.size() < 10 && std::ranges::find(names, a_key, [](auto&& a_elem) { return a_elem.first; }) == names.end()) {
+			names.emplace_back(std::move(a_key), std::move(a_name));
+		}
+	}
+
+	// template arguments refer back into their own table, not the enclosing one
+	[[nodiscard]] std::string template_name()
+	{
+		using namespace std::literals;
+
+		backrefs_t outer;
+		std::swap(outer, _backrefs);
+
+		auto name = identifier();
+		memorize(name, name);
+
+		std::string args;
+		while (!consume('@')) {
+			std::string arg;
+			if (consume("$$V"sv) || consume("$$Z"sv) || consume("$S"sv)) {
+				continue;  // an empty pack
+			} else if (consume("$0"sv)) {
+				arg = std::to_string(number());
+			} else {
+				arg = type();
+			}
+
+			if (!args.empty()) {
+				args += ',';
+			}
+			args += arg;
+		}
+
+		std::swap(outer, _backrefs);
+		return name + "<" + args + (args.ends_with('>') ? " >" : ">");
+	}
+
+	// the function a local name is scoped to, which is mangled as a whole symbol with a table of its own.
+	// only its name is printed
+	[[nodiscard]] std::string nested_symbol()
+	{
+		using namespace std::literals;
+
+		backrefs_t outer;
+		std::swap(outer, _backrefs);
+
+		expect('?');
+		std::string name;
+		if (const bool ctor = consume("?0"sv); ctor || consume("?1"sv)) {
+			const auto parts = fragments();
+			name = join(parts) + "::" + (ctor ? "" : "~") + parts.front();
+		} else {
+			name = qualified_name();
+		}
+
+		switch (const auto kind = next()) {
+		case 'Y':
+		case 'Z':
+			break;
+		case 'C':
+		case 'D':
+		case 'K':
+		case 'L':
+		case 'S':
+		case 'T':
+			break;  // static members have no this
+		default:
+			if (kind < 'A' || 'X' < kind) {
+				throw error_t{};
+			}
+			while (consume('E') || consume('F') || consume('I')) {}
+			(void)cv(next());
+			break;
+		}
+		(void)function();
+
+		std::swap(outer, _backrefs);
+		return name;
+	}
+
+	// members
+	std::string_view _in;
+	backrefs_t _backrefs;
+};
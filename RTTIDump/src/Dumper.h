@@ -0,0 +1,552 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <robin_hood.h>
+#include <spdlog/spdlog.h>
+
+#include "Image.h"
+
+// what the dumpers read: an image, and the address library which names what is found in it
+struct Target
+{
+public:
+	// members
+	Image image;
+	std::function<std::optional<std::uint64_t>(std::uint64_t)> offset2id;  // called from many threads at once
+	std::function<std::optional<std::uint64_t>(std::uint64_t)> id2offset;
+	std::function<std::optional<std::string>(std::string_view)> demangle;  // only ever called from one thread
+};
+
+[[nodiscard]] inline std::uint64_t get_id(const Target& a_target, std::uint64_t a_offset)
+{
+	const auto id = a_target.offset2id(a_offset);
+	if (!id) {
+		throw std::out_of_range(fmt::format("offset not found: {:#x}", a_offset));
+	}
+
+	return *id;
+}
+
+// runs a_func for every index below a_count, split over the hardware threads
+template <class F>
+void parallel_for(std::size_t a_count, F&& a_func)
+{
+	const auto threads = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, (std::max<std::size_t>)(a_count, 1));
+	const auto chunk = (a_count + threads - 1) / threads;
+	std::vector<std::future<void>> tasks;
+	for (std::size_t first = 0; first < a_count; first += chunk) {
+		const auto last = (std::min)(first + chunk, a_count);
+		tasks.push_back(std::async(std::launch::async, [&, first, last]() {
+			for (auto i = first; i < last; ++i) {
+				a_func(i);
+			}
+		}));
+	}
+
+	for (auto& task : tasks) {
+		task.get();
+	}
+}
+
+class Stopwatch
+{
+public:
+	void lap(std::string_view a_phase)
+	{
+		const auto now = clock::now();
+		spdlog::info("{}: {:.1f}ms", a_phase, std::chrono::duration<double, std::milli>(now - _last).count());
+		_last = now;
+	}
+
+private:
+	using clock = std::chrono::steady_clock;
+
+	clock::time_point _last{ clock::now() };
+};
+
+// every complete object locator and virtual table in .rdata, found in one sweep each, so that each type
+// is resolved by lookup instead of by rescanning the segment. everything is kept by rva
+class RTTIIndex
+{
+public:
+	RTTIIndex(std::uint64_t a_base, const Segment& a_rdata, const Segment& a_data)
+	{
+		index_locators(a_rdata, a_data);
+		index_vtables(a_base, a_rdata);
+	}
+
+	// the virtual tables of the type, in address order
+	[[nodiscard]] std::vector<std::uint32_t> virtual_tables(std::uint32_t a_typeDesc) const
+	{
+		using namespace std::literals;
+
+		std::vector<std::uint32_t> results;
+		const auto cols = equal_range(_locators, a_typeDesc);
+		for (const auto& col : cols) {
+			for (const auto& vtable : equal_range(_vtables, col.second)) {
+				results.push_back(vtable.second);
+			}
+		}
+
+		if (results.size() != cols.size()) {
+			throw std::runtime_error("failed to find virtual tables"s);
+		} else {
+			std::ranges::sort(results);
+			return results;
+		}
+	}
+
+private:
+	using multimap_t = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+	// where a complete object locator keeps the rva of its type descriptor
+	static constexpr std::size_t COL_TYPE_DESCRIPTOR = 0xC;
+
+	[[nodiscard]] static std::span<const multimap_t::value_type> equal_range(const multimap_t& a_map, std::uint32_t a_key) noexcept
+	{
+		const auto [first, last] = std::ranges::equal_range(a_map, a_key, std::less{}, [](auto&& a_elem) { return a_elem.first; });
+		return { first, last };
+	}
+
+	// type desc -> col
+	void index_locators(const Segment& a_rdata, const Segment& a_data)
+	{
+		const auto ints = a_rdata.view<std::uint32_t>();
+		for (std::size_t i = 0; i + 1 < ints.size(); ++i) {
+			// both base class desc and col can point to the type desc so we check
+			// the next int to see if it can be an rva to decide which type it is
+			if (a_data.contains(ints[i]) && a_rdata.contains(ints[i + 1])) {
+				const auto col = a_rdata.rva + i * sizeof(std::uint32_t) - COL_TYPE_DESCRIPTOR;
+				_locators.emplace_back(ints[i], static_cast<std::uint32_t>(col));
+			}
+		}
+		std::ranges::sort(_locators);
+	}
+
+	// col -> vtable
+	void index_vtables(std::uint64_t a_base, const Segment& a_rdata)
+	{
+		robin_hood::unordered_flat_set<std::uint32_t> cols;
+		cols.reserve(_locators.size());
+		for (const auto& locator : _locators) {
+			cols.insert(locator.second);
+		}
+
+		const auto ptrs = a_rdata.view<std::uint64_t>();
+		for (std::size_t i = 0; i < ptrs.size(); ++i) {
+			if (ptrs[i] >= a_base && a_rdata.contains(ptrs[i] - a_base)) {
+				const auto col = static_cast<std::uint32_t>(ptrs[i] - a_base);
+				if (cols.contains(col)) {
+					const auto vtable = a_rdata.rva + (i + 1) * sizeof(std::uint64_t);
+					_vtables.emplace_back(col, static_cast<std::uint32_t>(vtable));
+				}
+			}
+		}
+		std::ranges::sort(_vtables);
+	}
+
+	// members
+	multimap_t _locators;
+	multimap_t _vtables;
+};
+
+[[nodiscard]] inline std::uint32_t type_descriptor(const Segment& a_data, std::string_view a_name)
+{
+	using namespace std::literals;
+
+	const auto haystack = a_data.view<char>();
+	std::boyer_moore_horspool_searcher searcher(a_name.cbegin(), a_name.cend());
+	const auto [first, last] = searcher(haystack.begin(), haystack.end());
+
+	if (first == last) {
+		throw std::runtime_error("failed to find type descriptor"s);
+	} else {
+		return static_cast<std::uint32_t>(a_data.rva + (first - haystack.begin()) - 0x10);
+	}
+}
+
+// the slots of a segment, by the pointer they hold. only pointers within [a_first, a_last) are kept, and slots
+// holding the same pointer are chained through _next so the whole index is built in one pass
+class PointerIndex
+{
+public:
+	PointerIndex(std::uint64_t a_base, const Segment& a_segment, std::uint64_t a_first, std::uint64_t a_last) :
+		_slots(a_base + a_segment.rva)
+	{
+		const auto ptrs = a_segment.view<std::uint64_t>();
+		_next.resize(ptrs.size(), NONE);
+		for (std::size_t i = 0; i < ptrs.size(); ++i) {
+			if (a_first <= ptrs[i] && ptrs[i] < a_last) {
+				const auto [it, inserted] = _heads.try_emplace(ptrs[i], static_cast<std::uint32_t>(i));
+				if (!inserted) {
+					_next[i] = std::exchange(it->second, static_cast<std::uint32_t>(i));
+				}
+			}
+		}
+	}
+
+	// calls a_func with the address of every slot holding a_ptr
+	template <class F>
+	void for_each_slot(std::uint64_t a_ptr, F&& a_func) const
+	{
+		const auto it = _heads.find(a_ptr);
+		if (it != _heads.end()) {
+			for (auto i = it->second; i != NONE; i = _next[i]) {
+				a_func(_slots + i * sizeof(std::uint64_t));
+			}
+		}
+	}
+
+private:
+	static constexpr auto NONE = (std::numeric_limits<std::uint32_t>::max)();
+
+	// members
+	std::uint64_t _slots;
+	robin_hood::unordered_flat_map<std::uint64_t, std::uint32_t> _heads;  // ptr -> last slot holding it
+	std::vector<std::uint32_t> _next;                                     // slot -> previous slot holding the same ptr
+};
+
+// a NiRTTI is { name, base }, so whatever sits one slot before a pointer to a known NiRTTI is its child.
+// walks down from the seeds until no more children turn up
+[[nodiscard]] inline std::vector<std::uint64_t> find_nirtti(std::uint64_t a_base, const Segment& a_data, std::span<const std::uint64_t> a_seeds)
+{
+	const auto segment = a_base + a_data.rva;
+	auto first = segment;
+	auto last = segment + a_data.bytes.size();
+	for (const auto seed : a_seeds) {
+		first = (std::min)(first, seed);
+		last = (std::max)(last, seed + 1);
+	}
+	const PointerIndex index{ a_base, a_data, first, last };
+
+	robin_hood::unordered_flat_set<std::uint64_t> found;
+	std::vector<std::uint64_t> worklist;
+	for (const auto seed : a_seeds) {
+		if (found.insert(seed).second) {
+			worklist.push_back(seed);
+		}
+	}
+
+	std::vector<std::uint64_t> results;
+	while (!worklist.empty()) {
+		const auto rtti = worklist.back();
+		worklist.pop_back();
+		results.push_back(rtti);
+		index.for_each_slot(rtti, [&](std::uint64_t a_slot) {
+			const auto child = a_slot - sizeof(std::uint64_t);
+			if (a_slot > segment && found.insert(child).second) {
+				worklist.push_back(child);
+			}
+		});
+	}
+
+	return results;
+}
+
+// turns a demangled name into an identifier: "`anonymous namespace'" and [ &'*-`] are dropped, and
+// [(),:<>] become underscores
+[[nodiscard]] inline std::string sanitize_name(std::string_view a_name)
+{
+	using namespace std::literals;
+
+	enum class action_t : std::uint8_t
+	{
+		kKeep,
+		kDrop,
+		kReplace,
+	};
+
+	static constexpr auto actions = []() {
+		std::array<action_t, 256> result{};
+		for (const auto ch : " &'*-`"sv) {
+			result[static_cast<unsigned char>(ch)] = action_t::kDrop;
+		}
+		for (const auto ch : "(),:<>"sv) {
+			result[static_cast<unsigned char>(ch)] = action_t::kReplace;
+		}
+		return result;
+	}();
+	constexpr auto anonymous = "`anonymous namespace'"sv;
+
+	std::string result;
+	result.reserve(a_name.size());
+	for (std::size_t i = 0; i < a_name.size(); ++i) {
+		const auto ch = a_name[i];
+		switch (actions[static_cast<unsigned char>(ch)]) {
+		case action_t::kKeep:
+			result += ch;
+			break;
+		case action_t::kDrop:
+			if (ch == '`' && a_name.substr(i).starts_with(anonymous)) {
+				i += anonymous.size() - 1;
+			}
+			break;
+		case action_t::kReplace:
+			result += '_';
+			break;
+		}
+	}
+
+	return result;
+}
+
+// builds a header in memory so it can be written out in one go
+class HeaderWriter
+{
+public:
+	HeaderWriter(std::string_view a_namespace, std::size_t a_capacity)
+	{
+		using namespace std::literals;
+
+		_buffer.reserve(PROLOGUE.size() + a_namespace.size() + a_capacity + EPILOGUE.size());
+		*this << PROLOGUE << a_namespace << "\n\t{\n"sv;
+	}
+
+	HeaderWriter& operator<<(std::string_view a_string)
+	{
+		_buffer.append(a_string);
+		return *this;
+	}
+
+	HeaderWriter& operator<<(std::uint64_t a_value)
+	{
+		std::array<char, 20> buf;
+		const auto last = std::to_chars(buf.data(), buf.data() + buf.size(), a_value).ptr;
+		_buffer.append(buf.data(), last);
+		return *this;
+	}
+
+	void save(const std::filesystem::path& a_path)
+	{
+		using namespace std::literals;
+
+		*this << EPILOGUE;
+		std::ofstream file{ a_path };
+		file.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+		if (!file) {
+			throw std::runtime_error("failed to write: "s + a_path.string());
+		}
+	}
+
+private:
+	static constexpr std::string_view PROLOGUE = "#pragma once\n\nnamespace RE\n{\n\tnamespace ";
+	static constexpr std::string_view EPILOGUE = "\t}\n}\n";
+
+	// members
+	std::string _buffer;
+};
+
+inline void dump_rtti(const Target& a_target, const std::filesystem::path& a_directory)
+{
+	using namespace std::literals;
+
+	Stopwatch stopwatch;
+
+	const auto& image = a_target.image;
+	const auto base = image.base();
+	const auto rdata = image.segment(".rdata"sv);
+	const auto data = image.segment(".data"sv);
+	const RTTIIndex index{ base, rdata, data };
+	stopwatch.lap("index"sv);
+
+	const auto typeInfo = index.virtual_tables(type_descriptor(data, ".?AVtype_info@@"sv));
+	if (typeInfo.empty()) {
+		throw std::runtime_error("failed to find virtual tables"s);
+	}
+
+	std::vector<std::uint32_t> typeDescs;
+	const auto ptrs = data.view<std::uint64_t>();
+	for (std::size_t i = 0; i < ptrs.size(); ++i) {
+		if (ptrs[i] == base + typeInfo.front()) {
+			typeDescs.push_back(static_cast<std::uint32_t>(data.rva + i * sizeof(std::uint64_t)));
+		}
+	}
+	stopwatch.lap("scan"sv);
+
+	// the demangler may be single threaded, so names are decoded up front
+	std::vector<std::pair<std::uint32_t, std::string>> named;  // [ type desc, demangled name ]
+	named.reserve(typeDescs.size());
+	for (const auto typeDesc : typeDescs) {
+		const auto mangled = image.string(typeDesc + 0x10);
+		auto name = mangled ? a_target.demangle(*mangled) : std::nullopt;
+		if (name) {
+			named.emplace_back(typeDesc, std::move(*name));
+		} else {
+			spdlog::error("failed to decode name: {}", mangled.value_or(""sv));
+		}
+	}
+	stopwatch.lap("decode"sv);
+
+	using result_t = std::tuple<std::string, std::uint64_t, std::vector<std::uint64_t>>;  // [ demangled name, rtti id, vtable ids ]
+	std::vector<std::optional<result_t>> resolved(named.size());
+	parallel_for(named.size(), [&](std::size_t a_idx) {
+		const auto& [typeDesc, name] = named[a_idx];
+		try {
+			const auto rid = get_id(a_target, typeDesc);
+			const auto vtables = index.virtual_tables(typeDesc);
+			std::vector<std::uint64_t> vids(vtables.size());
+			std::ranges::transform(vtables, vids.begin(), [&](std::uint32_t a_vtable) { return get_id(a_target, a_vtable); });
+			resolved[a_idx].emplace(sanitize_name(name), rid, std::move(vids));
+		} catch (const std::exception&) {
+			spdlog::error("{}", name);
+		}
+	});
+
+	std::vector<result_t> results;
+	results.reserve(resolved.size());
+	for (auto& result : resolved) {
+		if (result) {
+			results.push_back(std::move(*result));
+		}
+	}
+	stopwatch.lap("resolve"sv);
+
+	std::sort(results.begin(), results.end());
+	results.erase(
+		std::unique(
+			results.begin(),
+			results.end(),
+			[](auto&& a_lhs, auto&& a_rhs) {
+				return std::get<0>(a_lhs) == std::get<0>(a_rhs);
+			}),
+		results.end());
+
+	constexpr std::array toRemove{
+		static_cast<std::uint64_t>(25921),   // float
+		static_cast<std::uint64_t>(950502),  // unsigned int
+	};
+	results.erase(
+		std::remove_if(
+			results.begin(),
+			results.end(),
+			[&](auto&& a_elem) {
+				return std::find(toRemove.begin(), toRemove.end(), std::get<1>(a_elem)) != toRemove.end();
+			}),
+		results.end());
+
+	// the longest line for each entry, short of its name and ids
+	constexpr std::size_t ridLine = "\t\tinline constexpr REL::ID { 18446744073709551615 };\n"sv.size();
+	constexpr std::size_t vidLine = "\t\tinline constexpr std::array<REL::ID, 18446744073709551615> {  };\n"sv.size();
+	constexpr std::size_t vidSize = "REL::ID(18446744073709551615), "sv.size();
+
+	std::size_t rtti = 0;
+	std::size_t vtable = 0;
+	for (const auto& [name, rid, vids] : results) {
+		(void)rid;
+		rtti += name.size() + ridLine;
+		vtable += name.size() + vidLine + vids.size() * vidSize;
+	}
+
+	HeaderWriter rids{ "RTTI"sv, rtti };
+	for (const auto& [name, rid, vids] : results) {
+		(void)vids;
+		rids << "\t\tinline constexpr REL::ID "sv << name << "{ "sv << rid << " };\n"sv;
+	}
+	rids.save(a_directory / "RTTI_IDs.h"sv);
+
+	HeaderWriter vtables{ "VTABLE"sv, vtable };
+	for (const auto& [name, rid, vids] : results) {
+		(void)rid;
+		if (!vids.empty()) {
+			vtables << "\t\tinline constexpr std::array<REL::ID, "sv << vids.size() << "> "sv << name << "{ "sv;
+			for (std::size_t i = 0; i < vids.size(); ++i) {
+				vtables << (i == 0 ? "REL::ID("sv : ", REL::ID("sv) << vids[i] << ")"sv;
+			}
+			vtables << " };\n"sv;
+		}
+	}
+	vtables.save(a_directory / "VTABLE_IDs.h"sv);
+	stopwatch.lap("write"sv);
+}
+
+inline void dump_nirtti(const Target& a_target, const std::filesystem::path& a_directory)
+{
+	using namespace std::literals;
+
+	const auto& image = a_target.image;
+	const auto base = image.base();
+	const auto address = [&](std::uint64_t a_id) {
+		const auto offset = a_target.id2offset(a_id);
+		if (!offset) {
+			throw std::out_of_range(fmt::format("id not found: {}", a_id));
+		}
+		return base + *offset;
+	};
+
+	// fix a dumb fuckup
+	const auto misnamed = address(221529);
+	constexpr auto rename = "BGSStaticCollection::RootFacade"sv;
+
+	constexpr std::array seeds = {
+		17735,    // NiObject
+		1352616,  // NiCullingProcess
+		31936,    // BSFaceGenMorphData
+		1482971,  // BSTempEffect
+		1123991,  // bhkCharacterProxy
+		858091,   // bhkCharacterRigidBody
+		933986,   // bhkNPCollisionObject
+		56458,    // bhkNPCollisionObjectBase
+		1372534,  // bhkNPCollisionObjectUnlinked
+		495124,   // bhkNPCollisionProxyObject
+		1325961,  // bhkPhysicsSystem
+		182826,   // bhkRagdollSystem
+		1359461,  // bhkWorld
+		34089,    // bhkWorldM
+	};
+	std::array<std::uint64_t, seeds.size()> roots;
+	std::ranges::transform(seeds, roots.begin(), address);
+	const auto results = find_nirtti(base, image.segment(".data"sv), roots);
+
+	std::vector<std::pair<std::string, std::uint64_t>> toPrint;
+	for (const auto& result : results) {
+		const auto ptr = image.read<std::uint64_t>(result - base);
+		const auto str = ptr ? image.rva(*ptr) : std::nullopt;
+		const auto name = result == misnamed ? std::make_optional(rename) : str ? image.string(*str) : std::nullopt;
+		try {
+			if (!name) {
+				throw std::runtime_error(fmt::format("name not found: {:#x}", result - base));
+			}
+			const auto id = get_id(a_target, result - base);
+			toPrint.emplace_back(sanitize_name(*name), id);
+		} catch (const std::exception&) {
+			spdlog::error("{}", name.value_or(""sv));
+		}
+	}
+
+	const auto comp =
+		[](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.first < a_rhs.first;
+		};
+	std::sort(toPrint.begin(), toPrint.end(), comp);
+
+	std::size_t capacity = 0;
+	for (const auto& elem : toPrint) {
+		capacity += elem.first.size() + "\t\tinline constexpr REL::ID { 18446744073709551615 };\n"sv.size();
+	}
+
+	HeaderWriter output{ "Ni_RTTI"sv, capacity };
+	for (const auto& elem : toPrint) {
+		output << "\t\tinline constexpr REL::ID "sv << elem.first << "{ "sv << elem.second << " };\n"sv;
+	}
+	output.save(a_directory / "NiRTTI_IDs.h"sv);
+}
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <mmio/mmio.hpp>
+
+// a segment of the image, by where it sits relative to the image base
+struct Segment
+{
+public:
+	[[nodiscard]] bool contains(std::uint64_t a_rva) const noexcept { return rva <= a_rva && a_rva < rva + bytes.size(); }
+
+	template <class T>
+	[[nodiscard]] std::span<const T> view() const noexcept
+	{
+		return { reinterpret_cast<const T*>(bytes.data()), bytes.size() / sizeof(T) };
+	}
+
+	// members
+	std::uint32_t rva{ 0 };
+	std::span<const std::byte> bytes;
+};
+
+namespace PE
+{
+	// the parts of the headers the image is laid out from, as they appear in winnt.h
+	inline constexpr std::uint16_t DOS_MAGIC = 0x5A4D;   // "MZ"
+	inline constexpr std::uint32_t NT_MAGIC = 0x4550;    // "PE\0\0"
+	inline constexpr std::uint16_t PE32_PLUS = 0x20B;
+
+	struct FileHeader
+	{
+	public:
+		// members
+		std::uint16_t machine;               // 00
+		std::uint16_t numberOfSections;      // 02
+		std::uint32_t timeDateStamp;         // 04
+		std::uint32_t pointerToSymbolTable;  // 08
+		std::uint32_t numberOfSymbols;       // 0C
+		std::uint16_t sizeOfOptionalHeader;  // 10
+		std::uint16_t characteristics;       // 12
+	};
+	static_assert(sizeof(FileHeader) == 0x14);
+
+	struct OptionalHeader64
+	{
+	public:
+		// members
+		std::uint16_t magic;                    // 00
+		std::uint8_t linkerVersion[2];          // 02
+		std::uint32_t sizeOfCode;               // 04
+		std::uint32_t sizeOfInitializedData;    // 08
+		std::uint32_t sizeOfUninitializedData;  // 0C
+		std::uint32_t addressOfEntryPoint;      // 10
+		std::uint32_t baseOfCode;               // 14
+		std::uint64_t imageBase;                // 18
+		std::uint32_t sectionAlignment;         // 20
+		std::uint32_t fileAlignment;            // 24
+		std::uint16_t versions[6];              // 28
+		std::uint32_t win32VersionValue;        // 34
+		std::uint32_t sizeOfImage;              // 38
+		std::uint32_t sizeOfHeaders;            // 3C
+	};
+	static_assert(sizeof(OptionalHeader64) == 0x40);
+
+	struct SectionHeader
+	{
+	public:
+		// members
+		char name[8];                       // 00
+		std::uint32_t virtualSize;          // 08
+		std::uint32_t virtualAddress;       // 0C
+		std::uint32_t sizeOfRawData;        // 10
+		std::uint32_t pointerToRawData;     // 14
+		std::uint32_t pointerToRelocations;  // 18
+		std::uint32_t pointerToLinenumbers;  // 1C
+		std::uint16_t numberOfRelocations;  // 20
+		std::uint16_t numberOfLinenumbers;  // 22
+		std::uint32_t characteristics;      // 24
+	};
+	static_assert(sizeof(SectionHeader) == 0x28);
+
+	struct Headers
+	{
+	public:
+		// members
+		OptionalHeader64 optional;
+		std::vector<SectionHeader> sections;
+	};
+
+	template <class T>
+	[[nodiscard]] T read(std::span<const std::byte> a_bytes, std::size_t a_offset)
+	{
+		using namespace std::literals;
+
+		if (a_offset > a_bytes.size() || a_bytes.size() - a_offset < sizeof(T)) {
+			throw std::runtime_error("image headers are truncated"s);
+		}
+
+		T result;
+		std::memcpy(std::addressof(result), a_bytes.data() + a_offset, sizeof(T));
+		return result;
+	}
+
+	// the headers read the same whether the image is laid out as a file or as the loader maps it
+	[[nodiscard]] inline Headers read_headers(std::span<const std::byte> a_bytes)
+	{
+		using namespace std::literals;
+
+		if (read<std::uint16_t>(a_bytes, 0) != DOS_MAGIC) {
+			throw std::runtime_error("not an executable image"s);
+		}
+
+		const auto nt = read<std::uint32_t>(a_bytes, 0x3C);
+		if (read<std::uint32_t>(a_bytes, nt) != NT_MAGIC) {
+			throw std::runtime_error("not a pe image"s);
+		}
+
+		const auto file = read<FileHeader>(a_bytes, nt + 4);
+		Headers result{ read<OptionalHeader64>(a_bytes, nt + 4 + sizeof(FileHeader)), {} };
+		if (result.optional.magic != PE32_PLUS) {
+			throw std::runtime_error("not a 64-bit image"s);
+		}
+
+		const auto sections = nt + 4 + sizeof(FileHeader) + file.sizeOfOptionalHeader;
+		for (std::size_t i = 0; i < file.numberOfSections; ++i) {
+			result.sections.push_back(read<SectionHeader>(a_bytes, sections + i * sizeof(SectionHeader)));
+		}
+
+		return result;
+	}
+}
+
+// an executable image laid out the way the loader maps it, so everything in it can be found by rva
+class Image
+{
+public:
+	Image(const Image&) = delete;
+	Image(Image&&) noexcept = default;
+
+	~Image() noexcept = default;
+
+	Image& operator=(const Image&) = delete;
+	Image& operator=(Image&&) noexcept = default;
+
+	// an image the loader has already mapped, whose pointers have been relocated to where it sits
+	[[nodiscard]] static Image map(const void* a_module)
+	{
+		const auto base = static_cast<const std::byte*>(a_module);
+		const auto headers = PE::read_headers({ base, 0x1000 });
+		Image result{ reinterpret_cast<std::uintptr_t>(base), headers };
+		result._bytes = { base, headers.optional.sizeOfImage };
+		return result;
+	}
+
+	// an image on disk, mapped as the loader would but left at its preferred base
+	[[nodiscard]] static Image load(const std::filesystem::path& a_path)
+	{
+		using namespace std::literals;
+
+		mmio::mapped_file_source file;
+		if (!file.open(a_path)) {
+			throw std::runtime_error("failed to open: "s + a_path.string());
+		}
+
+		const std::span raw{ reinterpret_cast<const std::byte*>(file.data()), file.size() };
+		const auto headers = PE::read_headers(raw);
+		Image result{ headers.optional.imageBase, headers };
+		result._storage.resize(headers.optional.sizeOfImage);
+		std::copy_n(raw.begin(), (std::min<std::size_t>)(headers.optional.sizeOfHeaders, raw.size()), result._storage.begin());
+		for (const auto& section : headers.sections) {
+			const auto size = (std::min)(section.sizeOfRawData, section.virtualSize);
+			if (section.pointerToRawData > raw.size() || raw.size() - section.pointerToRawData < size ||
+				section.virtualAddress > result._storage.size() || result._storage.size() - section.virtualAddress < size) {
+				throw std::runtime_error("section lies outside of the image"s);
+			}
+			std::copy_n(raw.begin() + section.pointerToRawData, size, result._storage.begin() + section.virtualAddress);
+		}
+
+		result._bytes = result._storage;
+		return result;
+	}
+
+	// the address the image's pointers are relative to
+	[[nodiscard]] std::uint64_t base() const noexcept { return _base; }
+	[[nodiscard]] std::span<const std::byte> bytes() const noexcept { return _bytes; }
+
+	[[nodiscard]] Segment segment(std::string_view a_name) const
+	{
+		using namespace std::literals;
+
+		const auto it = std::ranges::find(_segments, a_name, [](auto&& a_elem) { return std::string_view{ a_elem.first }; });
+		if (it == _segments.end()) {
+			throw std::runtime_error("image has no segment: "s + std::string{ a_name });
+		}
+
+		const auto& [rva, size] = it->second;
+		if (rva > _bytes.size() || _bytes.size() - rva < size) {
+			throw std::runtime_error("segment lies outside of the image"s);
+		}
+		return { rva, _bytes.subspan(rva, size) };
+	}
+
+	// a pointer stored in the image, made relative to it
+	[[nodiscard]] std::optional<std::uint32_t> rva(std::uint64_t a_address) const noexcept
+	{
+		return a_address >= _base && a_address - _base < _bytes.size() ?
+                   std::make_optional(static_cast<std::uint32_t>(a_address - _base)) :
+                   std::nullopt;
+	}
+
+	template <class T>
+	[[nodiscard]] std::optional<T> read(std::uint64_t a_rva) const noexcept
+	{
+		if (a_rva > _bytes.size() || _bytes.size() - a_rva < sizeof(T)) {
+			return std::nullopt;
+		}
+
+		T result;
+		std::memcpy(std::addressof(result), _bytes.data() + a_rva, sizeof(T));
+		return result;
+	}
+
+	// a nul terminated string, if it ends inside of the image
+	[[nodiscard]] std::optional<std::string_view> string(std::uint64_t a_rva) const noexcept
+	{
+		if (a_rva >= _bytes.size()) {
+			return std::nullopt;
+		}
+
+		const auto first = reinterpret_cast<const char*>(_bytes.data() + a_rva);
+		const auto last = reinterpret_cast<const char*>(_bytes.data() + _bytes.size());
+		const auto end = std::find(first, last, '\0');
+		return end != last ? std::make_optional(std::string_view{ first, end }) : std::nullopt;
+	}
+
+private:
+	Image(std::uint64_t a_base, const PE::Headers& a_headers) :
+		_base(a_base)
+	{
+		for (const auto& section : a_headers.sections) {
+			const auto name = std::string_view{ section.name, std::find(std::begin(section.name), std::end(section.name), '\0') };
+			_segments.emplace_back(std::string{ name }, std::make_pair(section.virtualAddress, section.virtualSize));
+		}
+	}
+
+	// members
+	std::vector<std::byte> _storage;
+	std::span<const std::byte> _bytes;
+	std::uint64_t _base{ 0 };
+	std::vector<std::pair<std::string, std::pair<std::uint32_t, std::uint32_t>>> _segments;  // [ name, [ rva, size ] ]
+};
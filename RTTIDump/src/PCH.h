@@ -6,17 +6,18 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <span>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include <robin_hood.h>
-#include <srell.hpp>
 
 #ifdef NDEBUG
 #	include <spdlog/sinks/basic_file_sink.h>
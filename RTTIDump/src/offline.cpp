@@ -0,0 +1,61 @@
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "AddressLibrary.h"
+#include "Demangler.h"
+#include "Dumper.h"
+
+using namespace std::literals;
+
+// dumps from a copy of the executable on disk, rather than from the running game
+void dump(const std::filesystem::path& a_executable, const std::filesystem::path& a_database, const std::filesystem::path& a_directory)
+{
+	const auto library = std::make_shared<const AddressLibrary>(AddressLibrary::load(a_database));
+	const Target target{
+		Image::load(a_executable),
+		[=](std::uint64_t a_offset) { return library->id(a_offset); },
+		[=](std::uint64_t a_id) { return library->offset(a_id); },
+		Demangler::demangle,
+	};
+
+	std::filesystem::create_directories(a_directory);
+	dump_rtti(target, a_directory);
+	dump_nirtti(target, a_directory);
+}
+
+int main(int a_argc, char* a_argv[])
+{
+	const std::span args{ a_argv, static_cast<std::size_t>(a_argc) };
+	if (args.size() < 4 || args.size() % 2 != 0) {
+		std::cerr << "usage: "sv << args[0] << " <output directory> <Fallout4.exe> <address library> [<Fallout4.exe> <address library>...]\n"sv;
+		return EXIT_FAILURE;
+	}
+
+	const std::filesystem::path output{ args[1] };
+	std::vector<std::future<void>> jobs;
+	for (std::size_t i = 2; i + 1 < args.size(); i += 2) {
+		const std::filesystem::path executable{ args[i] };
+		const std::filesystem::path database{ args[i + 1] };
+		jobs.push_back(std::async(std::launch::async, [=]() {
+			dump(executable, database, output / database.stem());
+		}));
+	}
+
+	int result = EXIT_SUCCESS;
+	for (std::size_t i = 0; i < jobs.size(); ++i) {
+		try {
+			jobs[i].get();
+		} catch (const std::exception& e) {
+			std::cerr << args[2 + i * 2] << ": "sv << e.what() << '\n';
+			result = EXIT_FAILURE;
+		}
+	}
+
+	return result;
+}
@@ -10,7 +10,7 @@
 
 #pragma region MenuOpenCloseEventSink
 BSEventNotifyControl MenuOpenCloseEventSink::ProcessEvent(const MenuOpenCloseEvent& a_event, BSTEventSource<MenuOpenCloseEvent>* a_source) {
-	const BSFixedString LoadingMenu("LoadingMenu");
+	constexpr fixed_literal<"LoadingMenu"> LoadingMenu;
 	if (a_event.menuName == LoadingMenu && a_event.opening) {
 		logInfo("Loading...");
 		gameLoading = true;
@@ -0,0 +1,169 @@
+#include "RE/Bethesda/BSExtraDataAlg.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	struct Extra
+	{
+	public:
+		[[nodiscard]] std::uint32_t GetExtraType() const noexcept { return type; }
+
+		// members
+		Extra* next{ nullptr };
+		std::uint32_t type{ 0 };
+	};
+
+	// a list shaped like the game's, with its presence flags, over nodes which live wherever a_storage
+	// put them
+	class ExtraList
+	{
+	public:
+		ExtraList(std::span<const std::uint32_t> a_types, std::span<Extra* const> a_storage)
+		{
+			assert(a_types.size() <= a_storage.size());
+			for (std::size_t i = 0; i < a_types.size(); ++i) {
+				a_storage[i]->type = a_types[i];
+				a_storage[i]->next = i + 1 < a_types.size() ? a_storage[i + 1] : nullptr;
+				_flags.set(a_types[i]);
+			}
+			_head = a_types.empty() ? nullptr : a_storage[0];
+		}
+
+		[[nodiscard]] Extra* head() noexcept { return _head; }
+		[[nodiscard]] bool has(std::uint32_t a_type) const noexcept { return _flags.test(a_type); }
+
+		// what BaseExtraList::GetByType does
+		[[nodiscard]] Extra* find(std::uint32_t a_type) noexcept
+		{
+			if (has(a_type)) {
+				for (auto iter = head(); iter; iter = iter->next) {
+					if (iter->GetExtraType() == a_type) {
+						return iter;
+					}
+				}
+			}
+			return nullptr;
+		}
+
+		void find(std::span<const std::uint32_t> a_types, std::span<Extra*> a_result) noexcept
+		{
+			RE::detail::find_extras(head(), a_types, a_result, [this](std::uint32_t a_type) { return has(a_type); });
+		}
+
+	private:
+		Extra* _head{ nullptr };
+		std::bitset<0xE0> _flags;
+	};
+
+	// random lists of a_length types, each always holding a_include somewhere. the nodes are scattered
+	// over one arena, as they would be over the game's heap
+	class ExtraLists
+	{
+	public:
+		ExtraLists(std::size_t a_count, std::size_t a_length, std::span<const std::uint32_t> a_include = {}) :
+			_arena(a_count * a_length)
+		{
+			std::mt19937 rng{ 0xE47A };
+			std::vector<Extra*> nodes;
+			for (auto& node : _arena) {
+				nodes.push_back(std::addressof(node));
+			}
+			std::ranges::shuffle(nodes, rng);
+
+			std::vector<std::uint32_t> rest;
+			for (std::uint32_t type = 0; type < 0xE0; ++type) {
+				if (std::ranges::find(a_include, type) == a_include.end()) {
+					rest.push_back(type);
+				}
+			}
+
+			lists.reserve(a_count);
+			std::vector<std::uint32_t> types;
+			for (std::size_t i = 0; i < a_count; ++i) {
+				std::ranges::shuffle(rest, rng);
+				types.assign(a_include.begin(), a_include.end());
+				types.insert(types.end(), rest.begin(), rest.begin() + static_cast<std::ptrdiff_t>(a_length - a_include.size()));
+				std::ranges::shuffle(types, rng);
+				lists.emplace_back(types, std::span{ nodes }.subspan(i * a_length, a_length));
+			}
+		}
+
+		// members
+		std::vector<ExtraList> lists;
+
+	private:
+		std::vector<Extra> _arena;
+	};
+}
+
+TEST_CASE("find extras")
+{
+	constexpr std::array<std::uint32_t, 6> types{ 1, 2, 3, 4, 5, 6 };
+	std::array<Extra, types.size()> nodes{};
+	std::array<Extra*, types.size()> storage{};
+	std::ranges::transform(nodes, storage.begin(), [](Extra& a_node) { return std::addressof(a_node); });
+	ExtraList list{ types, storage };
+
+	std::array<Extra*, 4> result{};
+	list.find(std::array<std::uint32_t, 4>{ 4, 9, 1, 6 }, result);
+	REQUIRE(result[0] == list.find(4));
+	REQUIRE(result[1] == nullptr);
+	REQUIRE(result[2] == list.head());
+	REQUIRE(result[3] == list.find(6));
+
+	// the same type twice gets the same extra
+	std::array<Extra*, 2> twice{};
+	list.find(std::array<std::uint32_t, 2>{ 3, 3 }, twice);
+	REQUIRE(twice[0] == list.find(3));
+	REQUIRE(twice[1] == twice[0]);
+
+	// against the one at a time lookup, over lists of every shape
+	constexpr std::array<std::uint32_t, 5> wanted{ 0x21, 0x24, 0x28, 0x2F, 0x99 };
+	ExtraLists lists{ 1000, 16 };
+	for (auto& random : lists.lists) {
+		std::array<Extra*, wanted.size()> found{};
+		random.find(wanted, found);
+		for (std::size_t i = 0; i < wanted.size(); ++i) {
+			REQUIRE(found[i] == random.find(wanted[i]));
+		}
+	}
+
+	ExtraList empty{ {}, {} };
+	std::array<Extra*, wanted.size()> none;
+	none.fill(list.head());
+	empty.find(wanted, none);
+	REQUIRE(std::ranges::all_of(none, [](const Extra* a_extra) { return a_extra == nullptr; }));
+}
+
+TEST_CASE("find extras benchmark", "[.][benchmark]")
+{
+	// a handful of the types a reference is usually asked for, most of which it has
+	constexpr std::array<std::uint32_t, 5> wanted{ 0x21, 0x24, 0x28, 0x2F, 0x99 };
+
+	for (const std::size_t length : { 8, 16, 32 }) {
+		ExtraLists lists{ 10'000, length, std::span{ wanted }.first(3) };
+
+		BENCHMARK("one at a time, " + std::to_string(length) + " extras")
+		{
+			std::size_t found = 0;
+			for (auto& list : lists.lists) {
+				for (const auto type : wanted) {
+					found += list.find(type) != nullptr;
+				}
+			}
+			return found;
+		};
+
+		BENCHMARK("single pass, " + std::to_string(length) + " extras")
+		{
+			std::size_t found = 0;
+			std::array<Extra*, wanted.size()> result{};
+			for (auto& list : lists.lists) {
+				list.find(wanted, result);
+				found += std::ranges::count_if(result, [](const Extra* a_extra) { return a_extra != nullptr; });
+			}
+			return found;
+		};
+	}
+}
@@ -0,0 +1,91 @@
+#include "Stubs.h"
+
+#include "RE/RTTI_IDs.h"
+#include "RE/VTABLE_IDs.h"
+
+#include "RE/Bethesda/BSStringPool.h"
+#include "RE/Bethesda/BSSystem/BSFixedString.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	using Entry = RE::BSStringPool::Entry;
+
+	// stands in for the game's pool, handing out one entry per string. like the game's BucketTable, every
+	// lookup locks the stripe its string hashes to, and each of those acquisitions is counted
+	class MockPool
+	{
+	public:
+		[[nodiscard]] static MockPool& get()
+		{
+			static MockPool singleton;
+			return singleton;
+		}
+
+		[[nodiscard]] Entry* get_entry(std::string_view a_string)
+		{
+			auto& stripe = _stripes[std::hash<std::string_view>{}(a_string) % _stripes.size()];
+			const std::scoped_lock l{ stripe };
+			locks.fetch_add(1, std::memory_order_relaxed);
+
+			auto& entry = _entries[std::string{ a_string }];
+			if (!entry) {
+				entry = std::make_unique<Entry>();
+			}
+			return entry.get();
+		}
+
+		std::atomic<std::size_t> locks{ 0 };
+
+	private:
+		std::array<std::mutex, 0x10> _stripes;
+		std::map<std::string, std::unique_ptr<Entry>> _entries;
+	};
+
+	class MockString
+	{
+	public:
+		MockString(const char* a_string) :
+			_data(MockPool::get().get_entry(a_string))
+		{}
+
+		[[nodiscard]] friend bool operator==(const MockString& a_lhs, const MockString& a_rhs) noexcept { return a_lhs._data == a_rhs._data; }
+
+	private:
+		Entry* _data;
+	};
+}
+
+TEST_CASE("fixed literal")
+{
+	// the literal interns through whatever string type it wraps, which is the pool's own by default
+	static_assert(std::same_as<RE::fixed_literal<"LoadingMenu">::string_type, RE::BSFixedString>);
+	static_assert(std::same_as<RE::fixed_literal<L"LoadingMenu">::string_type, RE::BSFixedStringW>);
+	static_assert(requires(RE::fixed_literal<"LoadingMenu"> a_lhs, const RE::BSFixedString& a_rhs) { { a_lhs == a_rhs } -> std::same_as<bool>; });
+
+	using LoadingMenu = RE::fixed_literal<"LoadingMenu", MockString>;
+	static_assert(LoadingMenu::view() == "LoadingMenu"sv);
+
+	auto& pool = MockPool::get();
+	const MockString loading{ "LoadingMenu" };
+	const MockString other{ "PauseMenu" };
+	constexpr std::size_t events = 1000;
+
+	// a temporary per event locks a stripe of the pool every time
+	pool.locks = 0;
+	for (std::size_t i = 0; i < events; ++i) {
+		const MockString menu{ "LoadingMenu" };
+		REQUIRE(loading == menu);
+		REQUIRE_FALSE(other == menu);
+	}
+	REQUIRE(pool.locks == events);
+
+	// the literal locks once, the first time it is used
+	pool.locks = 0;
+	for (std::size_t i = 0; i < events; ++i) {
+		REQUIRE(loading == LoadingMenu{});
+		REQUIRE_FALSE(other == LoadingMenu{});
+	}
+	REQUIRE(pool.locks == 1);
+}
@@ -0,0 +1,742 @@
+#define FMT_STRING(a_str) a_str
+
+namespace F4SE
+{
+	namespace log
+	{
+		template <class... Args>
+		void error(Args&&...)
+		{}
+
+		template <class... Args>
+		void warn(Args&&...)
+		{}
+	}
+
+	namespace stl
+	{
+		namespace nttp
+		{
+			template <class CharT, std::size_t N>
+			struct string
+			{
+				using char_type = CharT;
+
+				consteval string(const CharT* a_string) noexcept { std::copy_n(a_string, N, c); }
+
+				[[nodiscard]] consteval const CharT* data() const noexcept { return c; }
+				[[nodiscard]] consteval std::size_t length() const noexcept { return N; }
+
+				CharT c[N]{};
+			};
+
+			template <class CharT, std::size_t N>
+			string(const CharT (&)[N]) -> string<CharT, N - 1>;
+		}
+
+		template <class T>
+		using remove_cvptr_t = std::remove_cv_t<std::remove_pointer_t<T>>;
+
+		using zstring = std::string_view;
+	}
+}
+
+namespace REL
+{
+	class ID
+	{
+	public:
+		explicit constexpr ID(std::uint64_t) noexcept {}
+	};
+
+	// nothing in this suite may reach the game
+	template <class T>
+	class Relocation
+	{
+	public:
+		explicit Relocation(ID) noexcept {}
+
+		[[nodiscard]] std::remove_pointer_t<T>& operator*() const { throw std::runtime_error("relocations are not available in tests"); }
+	};
+}
+
+namespace RE
+{
+	namespace stl = F4SE::stl;
+
+	class BSFixedString
+	{
+	public:
+		BSFixedString() = default;
+
+		BSFixedString(std::string_view a_string) :
+			_data(a_string)
+		{}
+
+		[[nodiscard]] const char* c_str() const noexcept { return _data.c_str(); }
+
+		operator std::string_view() const noexcept { return _data; }
+
+	private:
+		std::string _data;
+	};
+
+	using BSFixedStringCS = BSFixedString;
+
+	template <stl::nttp::string S>
+	class fixed_literal
+	{
+	public:
+		[[nodiscard]] static const BSFixedString& get()
+		{
+			static const BSFixedString interned{ std::string_view{ S.data(), S.length() } };
+			return interned;
+		}
+	};
+
+	template <class>
+	struct BSTSmartPointerIntrusiveRefCount
+	{};
+
+	template <class T, template <class> class = BSTSmartPointerIntrusiveRefCount>
+	class BSTSmartPointer
+	{
+	public:
+		using element_type = T;
+
+		BSTSmartPointer() noexcept = default;
+		BSTSmartPointer(std::nullptr_t) noexcept {}
+
+		BSTSmartPointer(T* a_ptr) :
+			_ptr(a_ptr, [](T*) {})
+		{}
+
+		BSTSmartPointer(std::shared_ptr<T> a_ptr) noexcept :
+			_ptr(std::move(a_ptr))
+		{}
+
+		[[nodiscard]] T* get() const noexcept { return _ptr.get(); }
+		[[nodiscard]] T* operator->() const noexcept { return get(); }
+		[[nodiscard]] T& operator*() const noexcept { return *get(); }
+		explicit operator bool() const noexcept { return get() != nullptr; }
+
+		[[nodiscard]] friend bool operator==(const BSTSmartPointer& a_lhs, std::nullptr_t) noexcept { return !a_lhs; }
+
+	private:
+		std::shared_ptr<T> _ptr;
+	};
+
+	class TESForm
+	{};
+
+	class TESObjectREFR :
+		public TESForm
+	{
+	public:
+		static constexpr auto FORM_ID = 0x40;
+	};
+
+	namespace BSScript
+	{
+		class IComplexType
+		{};
+
+		class ObjectTypeInfo :
+			public IComplexType
+		{
+		public:
+			// members
+			BSFixedString name;
+		};
+
+		class StructTypeInfo :
+			public IComplexType
+		{
+		public:
+			// members
+			std::unordered_map<std::string_view, std::uint32_t> varNameIndexMap;
+		};
+
+		class TypeInfo
+		{
+		public:
+			enum class RawType : std::uint32_t
+			{
+				kNone,
+				kObject,
+				kString,
+				kInt,
+				kFloat,
+				kBool,
+				kVar,
+				kStruct,
+
+				kArrayStart = 10
+			};
+
+			TypeInfo(std::nullptr_t) noexcept {}
+			TypeInfo(RawType a_type) noexcept :
+				type(a_type)
+			{}
+
+			TypeInfo(ObjectTypeInfo* a_info) noexcept :
+				type(RawType::kObject)
+			{
+				data.complexTypeInfo = a_info;
+			}
+
+			TypeInfo(StructTypeInfo* a_info) noexcept :
+				type(RawType::kStruct)
+			{
+				data.complexTypeInfo = a_info;
+			}
+
+			[[nodiscard]] bool IsObject() const noexcept { return type == RawType::kObject; }
+			void SetArray(bool a_set) noexcept { array = a_set; }
+
+			// members
+			RawType type{ RawType::kNone };
+			bool array{ false };
+			struct
+			{
+			public:
+				// members
+				IComplexType* complexTypeInfo{ nullptr };
+			} data;
+		};
+
+		class Array;
+		class Object;
+		class Struct;
+
+		class Variable
+		{
+		private:
+			using value_type = std::variant<
+				std::nullptr_t,
+				std::int32_t,
+				std::uint32_t,
+				float,
+				bool,
+				BSFixedString,
+				BSTSmartPointer<Object>,
+				BSTSmartPointer<Array>,
+				BSTSmartPointer<Struct>,
+				Variable*>;
+
+		public:
+			Variable() = default;
+
+			template <class T>
+			Variable& operator=(T&& a_value)  //
+				requires(std::is_assignable_v<value_type&, T &&>)
+			{
+				_value = std::forward<T>(a_value);
+				return *this;
+			}
+
+			template <class T>
+			[[nodiscard]] bool is() const noexcept
+			{
+				if constexpr (std::same_as<T, Object> || std::same_as<T, Array> || std::same_as<T, Struct>) {
+					return std::holds_alternative<BSTSmartPointer<T>>(_value);
+				} else if constexpr (std::same_as<T, Variable>) {
+					return std::holds_alternative<Variable*>(_value);
+				} else {
+					return std::holds_alternative<T>(_value);
+				}
+			}
+
+			template <class T>
+			[[nodiscard]] friend auto get(const Variable& a_var)
+			{
+				if constexpr (std::same_as<T, Object> || std::same_as<T, Array> || std::same_as<T, Struct>) {
+					return std::get<BSTSmartPointer<T>>(a_var._value);
+				} else if constexpr (std::same_as<T, Variable>) {
+					return std::get<Variable*>(a_var._value);
+				} else {
+					return std::get<T>(a_var._value);
+				}
+			}
+
+		private:
+			// members
+			value_type _value{ nullptr };
+		};
+
+		class Array
+		{
+		public:
+			// members
+			TypeInfo elementType{ nullptr };
+			std::vector<Variable> elements;
+		};
+
+		class Object
+		{
+		public:
+			[[nodiscard]] std::uint64_t GetHandle() const noexcept { return 0; }
+		};
+
+		class Struct
+		{
+		public:
+			// members
+			BSTSmartPointer<StructTypeInfo> type;
+			std::vector<Variable> variables;
+		};
+
+		class IObjectHandlePolicy
+		{
+		public:
+			[[nodiscard]] std::uint64_t EmptyHandle() const noexcept { return 0; }
+			[[nodiscard]] std::uint64_t GetHandleForObject(std::uint32_t, const void*) const noexcept { return 0; }
+			[[nodiscard]] void* GetObjectForHandle(std::uint32_t, std::uint64_t) const noexcept { return nullptr; }
+			[[nodiscard]] bool HandleIsType(std::uint32_t, std::uint64_t) const noexcept { return false; }
+			[[nodiscard]] bool IsHandleLoaded(std::uint64_t) const noexcept { return false; }
+		};
+
+		class ObjectBindPolicy
+		{
+		public:
+			void BindObject(BSTSmartPointer<Object>&, std::uint64_t) {}
+		};
+
+		class IFunction
+		{
+		public:
+			virtual ~IFunction() = default;
+		};
+
+		class StackFrame;
+
+		// frames hold their arguments in one flat page
+		class Stack
+		{
+		public:
+			[[nodiscard]] std::uint32_t GetPageForFrame(const StackFrame*) const noexcept { return 0; }
+			[[nodiscard]] Variable& GetStackFrameVariable(const StackFrame*, std::uint32_t a_index, std::uint32_t) noexcept { return args[a_index]; }
+
+			// members
+			std::vector<Variable> args;
+		};
+
+		class StackFrame
+		{
+		public:
+			// members
+			Stack* parent{ nullptr };
+			std::uint32_t size{ 0 };
+		};
+
+		namespace Internal
+		{
+			class VirtualMachine;
+		}
+
+		namespace NF_util
+		{
+			class NativeFunctionBase :
+				public IFunction
+			{
+			public:
+				NativeFunctionBase(std::string_view a_object, std::string_view a_function, std::uint32_t a_paramCount, bool a_isStatic, bool a_isLatent) :
+					name(a_function),
+					objName(a_object),
+					isStatic(a_isStatic),
+					isLatent(a_isLatent)
+				{
+					descTable.paramCount = a_paramCount;
+					descTable.entries.resize(a_paramCount, { BSFixedString{}, nullptr });
+				}
+
+				virtual bool HasStub() const = 0;
+				virtual bool MarshallAndDispatch(Variable& a_self, Internal::VirtualMachine& a_vm, std::uint32_t a_stackID, Variable& a_retVal, const StackFrame& a_stackFrame) const = 0;
+
+				// members
+				BSFixedString name;
+				BSFixedString objName;
+				TypeInfo retType{ nullptr };
+				struct
+				{
+				public:
+					// members
+					std::uint32_t paramCount{ 0 };
+					std::vector<std::pair<BSFixedString, TypeInfo>> entries;
+				} descTable;
+				bool isStatic;
+				bool isLatent;
+			};
+		}
+
+		class IVirtualMachine
+		{
+		public:
+			bool CreateArray(const TypeInfo& a_type, std::uint32_t a_elementCount, BSTSmartPointer<Array>& a_newArray)
+			{
+				++arrays;
+				a_newArray = std::make_shared<Array>(Array{ a_type, std::vector<Variable>(a_elementCount) });
+				return true;
+			}
+
+			bool CreateStruct(const BSFixedString& a_name, BSTSmartPointer<Struct>& a_newStruct)
+			{
+				BSTSmartPointer<StructTypeInfo> type;
+				if (!GetScriptStructType(a_name, type)) {
+					return false;
+				}
+
+				a_newStruct = std::make_shared<Struct>(Struct{ type, std::vector<Variable>(type->varNameIndexMap.size()) });
+				return true;
+			}
+
+			bool CreateObject(const BSFixedString&, BSTSmartPointer<Object>&) { return false; }
+			bool FindBoundObject(std::uint64_t, const char*, bool, BSTSmartPointer<Object>&, bool) const { return false; }
+			bool GetScriptObjectType(std::uint32_t, BSTSmartPointer<ObjectTypeInfo>&) { return false; }
+			bool GetScriptObjectType(const BSFixedString&, BSTSmartPointer<ObjectTypeInfo>&) { return false; }
+			bool GetScriptStructType(const BSFixedString& a_name, BSTSmartPointer<StructTypeInfo>& a_structType)
+			{
+				const auto it = structTypes.find(std::string{ static_cast<std::string_view>(a_name) });
+				if (it == structTypes.end()) {
+					return false;
+				}
+
+				a_structType = it->second;
+				return true;
+			}
+
+			[[nodiscard]] IObjectHandlePolicy& GetObjectHandlePolicy() noexcept { return handles; }
+			[[nodiscard]] ObjectBindPolicy& GetObjectBindPolicy() noexcept { return binding; }
+
+			bool BindNativeMethod(IFunction* a_function)
+			{
+				functions.emplace_back(a_function);
+				return true;
+			}
+
+			void SetCallableFromTasklets(const char*, const char*, bool) {}
+
+			template <class F>
+			void BindNativeMethod(
+				stl::zstring a_object,
+				stl::zstring a_function,
+				F a_func,
+				std::optional<bool> a_taskletCallable = std::nullopt,
+				bool a_isLatent = false);
+
+			template <auto F>
+			void BindNativeMethod(
+				stl::zstring a_object,
+				stl::zstring a_function,
+				std::optional<bool> a_taskletCallable = std::nullopt,
+				bool a_isLatent = false);
+
+			// members
+			IObjectHandlePolicy handles;
+			ObjectBindPolicy binding;
+			std::vector<std::unique_ptr<IFunction>> functions;
+			std::map<std::string, BSTSmartPointer<StructTypeInfo>> structTypes;
+			std::size_t arrays{ 0 };
+		};
+
+		namespace Internal
+		{
+			class VirtualMachine :
+				public IVirtualMachine
+			{};
+		}
+	}
+
+	namespace GameScript
+	{
+		class RefrOrInventoryObj
+		{
+		public:
+			RefrOrInventoryObj() = default;
+			explicit RefrOrInventoryObj(std::uint64_t) noexcept {}
+
+			[[nodiscard]] TESObjectREFR* Reference() const noexcept { return nullptr; }
+			[[nodiscard]] const TESObjectREFR* Container() const noexcept { return nullptr; }
+			[[nodiscard]] std::uint16_t UniqueID() const noexcept { return 0; }
+		};
+
+		struct HandlePolicy
+		{
+			[[nodiscard]] static std::uint64_t GetHandleForInventoryID(std::uint16_t, std::uint32_t) noexcept { return 0; }
+		};
+
+		void BindCObject(const BSTSmartPointer<BSScript::Object>&, const RefrOrInventoryObj&, BSScript::IVirtualMachine&) {}
+	}
+
+	class GameVM
+	{
+	public:
+		[[nodiscard]] static GameVM* GetSingleton() noexcept { return singleton; }
+		[[nodiscard]] BSScript::IVirtualMachine* GetVM() noexcept { return vm; }
+
+		static inline GameVM* singleton{ nullptr };
+
+		// members
+		BSScript::IVirtualMachine* vm{ nullptr };
+	};
+}
+
+#include "RE/Bethesda/BSScriptUtil.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	using RE::BSScript::Variable;
+
+	std::int32_t Sum(std::monostate, std::int32_t a_int, float a_float, bool a_bool, std::uint32_t a_uint)
+	{
+		return a_int + static_cast<std::int32_t>(a_float) + a_bool + static_cast<std::int32_t>(a_uint);
+	}
+
+	std::int32_t Depth(RE::BSScript::IVirtualMachine&, std::uint32_t a_stackID, std::monostate, std::int32_t a_int)
+	{
+		return static_cast<std::int32_t>(a_stackID) + a_int;
+	}
+
+	std::string_view Name(std::monostate, std::string_view a_name) { return a_name; }
+
+	using PluginInfo = RE::BSScript::structure_wrapper<"Game", "PluginInfo">;
+
+	// reads the struct's variables back in the order its members were defined
+	[[nodiscard]] std::int32_t member(const PluginInfo& a_info, std::uint32_t a_index)
+	{
+		const auto proxy = RE::BSScript::detail::wrapper_accessor::get_proxy(a_info);
+		return get<std::int32_t>(proxy->variables[a_index]);
+	}
+
+	const std::vector<std::uint32_t> values(64, 7);
+
+	std::vector<std::uint32_t> CopyValues(std::monostate) { return values; }
+	std::span<const std::uint32_t> ViewValues(std::monostate) { return values; }
+
+	// a vm with a stack frame to call its bound functions against
+	class Harness
+	{
+	public:
+		Harness()
+		{
+			game.vm = std::addressof(vm);
+			RE::GameVM::singleton = std::addressof(game);
+			frame.parent = std::addressof(stack);
+		}
+
+		~Harness() { RE::GameVM::singleton = nullptr; }
+
+		Variable call(std::size_t a_index)
+		{
+			Variable result;
+			const auto& function = static_cast<const RE::BSScript::NF_util::NativeFunctionBase&>(*vm.functions[a_index]);
+			Variable self;
+			REQUIRE(function.MarshallAndDispatch(self, vm, 3, result, frame));
+			return result;
+		}
+
+		// a fresh load of a structure type, with its members at the given indices
+		void define(std::string a_name, std::initializer_list<std::pair<std::string_view, std::uint32_t>> a_members)
+		{
+			auto type = std::make_shared<RE::BSScript::StructTypeInfo>();
+			type->varNameIndexMap.insert(a_members.begin(), a_members.end());
+			vm.structTypes[std::move(a_name)] = std::move(type);
+		}
+
+		[[nodiscard]] const RE::BSScript::NF_util::NativeFunctionBase& function(std::size_t a_index) const
+		{
+			return static_cast<const RE::BSScript::NF_util::NativeFunctionBase&>(*vm.functions[a_index]);
+		}
+
+		// members
+		RE::BSScript::Internal::VirtualMachine vm;
+		RE::GameVM game;
+		RE::BSScript::Stack stack;
+		RE::BSScript::StackFrame frame;
+	};
+
+	void push(RE::BSScript::Stack& a_stack, auto... a_args)
+	{
+		a_stack.args.clear();
+		((a_stack.args.emplace_back() = a_args), ...);
+	}
+}
+
+TEST_CASE("native function thunks")
+{
+	Harness harness;
+	auto& vm = harness.vm;
+	const auto obj = "Test"sv;
+
+	vm.BindNativeMethod(obj, "Sum"sv, Sum);
+	vm.BindNativeMethod<Sum>(obj, "Sum"sv);
+	vm.BindNativeMethod<Depth>(obj, "Depth"sv);
+	vm.BindNativeMethod<[](std::monostate, std::int32_t a_int) { return a_int * 2; }>(obj, "Twice"sv);
+	vm.BindNativeMethod<Name>(obj, "Name"sv);
+	REQUIRE(vm.functions.size() == 5);
+
+	// both paths describe the same signature to the vm
+	for (const auto i : { 0, 1 }) {
+		const auto& function = harness.function(i);
+		REQUIRE(function.isStatic);
+		REQUIRE(function.descTable.paramCount == 4);
+		REQUIRE(function.descTable.entries[1].second.type == RE::BSScript::TypeInfo::RawType::kFloat);
+		REQUIRE(function.retType.type == RE::BSScript::TypeInfo::RawType::kInt);
+	}
+
+	for (const auto i : { 0, 1 }) {
+		push(harness.stack, std::int32_t{ 1 }, 2.5f, true, std::uint32_t{ 4 });
+		harness.frame.size = 4;
+		REQUIRE(get<std::int32_t>(harness.call(i)) == 8);
+	}
+
+	push(harness.stack, std::int32_t{ 10 });
+	harness.frame.size = 1;
+	REQUIRE(harness.function(2).descTable.paramCount == 1);
+	REQUIRE(get<std::int32_t>(harness.call(2)) == 13);
+	REQUIRE(get<std::int32_t>(harness.call(3)) == 20);
+
+	push(harness.stack, RE::BSFixedString{ "hello" });
+	REQUIRE(static_cast<std::string_view>(get<RE::BSFixedString>(harness.call(4))) == "hello"sv);
+}
+
+TEST_CASE("native function array returns")
+{
+	Harness harness;
+	auto& vm = harness.vm;
+	const auto obj = "Test"sv;
+
+	vm.BindNativeMethod<CopyValues>(obj, "CopyValues"sv);
+	vm.BindNativeMethod<ViewValues>(obj, "ViewValues"sv);
+	harness.frame.size = 0;
+
+	for (const auto i : { 0, 1 }) {
+		const auto& function = harness.function(i);
+		REQUIRE(function.retType.type == RE::BSScript::TypeInfo::RawType::kInt);
+		REQUIRE(function.retType.array);
+
+		const auto result = get<RE::BSScript::Array>(harness.call(i));
+		REQUIRE(result);
+		REQUIRE(result->elements.size() == values.size());
+		REQUIRE(std::ranges::all_of(result->elements, [](const Variable& a_var) { return get<std::uint32_t>(a_var) == 7; }));
+	}
+	REQUIRE(vm.arrays == 2);
+
+	// the sink packs whatever it is handed
+	RE::BSScript::Array array{ nullptr, std::vector<Variable>(3) };
+	RE::BSScript::array_sink sink{ array };
+	static_assert(std::output_iterator<RE::BSScript::array_sink, float>);
+	std::ranges::copy(std::array{ 1.0f, 2.0f, 3.0f }, sink);
+	REQUIRE(get<float>(array.elements[2]) == 3.0f);
+
+	// a moved container gives its elements up
+	std::vector<std::string> strings{ "a string too long for the small buffer" };
+	Variable var;
+	RE::BSScript::PackVariable(var, std::move(strings));
+	REQUIRE(static_cast<std::string_view>(get<RE::BSFixedString>(get<RE::BSScript::Array>(var)->elements[0])) == "a string too long for the small buffer"sv);
+}
+
+TEST_CASE("structure wrapper")
+{
+	Harness harness;
+	harness.define("Game#PluginInfo", { { "index"sv, 0 }, { "name"sv, 1 }, { "author"sv, 2 } });
+
+	PluginInfo info;
+	REQUIRE(info.insert("index"sv, 7));
+	REQUIRE(info.insert("Name"sv, 8));
+	REQUIRE_FALSE(info.insert("missing"sv, 9));
+	REQUIRE(info.find<std::int32_t>("INDEX"sv) == 7);
+	REQUIRE(member(info, 1) == 8);
+	REQUIRE_FALSE(info.find<std::int32_t>("missing"sv, true));
+
+	const PluginInfo::builder make{ "author"sv, "index"sv, "missing"sv };
+	std::vector<PluginInfo> infos;
+	for (std::int32_t i = 0; i < 100; ++i) {
+		infos.push_back(make(i, i * 2, i * 3));
+	}
+	REQUIRE(member(infos[10], 2) == 10);
+	REQUIRE(member(infos[10], 0) == 20);
+
+	// the vm reloads the type with its members moved around; nothing may write through the old indices
+	harness.define("Game#PluginInfo", { { "author"sv, 0 }, { "index"sv, 1 }, { "name"sv, 2 } });
+	PluginInfo reloaded;
+	REQUIRE(reloaded.insert("index"sv, 7));
+	REQUIRE(member(reloaded, 1) == 7);
+	REQUIRE(reloaded.find<std::int32_t>("index"sv) == 7);
+	REQUIRE(info.find<std::int32_t>("index"sv) == 7);
+
+	const auto after = make(1, 2, 3);
+	REQUIRE(member(after, 0) == 1);
+	REQUIRE(member(after, 1) == 2);
+}
+
+TEST_CASE("native function benchmark", "[.][benchmark]")
+{
+	Harness harness;
+	auto& vm = harness.vm;
+	const auto obj = "Test"sv;
+
+	vm.BindNativeMethod(obj, "Sum"sv, Sum);
+	vm.BindNativeMethod<Sum>(obj, "Sum"sv);
+	vm.BindNativeMethod(obj, "CopyValues"sv, CopyValues);
+	vm.BindNativeMethod<CopyValues>(obj, "CopyValues"sv);
+	vm.BindNativeMethod<ViewValues>(obj, "ViewValues"sv);
+
+	push(harness.stack, std::int32_t{ 1 }, 2.5f, true, std::uint32_t{ 4 });
+	harness.frame.size = 4;
+
+	BENCHMARK("arguments, std::function")
+	{
+		return harness.call(0);
+	};
+
+	BENCHMARK("arguments, thunk")
+	{
+		return harness.call(1);
+	};
+
+	harness.frame.size = 0;
+
+	BENCHMARK("vector return, std::function")
+	{
+		return harness.call(2);
+	};
+
+	BENCHMARK("vector return, thunk")
+	{
+		return harness.call(3);
+	};
+
+	BENCHMARK("span return, thunk")
+	{
+		return harness.call(4);
+	};
+
+	// what GetInstalledPlugins does for a few hundred plugins
+	harness.define("Game#PluginInfo", { { "index"sv, 0 }, { "name"sv, 1 }, { "author"sv, 2 }, { "description"sv, 3 } });
+
+	BENCHMARK("structure insert by name")
+	{
+		std::vector<PluginInfo> result;
+		for (std::int32_t i = 0; i < 500; ++i) {
+			auto& back = result.emplace_back();
+			back.insert("index"sv, i);
+			back.insert("name"sv, i);
+			back.insert("author"sv, i);
+			back.insert("description"sv, i);
+		}
+		return result;
+	};
+
+	BENCHMARK("structure builder")
+	{
+		const PluginInfo::builder make{ "index"sv, "name"sv, "author"sv, "description"sv };
+		std::vector<PluginInfo> result;
+		for (std::int32_t i = 0; i < 500; ++i) {
+			result.push_back(make(i, i, i, i));
+		}
+		return result;
+	};
+}
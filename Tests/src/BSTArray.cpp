@@ -0,0 +1,270 @@
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#define F4_HEAP_REDEFINE_NEW(...)
+
+#include "Heap.h"
+
+#include "RE/Bethesda/BSCore/BSTArray.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	// counts the moves the array makes, so the relocation paths can be told apart
+	class Tracked
+	{
+	public:
+		Tracked(int a_value) noexcept :
+			_value(a_value)
+		{
+			++live;
+		}
+
+		Tracked(const Tracked& a_rhs) noexcept :
+			_value(a_rhs._value)
+		{
+			++live;
+		}
+
+		Tracked(Tracked&& a_rhs) noexcept :
+			_value(a_rhs._value)
+		{
+			++live;
+			++moves;
+		}
+
+		~Tracked() { --live; }
+
+		Tracked& operator=(const Tracked&) = default;
+
+		Tracked& operator=(Tracked&& a_rhs) noexcept
+		{
+			_value = a_rhs._value;
+			++moves;
+			return *this;
+		}
+
+		[[nodiscard]] friend bool operator==(const Tracked& a_lhs, int a_rhs) noexcept { return a_lhs._value == a_rhs; }
+
+		static inline std::size_t live{ 0 };
+		static inline std::size_t moves{ 0 };
+
+	private:
+		int _value;
+	};
+
+	template <class T>
+	[[nodiscard]] std::vector<int> values(const RE::BSTArray<T>& a_array)
+	{
+		std::vector<int> result;
+		for (const auto& elem : a_array) {
+			if constexpr (std::same_as<T, int>) {
+				result.push_back(elem);
+			} else if constexpr (std::same_as<T, std::string>) {
+				result.push_back(std::stoi(elem));
+			}
+		}
+		return result;
+	}
+}
+
+static_assert(RE::is_trivially_relocatable_v<int*>);
+static_assert(RE::is_trivially_relocatable_v<RE::BSTArray<std::string>>);
+static_assert(!RE::is_trivially_relocatable_v<std::string>);
+
+TEST_CASE("BSTArray")
+{
+	SECTION("growth")
+	{
+		RE::heap_stats = {};
+		RE::BSTArray<int> array;
+		for (int i = 0; i < 1000; ++i) {
+			array.push_back(i);
+		}
+		REQUIRE(array.size() == 1000);
+		REQUIRE(std::ranges::equal(array, std::views::iota(0, 1000)));
+
+		// one fresh block, then every growth after it goes through realloc
+		REQUIRE(RE::heap_stats.allocations == 1);
+		REQUIRE(RE::heap_stats.reallocations < 20);
+
+		// pushing an element of the array onto itself, right as it grows
+		array.shrink_to_fit();
+		REQUIRE(array.capacity() == array.size());
+		array.push_back(array.front());
+		REQUIRE(array.back() == 0);
+	}
+
+	SECTION("non-trivial elements")
+	{
+		{
+			RE::BSTArray<Tracked> array;
+			for (int i = 0; i < 100; ++i) {
+				array.emplace_back(i);
+			}
+			array.emplace_back(array[50]);
+			REQUIRE(array.back() == 50);
+
+			array.erase(array.begin() + 10, array.begin() + 20);
+			REQUIRE(array.size() == 91);
+			REQUIRE(array[10] == 20);
+			REQUIRE(Tracked::live == 91);
+		}
+		REQUIRE(Tracked::live == 0);
+	}
+
+	SECTION("append range")
+	{
+		const std::vector<int> source{ 1, 2, 3, 4, 5, 6, 7, 8 };
+		RE::heap_stats = {};
+		RE::BSTArray<int> array;
+		array.append_range(source);
+		array.append_range(source);
+		REQUIRE(RE::heap_stats.allocations == 1);
+		REQUIRE(RE::heap_stats.reallocations == 1);
+		REQUIRE(array.size() == 16);
+
+		std::istringstream input{ "9 10 11" };
+		array.append_range(std::views::istream<int>(input));
+		REQUIRE(array.size() == 19);
+		REQUIRE(array.back() == 11);
+
+		RE::BSTArray<std::string> strings;
+		strings.append_range(std::vector<std::string>{ "1", "2", "3" });
+		strings.append_range(std::vector<std::string>{ "4", "5" });
+		REQUIRE(values(strings) == std::vector{ 1, 2, 3, 4, 5 });
+	}
+
+	SECTION("insert range")
+	{
+		const std::vector<int> source{ 10, 11, 12 };
+		RE::BSTArray<int> array{ 0, 1, 2, 3 };
+		auto it = array.insert_range(array.begin() + 2, source);
+		REQUIRE(*it == 10);
+		REQUIRE(values(array) == std::vector{ 0, 1, 10, 11, 12, 2, 3 });
+
+		it = array.insert(array.end(), source.begin(), source.end());
+		REQUIRE(it == array.end() - 3);
+		array.insert(array.begin(), source.begin(), source.begin());
+		REQUIRE(array.size() == 10);
+		REQUIRE(array.front() == 0);
+
+		RE::BSTArray<std::string> strings{ "0", "1", "2", "3" };
+		strings.insert_range(strings.begin() + 1, std::vector<std::string>{ "10", "11" });
+		REQUIRE(values(strings) == std::vector{ 0, 10, 11, 1, 2, 3 });
+
+		// erase hands back the element after the removed ones
+		REQUIRE(*strings.erase(strings.begin() + 1, strings.begin() + 3) == "1");
+		REQUIRE(values(strings) == std::vector{ 0, 1, 2, 3 });
+	}
+
+	SECTION("nested arrays relocate without moving")
+	{
+		RE::BSTArray<RE::BSTArray<Tracked>> arrays;
+		for (int i = 0; i < 16; ++i) {
+			arrays.emplace_back().emplace_back(i);
+		}
+
+		Tracked::moves = 0;
+		arrays.reserve(1000);
+		arrays.insert_range(arrays.begin(), std::views::iota(0, 0) | std::views::transform([](int) { return RE::BSTArray<Tracked>{}; }));
+		arrays.erase(arrays.begin());
+		REQUIRE(Tracked::moves == 0);
+		REQUIRE(arrays.size() == 15);
+		REQUIRE(arrays[0][0] == 1);
+	}
+
+	SECTION("insert range puts the tail back if a copy throws")
+	{
+		RE::BSTArray<RE::BSTArray<int>> arrays;
+		for (int i = 0; i < 4; ++i) {
+			arrays.emplace_back().push_back(i);
+		}
+
+		const auto copies = std::views::iota(0, 4) | std::views::transform([](int a_value) {
+			if (a_value == 2) {
+				throw std::runtime_error("copy failed");
+			}
+			return RE::BSTArray<int>{ a_value };
+		});
+		REQUIRE_THROWS(arrays.insert_range(arrays.begin() + 1, copies));
+		REQUIRE(arrays.size() == 4);
+		for (int i = 0; i < 4; ++i) {
+			REQUIRE(values(arrays[static_cast<std::uint32_t>(i)]) == std::vector{ i });
+		}
+	}
+}
+
+TEST_CASE("BSTArray benchmark", "[.][benchmark]")
+{
+	constexpr int count = 100'000;
+	const std::vector<int> source(count, 7);
+
+	BENCHMARK("push_back, std::vector")
+	{
+		std::vector<int> result;
+		for (int i = 0; i < count; ++i) {
+			result.push_back(i);
+		}
+		return result.size();
+	};
+
+	BENCHMARK("push_back, BSTArray")
+	{
+		RE::BSTArray<int> result;
+		for (int i = 0; i < count; ++i) {
+			result.push_back(i);
+		}
+		return result.size();
+	};
+
+	BENCHMARK("push_back strings, std::vector")
+	{
+		std::vector<std::string> result;
+		for (int i = 0; i < count / 10; ++i) {
+			result.emplace_back("a string too long for the small buffer");
+		}
+		return result.size();
+	};
+
+	BENCHMARK("push_back strings, BSTArray")
+	{
+		RE::BSTArray<std::string> result;
+		for (int i = 0; i < count / 10; ++i) {
+			result.emplace_back("a string too long for the small buffer");
+		}
+		return result.size();
+	};
+
+	BENCHMARK("append range x8, std::vector")
+	{
+		std::vector<int> result;
+		for (int i = 0; i < 8; ++i) {
+			result.insert(result.end(), source.begin(), source.end());
+		}
+		return result.size();
+	};
+
+	BENCHMARK("append range x8, BSTArray")
+	{
+		RE::BSTArray<int> result;
+		for (int i = 0; i < 8; ++i) {
+			result.append_range(source);
+		}
+		return result.size();
+	};
+
+	BENCHMARK("insert range at front, std::vector")
+	{
+		std::vector<int> result(count, 1);
+		result.insert(result.begin(), source.begin(), source.begin() + 100);
+		return result.size();
+	};
+
+	BENCHMARK("insert range at front, BSTArray")
+	{
+		RE::BSTArray<int> result(count, 1);
+		result.insert_range(result.begin(), std::span{ source }.first(100));
+		return result.size();
+	};
+}
@@ -1,10 +1,7 @@
+#include "Heap.h"
+
 namespace stl
 {
-	[[noreturn]] void report_and_fail(std::string_view a_msg)
-	{
-		throw std::runtime_error(std::string(a_msg));
-	}
-
 	template <class EF>                                    //
 	requires(std::invocable<std::remove_reference_t<EF>>)  //
 		class scope_exit
@@ -72,9 +69,6 @@ namespace stl
 
 namespace RE
 {
-	void* malloc(std::size_t a_bytes) { return new std::byte[a_bytes]; }
-	void free(void* a_ptr) { delete[] static_cast<std::byte*>(a_ptr); }
-
 	class ScrapHeap
 	{
 	public:
@@ -302,3 +296,105 @@ TEST_CASE("test scrap hash map")
 	evaluate<RE::BSTScrapHashMap<key_type, mapped_type>>(get2, make2, false);
 	evaluate<RE::BSTScrapHashMap<key_type, mapped_type, bad_hasher>>(get2, make2, false);
 }
+
+TEST_CASE("test find many")
+{
+	RE::BSTHashMap<key_type, mapped_type> map;
+	std::vector<key_type> keys;
+	for (char c = 'a'; c <= 'z'; ++c) {
+		keys.emplace_back(1, c);
+		keys.emplace_back(2, c);
+		map.emplace(keys.back(), static_cast<mapped_type>(c - 'a'));
+	}
+
+	SECTION("batches of every size match single finds")
+	{
+		for (std::size_t len = 0; len <= keys.size(); ++len) {
+			const std::span request{ keys.data(), len };
+			std::vector<decltype(map)::iterator> results(len);
+			std::array<std::uint64_t, 1> bits{ ~static_cast<std::uint64_t>(0) };
+
+			map.find_many(request, results);
+			for (std::size_t i = 0; i < len; ++i) {
+				REQUIRE(results[i] == map.find(request[i]));
+			}
+
+			REQUIRE(map.contains_many(request, bits) == len / 2);
+			for (std::size_t i = 0; i < len; ++i) {
+				REQUIRE(((bits[0] >> i) & 1) == (map.contains(request[i]) ? 1 : 0));
+			}
+		}
+	}
+
+	SECTION("a table with no storage misses every key")
+	{
+		const RE::BSTHashMap<key_type, mapped_type, bad_hasher> unallocated;
+		std::vector<decltype(unallocated)::const_iterator> results(keys.size());
+		unallocated.find_many(keys, results);
+		for (const auto& result : results) {
+			REQUIRE(result == unallocated.end());
+		}
+	}
+
+	SECTION("every key is found along one colliding chain")
+	{
+		RE::BSTHashMap<key_type, mapped_type, bad_hasher> collisions;
+		for (const auto& key : keys) {
+			collisions.emplace(key, 0);
+		}
+		std::vector<decltype(collisions)::iterator> results(keys.size());
+		collisions.find_many(keys, results);
+		for (std::size_t i = 0; i < keys.size(); ++i) {
+			REQUIRE(results[i] != collisions.end());
+			REQUIRE(results[i]->first == keys[i]);
+		}
+	}
+}
+
+TEST_CASE("find many benchmark", "[.][benchmark]")
+{
+	using map_t = RE::BSTHashMap<std::uint32_t, std::uint32_t>;
+
+	std::mt19937 rng{ 0x0001'4F2A };
+	for (const std::uint32_t size : { 10'000u, 100'000u, 1'000'000u }) {
+		map_t map;
+		map.reserve(size);
+		std::vector<std::uint32_t> keys;
+		keys.reserve(size);
+		while (map.size() < size) {
+			const auto key = static_cast<std::uint32_t>(rng());
+			if (map.emplace(key, key).second) {
+				keys.push_back(key);
+			}
+		}
+
+		// half hits, half misses, in random order
+		std::vector<std::uint32_t> queries(0x1000);
+		for (std::size_t i = 0; i < queries.size(); ++i) {
+			queries[i] = i % 2 == 0 ? keys[rng() % keys.size()] : static_cast<std::uint32_t>(rng());
+		}
+
+		std::vector<map_t::const_iterator> results(queries.size());
+		std::vector<std::uint64_t> bits((queries.size() + 63) / 64);
+		const auto& cmap = map;
+
+		BENCHMARK("find, "s + std::to_string(size) + " entries")
+		{
+			for (std::size_t i = 0; i < queries.size(); ++i) {
+				results[i] = cmap.find(queries[i]);
+			}
+			return results.back();
+		};
+
+		BENCHMARK("find_many, "s + std::to_string(size) + " entries")
+		{
+			cmap.find_many(queries, results);
+			return results.back();
+		};
+
+		BENCHMARK("contains_many, "s + std::to_string(size) + " entries")
+		{
+			return cmap.contains_many(queries, bits);
+		};
+	}
+}
@@ -0,0 +1,135 @@
+#include "RE/Bethesda/CRC.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	// the byte at a time walk every engine has to agree with
+	[[nodiscard]] std::uint32_t reference(std::span<const std::uint8_t> a_data) noexcept
+	{
+		return RE::detail::CRC32::update_bytes(0, a_data);
+	}
+
+	[[nodiscard]] std::vector<std::uint8_t> random_bytes(std::mt19937_64& a_rng, std::size_t a_size)
+	{
+		std::uniform_int_distribution<unsigned int> dist{ 0, 0xFF };
+		std::vector<std::uint8_t> result(a_size);
+		for (auto& byte : result) {
+			byte = static_cast<std::uint8_t>(dist(a_rng));
+		}
+		return result;
+	}
+}
+
+TEST_CASE("crc32")
+{
+	constexpr std::array<std::uint8_t, 9> digits{ '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+	static_assert(RE::detail::GenerateCRC32(digits) == 0x2DFD2D88);
+	REQUIRE(RE::detail::GenerateCRC32(digits) == 0x2DFD2D88);
+	REQUIRE(RE::detail::GenerateCRC32({}) == 0);
+
+	std::mt19937_64 rng{ 0xC0FFEE };
+
+	SECTION("fixed width keys")
+	{
+		for (std::size_t i = 0; i < 0x10000; ++i) {
+			const auto key = rng();
+			const auto key4 = static_cast<std::uint32_t>(key);
+			REQUIRE(RE::BSCRC32<std::uint64_t>()(key) == reference({ reinterpret_cast<const std::uint8_t*>(std::addressof(key)), sizeof(key) }));
+			REQUIRE(RE::BSCRC32<std::uint32_t>()(key4) == reference({ reinterpret_cast<const std::uint8_t*>(std::addressof(key4)), sizeof(key4) }));
+		}
+
+		const auto ptr = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(0x1'4000'1234));
+		REQUIRE(RE::BSCRC32<const void*>()(ptr) == RE::BSCRC32<std::uintptr_t>()(0x1'4000'1234));
+		REQUIRE(RE::BSCRC32<std::nullptr_t>()(nullptr) == RE::BSCRC32<std::uint64_t>()(0));
+		REQUIRE(RE::BSCRC32<std::uint16_t>()(0x3231) == reference(std::span{ digits }.first(2)));
+	}
+
+	SECTION("every length and alignment")
+	{
+		const auto data = random_bytes(rng, 0x1000 + 16);
+		for (std::size_t offset = 0; offset < 16; ++offset) {
+			for (std::size_t len = 0; len <= 0x400; ++len) {
+				const std::span bytes{ data.data() + offset, len };
+				REQUIRE(RE::detail::GenerateCRC32(bytes) == reference(bytes));
+			}
+		}
+	}
+
+	SECTION("engines")
+	{
+		for (std::size_t i = 0; i < 0x100; ++i) {
+			const auto len = std::uniform_int_distribution<std::size_t>{ 64, 0x10000 }(rng);
+			const auto data = random_bytes(rng, len);
+			const auto seed = static_cast<std::uint32_t>(rng());
+			const auto expected = RE::detail::CRC32::update_bytes(seed, data);
+			REQUIRE(RE::detail::CRC32::update_slice16(seed, data) == expected);
+			REQUIRE(RE::detail::CRC32::update(seed, data) == expected);
+#if defined(_M_X64) || defined(__x86_64__)
+			if (RE::detail::CRC32::has_clmul()) {
+				const auto size = data.size() & ~static_cast<std::size_t>(15);
+				const std::span bytes{ data };
+				const auto folded = RE::detail::CRC32::update_clmul(seed, bytes.first(size));
+				REQUIRE(RE::detail::CRC32::update_bytes(folded, bytes.subspan(size)) == expected);
+			}
+#endif
+		}
+	}
+
+	SECTION("string views")
+	{
+		REQUIRE(RE::BSCRC32<std::string_view>()("123456789"sv) == 0x2DFD2D88);
+		const auto wide = L"123456789"sv;
+		REQUIRE(RE::BSCRC32<std::wstring_view>()(wide) == reference({ reinterpret_cast<const std::uint8_t*>(wide.data()), wide.size() * sizeof(wchar_t) }));
+	}
+
+	SECTION("lower case")
+	{
+		// longer than the buffer, so it is hashed in pieces
+		std::string name;
+		for (std::size_t i = 0; i < 0x90; ++i) {
+			name += static_cast<char>("AbCdEfGhIj.ESM"[i % 14]);
+		}
+		std::string lowered;
+		std::ranges::transform(name, std::back_inserter(lowered), [](char a_char) {
+			return static_cast<char>(std::tolower(static_cast<unsigned char>(a_char)));
+		});
+		for (std::size_t len = 0; len <= name.size(); ++len) {
+			REQUIRE(RE::detail::CRC32::update_lower(0, std::string_view{ name }.substr(0, len)) ==
+					reference({ reinterpret_cast<const std::uint8_t*>(lowered.data()), len }));
+		}
+	}
+}
+
+TEST_CASE("crc32 benchmark", "[.][benchmark]")
+{
+	std::mt19937_64 rng{ 0xC0FFEE };
+	const auto keys = [&]() {
+		std::vector<std::uint64_t> result(0x1000);
+		std::generate(result.begin(), result.end(), std::ref(rng));
+		return result;
+	}();
+	const auto data = random_bytes(rng, 0x10000);
+
+	BENCHMARK("keys, byte at a time")
+	{
+		std::uint32_t result = 0;
+		for (const auto key : keys) {
+			result ^= reference({ reinterpret_cast<const std::uint8_t*>(std::addressof(key)), sizeof(key) });
+		}
+		return result;
+	};
+
+	BENCHMARK("keys, unrolled")
+	{
+		std::uint32_t result = 0;
+		for (const auto key : keys) {
+			result ^= RE::BSCRC32<std::uint64_t>()(key);
+		}
+		return result;
+	};
+
+	BENCHMARK("64KiB, byte at a time") { return reference(data); };
+	BENCHMARK("64KiB, slice by 16") { return RE::detail::CRC32::update_slice16(0, data); };
+	BENCHMARK("64KiB, dispatched") { return RE::detail::GenerateCRC32(data); };
+}
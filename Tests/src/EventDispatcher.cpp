@@ -0,0 +1,173 @@
+namespace RE
+{
+	enum class BSEventNotifyControl : std::int32_t
+	{
+		kContinue,
+		kStop
+	};
+
+	template <class>
+	class BSTEventSource;
+
+	template <class Event>
+	class BSTEventSink
+	{
+	public:
+		virtual ~BSTEventSink() = default;
+
+		virtual BSEventNotifyControl ProcessEvent(const Event& a_event, BSTEventSource<Event>* a_source) = 0;
+	};
+
+	// the game's source without its lock and pending lists, which is all the dispatcher touches
+	template <class Event>
+	class BSTEventSource
+	{
+	public:
+		void Notify(const Event& a_event)
+		{
+			for (const auto sink : std::vector{ _sinks }) {
+				if (sink->ProcessEvent(a_event, this) == BSEventNotifyControl::kStop) {
+					break;
+				}
+			}
+		}
+
+		void RegisterSink(BSTEventSink<Event>* a_sink) { _sinks.push_back(a_sink); }
+		void UnregisterSink(BSTEventSink<Event>* a_sink) { std::erase(_sinks, a_sink); }
+
+		[[nodiscard]] std::size_t size() const noexcept { return _sinks.size(); }
+
+	private:
+		std::vector<BSTEventSink<Event>*> _sinks;
+	};
+}
+
+#include "RE/Bethesda/EventDispatcher.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	struct HitEvent
+	{
+	public:
+		// members
+		std::uint32_t target;
+		std::uint8_t formType;
+	};
+
+	using dispatcher_t = RE::EventDispatcher<HitEvent>;
+
+	constexpr std::uint32_t PLAYER = 0x14;
+	constexpr std::uint8_t WEAPON = 43;
+}
+
+TEST_CASE("event dispatcher")
+{
+	RE::BSTEventSource<HitEvent> source;
+	std::vector<std::string> seen;
+	{
+		dispatcher_t dispatcher{ std::addressof(source) };
+		REQUIRE(source.size() == 1);
+		REQUIRE(dispatcher.empty());
+		source.Notify({ PLAYER, WEAPON });
+
+		const auto all = dispatcher.Subscribe([&](const HitEvent&) { seen.push_back("all"); });
+		const auto player = dispatcher.Subscribe(
+			[&](const HitEvent&) { seen.push_back("player"); },
+			[](const HitEvent& a_event) { return a_event.target == PLAYER; });
+		const auto weapon = dispatcher.Subscribe(
+			[&](const HitEvent&) {
+				seen.push_back("weapon");
+				return RE::BSEventNotifyControl::kStop;
+			},
+			[](const HitEvent& a_event) { return a_event.formType == WEAPON; });
+		const auto last = dispatcher.Subscribe([&](const HitEvent&) { seen.push_back("last"); });
+		REQUIRE(dispatcher.size() == 4);
+		REQUIRE(source.size() == 1);
+
+		source.Notify({ PLAYER, WEAPON });
+		REQUIRE(seen == std::vector<std::string>{ "all", "player", "weapon" });
+
+		seen.clear();
+		source.Notify({ 0x0001'0000, 0 });
+		REQUIRE(seen == std::vector<std::string>{ "all", "last" });
+
+		const auto stats = dispatcher.GetStats();
+		REQUIRE(stats.size() == 4);
+		REQUIRE(stats[0].handle == all);
+		REQUIRE(stats[0].calls == 2);
+		REQUIRE(stats[1].calls == 1);
+		REQUIRE(stats[1].filtered == 1);
+		REQUIRE(stats[2].calls == 1);
+		REQUIRE(stats[3].calls == 1);
+		REQUIRE(stats[3].filtered == 0);
+		REQUIRE(stats[0].max <= stats[0].total);
+
+		dispatcher.ResetStats();
+		REQUIRE(dispatcher.GetStats()[0].calls == 0);
+
+		REQUIRE(dispatcher.Unsubscribe(weapon));
+		REQUIRE_FALSE(dispatcher.Unsubscribe(weapon));
+		REQUIRE_FALSE(dispatcher.Unsubscribe(dispatcher_t::INVALID_HANDLE));
+		seen.clear();
+		source.Notify({ PLAYER, WEAPON });
+		REQUIRE(seen == std::vector<std::string>{ "all", "player", "last" });
+
+		// a listener can drop itself mid dispatch; the snapshot being walked still holds it
+		dispatcher_t::handle_type once = dispatcher_t::INVALID_HANDLE;
+		once = dispatcher.Subscribe([&](const HitEvent&) {
+			seen.push_back("once");
+			dispatcher.Unsubscribe(once);
+		});
+		seen.clear();
+		source.Notify({ 0, 0 });
+		source.Notify({ 0, 0 });
+		REQUIRE(seen == std::vector<std::string>{ "all", "last", "once", "all", "last" });
+
+		REQUIRE(dispatcher.Unsubscribe(player));
+		REQUIRE(dispatcher.Unsubscribe(last));
+		REQUIRE(dispatcher.size() == 1);
+	}
+	REQUIRE(source.size() == 0);
+}
+
+TEST_CASE("event dispatcher concurrent subscribers")
+{
+	RE::BSTEventSource<HitEvent> source;
+	dispatcher_t dispatcher{ std::addressof(source) };
+
+	std::atomic_uint64_t pinned{ 0 };
+	dispatcher.Subscribe([&](const HitEvent&) { ++pinned; });
+
+	// listeners come and go under a running dispatch, which must never lose the one that stays
+	std::atomic_bool done{ false };
+	std::uint64_t events = 0;
+	std::jthread notifier{ [&]() {
+		while (!done.load()) {
+			source.Notify({ PLAYER, WEAPON });
+			++events;
+		}
+	} };
+
+	std::atomic_size_t failures{ 0 };
+	std::vector<std::jthread> writers;
+	for (std::size_t i = 0; i < 2; ++i) {
+		writers.emplace_back([&]() {
+			for (std::size_t j = 0; j < 1000; ++j) {
+				const auto handle = dispatcher.Subscribe([](const HitEvent&) {});
+				if (!dispatcher.Unsubscribe(handle)) {
+					++failures;
+				}
+			}
+		});
+	}
+	writers.clear();
+	done = true;
+	notifier.join();
+
+	REQUIRE(failures == 0);
+	REQUIRE(dispatcher.size() == 1);
+	REQUIRE(pinned == events);
+	REQUIRE(dispatcher.GetStats()[0].calls == events);
+}
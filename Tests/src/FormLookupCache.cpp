@@ -0,0 +1,130 @@
+#include "RE/Bethesda/FormLookupCache.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	struct Form
+	{
+	public:
+		// members
+		std::uint32_t formID;
+		std::string editorID;
+	};
+
+	using cache_t = RE::detail::FormCache<Form>;
+
+	[[nodiscard]] std::vector<Form> make_forms(std::uint32_t a_first, std::size_t a_count)
+	{
+		std::vector<Form> forms;
+		forms.reserve(a_count);
+		for (std::size_t i = 0; i < a_count; ++i) {
+			const auto formID = a_first + static_cast<std::uint32_t>(i);
+			forms.push_back({ formID, "Form"s + std::to_string(formID) });
+		}
+		return forms;
+	}
+
+	[[nodiscard]] std::unique_ptr<cache_t::snapshot_type> make_snapshot(std::vector<Form>& a_forms)
+	{
+		auto snapshot = std::make_unique<cache_t::snapshot_type>(a_forms.size(), a_forms.size());
+		for (auto& form : a_forms) {
+			REQUIRE(snapshot->ids.insert(form.formID, std::addressof(form)));
+			REQUIRE(snapshot->editorIDs.insert(form.editorID, std::addressof(form)));
+		}
+		return snapshot;
+	}
+}
+
+TEST_CASE("form lookup cache")
+{
+	auto forms = make_forms(0x0001'0000, 1000);
+	cache_t cache;
+	REQUIRE(!cache.IsBuilt());
+	REQUIRE(cache.Find(forms[0].formID) == nullptr);
+
+	cache.Publish(make_snapshot(forms));
+	REQUIRE(cache.IsBuilt());
+	for (auto& form : forms) {
+		REQUIRE(cache.Find(form.formID) == std::addressof(form));
+		REQUIRE(cache.Find(form.editorID) == std::addressof(form));
+	}
+
+	// editor ids ignore case, like the game's
+	REQUIRE(cache.Find("FORM65536"sv) == std::addressof(forms[0]));
+	REQUIRE(cache.Find("form65536"sv) == std::addressof(forms[0]));
+	REQUIRE(cache.Find("Form"sv) == nullptr);
+	REQUIRE(cache.Find(0x0002'0000u) == nullptr);
+
+	const auto stats = cache.GetStats();
+	REQUIRE(stats.hits == forms.size() * 2 + 2);
+	REQUIRE(stats.misses == 3);
+	cache.ResetStats();
+	REQUIRE(cache.GetStats().hits == 0);
+
+	// deleting clears the value but keeps the key, and creating it again reuses the slot
+	cache.Erase(forms[1].formID, forms[1].editorID);
+	REQUIRE(cache.Find(forms[1].formID) == nullptr);
+	REQUIRE(cache.Find(forms[1].editorID) == nullptr);
+	REQUIRE(cache.Find(forms[2].formID) == std::addressof(forms[2]));
+	cache.Insert(forms[1].formID, forms[1].editorID, std::addressof(forms[1]));
+	REQUIRE(cache.Find(forms[1].formID) == std::addressof(forms[1]));
+
+	// enough new forms to outgrow the snapshot
+	auto created = make_forms(0xFF00'0000, 2000);
+	for (auto& form : created) {
+		cache.Insert(form.formID, form.editorID, std::addressof(form));
+	}
+	for (auto& form : forms) {
+		REQUIRE(cache.Find(form.formID) == std::addressof(form));
+	}
+	for (auto& form : created) {
+		REQUIRE(cache.Find(form.formID) == std::addressof(form));
+		REQUIRE(cache.Find(form.editorID) == std::addressof(form));
+	}
+
+	cache.Invalidate();
+	REQUIRE(!cache.IsBuilt());
+	REQUIRE(cache.Find(forms[0].formID) == nullptr);
+}
+
+TEST_CASE("form lookup cache readers")
+{
+	auto forms = make_forms(0x0001'0000, 1000);
+	auto created = make_forms(0xFF00'0000, 4000);
+	cache_t cache;
+	cache.Publish(make_snapshot(forms));
+
+	// readers only ever see the right form, or a miss for one not inserted yet
+	std::atomic_bool done{ false };
+	std::atomic_size_t failures{ 0 };
+	std::vector<std::jthread> readers;
+	for (std::size_t i = 0; i < 4; ++i) {
+		readers.emplace_back([&, i]() {
+			std::size_t n = i;
+			while (!done.load()) {
+				const auto& form = forms[n % forms.size()];
+				if (cache.Find(form.formID) != std::addressof(form)) {
+					++failures;
+				}
+				const auto& maybe = created[n % created.size()];
+				if (const auto found = cache.Find(maybe.formID); found && found != std::addressof(maybe)) {
+					++failures;
+				}
+				n += 7;
+			}
+		});
+	}
+
+	for (std::size_t i = 0; i < created.size(); ++i) {
+		cache.Insert(created[i].formID, created[i].editorID, std::addressof(created[i]));
+		if (i % 1000 == 999) {
+			cache.Publish(make_snapshot(forms));
+		}
+	}
+	done = true;
+	readers.clear();
+
+	REQUIRE(failures == 0);
+	REQUIRE(cache.GetStats().hits > 0);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// stands in for the game's heap, which RE/Bethesda/MemoryManager.h forwards to. every suite that allocates through
+// it shares this one set, so they can all be linked into the one executable
+namespace stl
+{
+	// allocation failures are reported through the library, which the container suites do not link
+	[[noreturn]] inline void report_and_fail(std::string_view a_msg)
+	{
+		throw std::runtime_error(std::string(a_msg));
+	}
+}
+
+namespace RE
+{
+	struct heap_stats_t
+	{
+	public:
+		// members
+		std::size_t allocations{ 0 };
+		std::size_t reallocations{ 0 };
+	};
+
+	inline heap_stats_t heap_stats;
+
+	inline void* malloc(std::size_t a_bytes)
+	{
+		++heap_stats.allocations;
+		return std::malloc(a_bytes);
+	}
+
+	inline void* realloc(void* a_ptr, std::size_t a_bytes)
+	{
+		++heap_stats.reallocations;
+		return std::realloc(a_ptr, a_bytes);
+	}
+
+	inline void free(void* a_ptr) { std::free(a_ptr); }
+}
@@ -0,0 +1,157 @@
+// patches pages through the library's mprotect protector, so this suite only runs on linux
+#ifdef __linux__
+
+#	include "Stubs.h"
+
+#	include <sys/mman.h>
+#	include <unistd.h>
+
+#	include <catch2/catch_all.hpp>
+
+namespace
+{
+	// counts the calls a transaction makes through the library's protector
+	class CountingPageProtector final :
+		public REL::MprotectPageProtector
+	{
+	public:
+		[[nodiscard]] std::size_t unprotect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t& a_old) override
+		{
+			++unprotects;
+			return MprotectPageProtector::unprotect(a_address, a_size, a_old);
+		}
+
+		[[nodiscard]] bool protect(std::uintptr_t a_address, std::size_t a_size, std::uint32_t a_protection) override
+		{
+			++protects;
+			return MprotectPageProtector::protect(a_address, a_size, a_protection);
+		}
+
+		void flush(std::uintptr_t a_address, std::size_t a_size) noexcept override
+		{
+			++flushes;
+			MprotectPageProtector::flush(a_address, a_size);
+		}
+
+		std::size_t unprotects{ 0 };
+		std::size_t protects{ 0 };
+		std::size_t flushes{ 0 };
+	};
+
+	// one "mov eax, imm32; ret" at the start of every page, mapped read and execute only
+	class CodeBuffer
+	{
+	public:
+		explicit CodeBuffer(std::size_t a_pages) :
+			_pages(a_pages)
+		{
+			const auto mem = ::mmap(nullptr, size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			REQUIRE(mem != MAP_FAILED);
+			_data = static_cast<std::uint8_t*>(mem);
+
+			for (std::size_t i = 0; i < _pages; ++i) {
+				const auto value = static_cast<std::uint32_t>(i + 1);
+				_data[i * page()] = 0xB8;
+				std::memcpy(_data + i * page() + 1, std::addressof(value), sizeof(value));
+				_data[i * page() + 5] = REL::RET;
+			}
+			REQUIRE(::mprotect(_data, size(), PROT_READ | PROT_EXEC) == 0);
+		}
+
+		CodeBuffer(const CodeBuffer&) = delete;
+
+		~CodeBuffer() { ::munmap(_data, size()); }
+
+		CodeBuffer& operator=(const CodeBuffer&) = delete;
+
+		[[nodiscard]] std::uintptr_t address(std::size_t a_page) const noexcept { return reinterpret_cast<std::uintptr_t>(_data + a_page * page()); }
+		[[nodiscard]] std::uintptr_t immediate(std::size_t a_page) const noexcept { return address(a_page) + 1; }
+		[[nodiscard]] std::uint32_t protection(std::size_t a_page) const { return REL::MprotectPageProtector::find(address(a_page))->protection; }
+		[[nodiscard]] std::size_t size() const noexcept { return _pages * page(); }
+
+		[[nodiscard]] int run(std::size_t a_page) const { return reinterpret_cast<int (*)()>(address(a_page))(); }
+
+		[[nodiscard]] static std::size_t page() noexcept { return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)); }
+
+	private:
+		std::size_t _pages;
+		std::uint8_t* _data{ nullptr };
+	};
+}
+
+TEST_CASE("patch transaction")
+{
+	const CodeBuffer code{ 4 };
+	REQUIRE(code.run(0) == 1);
+	REQUIRE(code.run(3) == 4);
+
+	CountingPageProtector protector;
+	REL::PatchTransaction patch{ protector };
+	REQUIRE(REL::PatchTransaction::current() == std::addressof(patch));
+
+	// pages 0 and 1 form one run, page 3 another
+	patch.write(code.immediate(0), std::uint32_t{ 10 });
+	patch.write(code.immediate(1), std::uint32_t{ 20 });
+	patch.write(code.immediate(3), std::uint32_t{ 40 });
+	REL::safe_write(code.immediate(1), std::uint32_t{ 21 });
+	REL::safe_fill(code.immediate(3), 0, sizeof(std::uint32_t));
+	REQUIRE(patch.size() == 5);
+	REQUIRE(code.run(1) == 2);
+
+	REQUIRE(patch.commit());
+	REQUIRE(patch.empty());
+	REQUIRE(protector.unprotects == 2);
+	REQUIRE(protector.protects == 2);
+	REQUIRE(protector.flushes == 1);
+
+	REQUIRE(code.run(0) == 10);
+	REQUIRE(code.run(1) == 21);
+	REQUIRE(code.run(2) == 3);
+	REQUIRE(code.run(3) == 0);
+	for (std::size_t i = 0; i < 4; ++i) {
+		REQUIRE(code.protection(i) == (PROT_READ | PROT_EXEC));
+	}
+
+	// pages whose protection differs are restored separately
+	REQUIRE(::mprotect(reinterpret_cast<void*>(code.address(2)), code.page(), PROT_READ) == 0);
+	patch.write(code.immediate(1), std::uint32_t{ 22 });
+	patch.write(code.immediate(2), std::uint32_t{ 32 });
+	REQUIRE(patch.commit());
+	REQUIRE(protector.unprotects == 4);
+	REQUIRE(protector.protects == 4);
+	REQUIRE(code.protection(1) == (PROT_READ | PROT_EXEC));
+	REQUIRE(code.protection(2) == PROT_READ);
+	REQUIRE(code.run(1) == 22);
+	REQUIRE(*reinterpret_cast<const std::uint32_t*>(code.immediate(2)) == 32);
+}
+
+TEST_CASE("patch transaction failure")
+{
+	const CodeBuffer code{ 2 };
+	CountingPageProtector protector;
+
+	{
+		REL::PatchTransaction patch{ protector };
+
+		// a write to an unmapped page fails the whole transaction
+		REQUIRE(::munmap(reinterpret_cast<void*>(code.address(1)), code.page()) == 0);
+		patch.write(code.immediate(0), std::uint32_t{ 10 });
+		patch.write(code.immediate(1), std::uint32_t{ 20 });
+		REQUIRE_FALSE(patch.commit());
+		REQUIRE(patch.empty());
+		REQUIRE(code.run(0) == 1);
+		REQUIRE(code.protection(0) == (PROT_READ | PROT_EXEC));
+
+		// a nested transaction commits on its own, when it closes
+		{
+			REL::PatchTransaction inner{ protector };
+			REL::safe_write(code.immediate(0), std::uint32_t{ 11 });
+			REQUIRE(inner.size() == 1);
+			REQUIRE(patch.empty());
+		}
+		REQUIRE(REL::PatchTransaction::current() == std::addressof(patch));
+		REQUIRE(code.run(0) == 11);
+	}
+	REQUIRE(REL::PatchTransaction::current() == nullptr);
+}
+#endif
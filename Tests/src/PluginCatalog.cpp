@@ -0,0 +1,132 @@
+#include "RE/Bethesda/PluginCatalog.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	struct File
+	{
+	public:
+		explicit File(std::string_view a_name)
+		{
+			std::ranges::copy(a_name, filename);
+		}
+
+		// members
+		char filename[260]{};
+		std::uint32_t masterCount{ 0 };
+		File** masterPtrs{ nullptr };
+	};
+
+	using catalog_t = RE::detail::BasicPluginCatalog<File>;
+
+	// a load order of a_count plugins, each built against every one of the first a_masters before it
+	class LoadOrder
+	{
+	public:
+		LoadOrder(std::size_t a_count, std::size_t a_masters)
+		{
+			for (std::size_t i = 0; i < a_count; ++i) {
+				files.push_back(std::make_unique<File>("Plugin" + std::to_string(i) + ".esp"));
+			}
+
+			pointers.reserve(a_count);
+			for (const auto& file : files) {
+				pointers.push_back(file.get());
+			}
+
+			for (std::size_t i = 0; i < a_count; ++i) {
+				files[i]->masterPtrs = pointers.data();
+				files[i]->masterCount = static_cast<std::uint32_t>((std::min)(i, a_masters));
+			}
+		}
+
+		// the scan the natives did before, for comparison
+		[[nodiscard]] std::span<File*> scan(std::string_view a_name) const
+		{
+			for (const auto file : pointers) {
+				if (a_name.size() == std::strlen(file->filename) &&
+					std::ranges::equal(a_name, std::string_view{ file->filename }, [](char a_lhs, char a_rhs) {
+						return std::tolower(static_cast<unsigned char>(a_lhs)) == std::tolower(static_cast<unsigned char>(a_rhs));
+					})) {
+					return { file->masterPtrs, file->masterCount };
+				}
+			}
+			return {};
+		}
+
+		// members
+		std::vector<std::unique_ptr<File>> files;
+		std::vector<File*> pointers;
+	};
+}
+
+TEST_CASE("plugin catalog")
+{
+	File fallout{ "Fallout4.esm" };
+	File dlc{ "DLCRobot.esm" };
+	std::array<File*, 3> masters{ std::addressof(fallout), nullptr, std::addressof(dlc) };
+	File patch{ "Patch.esp" };
+	patch.masterPtrs = masters.data();
+	patch.masterCount = static_cast<std::uint32_t>(masters.size());
+	File light{ "Light.esl" };
+	light.masterPtrs = masters.data();
+	light.masterCount = 1;
+
+	const std::array<File*, 3> files{ std::addressof(fallout), std::addressof(dlc), std::addressof(patch) };
+	const std::array<File*, 1> lightFiles{ std::addressof(light) };
+	const catalog_t catalog{ files, lightFiles, 1 };
+
+	REQUIRE(catalog.size() == 4);
+	REQUIRE(catalog.files().size() == 3);
+	REQUIRE(catalog.light_files().front() == std::addressof(light));
+	REQUIRE(catalog.find("fallout4.ESM"sv) == std::addressof(fallout));
+	REQUIRE(catalog.find("Light.esl"sv) == std::addressof(light));
+	REQUIRE(catalog.find("Missing.esm"sv) == nullptr);
+	REQUIRE(catalog.find("Fallout4.es"sv) == nullptr);
+
+	// unresolved masters are left out
+	const auto patchMasters = catalog.masters("PATCH.esp"sv);
+	REQUIRE(std::ranges::equal(patchMasters, std::array{ std::addressof(fallout), std::addressof(dlc) }));
+	REQUIRE(catalog.masters("Light.esl"sv).size() == 1);
+	REQUIRE(catalog.masters("Fallout4.esm"sv).empty());
+	REQUIRE(catalog.masters("Missing.esm"sv).empty());
+
+	// against the scan, over a long load order
+	const LoadOrder order{ 300, 8 };
+	const catalog_t large{ order.pointers, {}, 2 };
+	REQUIRE(large.generation() == 2);
+	for (std::size_t i = 0; i < order.files.size(); i += 7) {
+		const auto name = "plugin" + std::to_string(i) + ".ESP";
+		REQUIRE(large.find(name) == order.files[i].get());
+		REQUIRE(std::ranges::equal(large.masters(name), order.scan(name)));
+	}
+}
+
+TEST_CASE("plugin catalog benchmark", "[.][benchmark]")
+{
+	const LoadOrder order{ 300, 8 };
+	const catalog_t catalog{ order.pointers, {}, 1 };
+	std::vector<std::string> names;
+	for (std::size_t i = 0; i < order.files.size(); i += 3) {
+		names.push_back("Plugin" + std::to_string(i) + ".esp");
+	}
+
+	BENCHMARK("masters by scan")
+	{
+		std::size_t count = 0;
+		for (const auto& name : names) {
+			count += order.scan(name).size();
+		}
+		return count;
+	};
+
+	BENCHMARK("masters by catalog")
+	{
+		std::size_t count = 0;
+		for (const auto& name : names) {
+			count += catalog.masters(name).size();
+		}
+		return count;
+	};
+}
@@ -0,0 +1,343 @@
+#include "RE/RTTICache.h"
+
+#include <catch2/catch_all.hpp>
+#include <fmt/format.h>
+
+namespace
+{
+	// the msvc rtti of a set of classes, laid out in an image as the compiler would: every class derives from a
+	// chain of a_depth shared bases, then from a mixin of its own which sits at MIXIN
+	class SyntheticRTTI
+	{
+	public:
+		static constexpr std::int32_t MIXIN = 0x10;
+
+		struct TypeDescriptor
+		{
+		public:
+			// members
+			const void* vtable;
+			void* spare;
+			char name[0x20];
+		};
+
+		struct BaseClassDescriptor
+		{
+		public:
+			// members
+			std::uint32_t typeDescriptor;
+			std::uint32_t numContainedBases;
+			std::int32_t mDisp;
+			std::int32_t pDisp;
+			std::int32_t vDisp;
+			std::uint32_t attributes;
+		};
+		static_assert(sizeof(BaseClassDescriptor) == 0x18);
+
+		struct ClassHierarchyDescriptor
+		{
+		public:
+			// members
+			std::uint32_t signature;
+			std::uint32_t attributes;
+			std::uint32_t numBaseClasses;
+			std::uint32_t baseClassArray;
+		};
+		static_assert(sizeof(ClassHierarchyDescriptor) == 0x10);
+
+		struct CompleteObjectLocator
+		{
+		public:
+			// members
+			std::uint32_t signature;
+			std::uint32_t offset;
+			std::uint32_t ctorDispOffset;
+			std::uint32_t typeDescriptor;
+			std::uint32_t classDescriptor;
+			std::uint32_t self;
+		};
+		static_assert(sizeof(CompleteObjectLocator) == 0x18);
+
+		struct Object
+		{
+		public:
+			// members
+			const void* vfptr;
+			std::uint64_t pad;
+			const void* mixin;
+			std::uint64_t data;
+		};
+		static_assert(offsetof(Object, mixin) == MIXIN);
+
+		SyntheticRTTI(std::size_t a_classes, std::size_t a_depth) :
+			_image(0x100000)
+		{
+			std::vector<std::uint32_t> shared;
+			for (std::size_t i = 0; i < a_depth; ++i) {
+				shared.push_back(type_descriptor(fmt::format(".?AVShared{}@@", i)));
+			}
+
+			for (std::size_t i = 0; i < a_classes; ++i) {
+				const auto self = type_descriptor(fmt::format(".?AVClass{}@@", i));
+				const auto mixin = type_descriptor(fmt::format(".?AVMixin{}@@", i));
+
+				// the class itself, then its bases from the most derived down
+				std::vector<std::uint32_t> bases;
+				bases.push_back(base_class(self, a_depth + 1, 0));
+				for (std::size_t j = a_depth; j-- > 0;) {
+					bases.push_back(base_class(shared[j], static_cast<std::uint32_t>(j), 0));
+				}
+				bases.push_back(base_class(mixin, 0, MIXIN));
+
+				const auto array = allocate(bases.size() * sizeof(std::uint32_t), alignof(std::uint32_t));
+				std::ranges::copy(bases, at<std::uint32_t>(array));
+				const auto hierarchy = allocate(sizeof(ClassHierarchyDescriptor), alignof(ClassHierarchyDescriptor));
+				*at<ClassHierarchyDescriptor>(hierarchy) = { 0, 1, static_cast<std::uint32_t>(bases.size()), array };
+
+				_classes.push_back({ virtual_table(self, hierarchy, 0), virtual_table(self, hierarchy, MIXIN) });
+				_targets.push_back(at<TypeDescriptor>(mixin));
+			}
+
+			for (const auto base : shared) {
+				_targets.push_back(at<TypeDescriptor>(base));
+			}
+		}
+
+		[[nodiscard]] Object make_object(std::size_t a_class) const noexcept
+		{
+			const auto& [primary, mixin] = _classes[a_class];
+			return { primary, 0, mixin, a_class };
+		}
+
+		[[nodiscard]] std::span<const TypeDescriptor* const> targets() const noexcept { return _targets; }
+
+		// what __RTDynamicCast does for a hierarchy without virtual bases: find the complete object through the
+		// locator, then search its base classes for the target, comparing names where the pointers differ
+		[[nodiscard]] void* cast(void* a_from, const TypeDescriptor* a_target) const
+		{
+			if (!a_from) {
+				return nullptr;
+			}
+
+			const auto vtable = *static_cast<const CompleteObjectLocator* const* const*>(a_from);
+			const auto col = vtable[-1];
+			const auto complete = static_cast<std::byte*>(a_from) - col->offset;
+			const auto hierarchy = at<ClassHierarchyDescriptor>(col->classDescriptor);
+			const auto bases = at<std::uint32_t>(hierarchy->baseClassArray);
+			for (std::uint32_t i = 0; i < hierarchy->numBaseClasses; ++i) {
+				const auto base = at<BaseClassDescriptor>(bases[i]);
+				const auto type = at<TypeDescriptor>(base->typeDescriptor);
+				if (type == a_target || std::strcmp(type->name, a_target->name) == 0) {
+					return complete + base->mDisp;
+				}
+			}
+
+			return nullptr;
+		}
+
+	private:
+		template <class T>
+		[[nodiscard]] T* at(std::uint32_t a_rva) const noexcept
+		{
+			return reinterpret_cast<T*>(const_cast<std::byte*>(_image.data()) + a_rva);
+		}
+
+		[[nodiscard]] std::uint32_t allocate(std::size_t a_size, std::size_t a_align)
+		{
+			_used = (_used + a_align - 1) & ~(a_align - 1);
+			const auto result = static_cast<std::uint32_t>(_used);
+			_used += a_size;
+			REQUIRE(_used <= _image.size());
+			return result;
+		}
+
+		[[nodiscard]] std::uint32_t type_descriptor(std::string_view a_name)
+		{
+			const auto result = allocate(sizeof(TypeDescriptor), alignof(TypeDescriptor));
+			std::ranges::copy(a_name, at<TypeDescriptor>(result)->name);
+			return result;
+		}
+
+		[[nodiscard]] std::uint32_t base_class(std::uint32_t a_type, std::uint32_t a_contained, std::int32_t a_disp)
+		{
+			const auto result = allocate(sizeof(BaseClassDescriptor), alignof(BaseClassDescriptor));
+			*at<BaseClassDescriptor>(result) = { a_type, a_contained, a_disp, -1, 0, 0x40 };
+			return result;
+		}
+
+		// a locator, followed by a vtable which points back at it
+		[[nodiscard]] const void* virtual_table(std::uint32_t a_type, std::uint32_t a_hierarchy, std::int32_t a_offset)
+		{
+			const auto col = allocate(sizeof(CompleteObjectLocator), alignof(CompleteObjectLocator));
+			*at<CompleteObjectLocator>(col) = { 1, static_cast<std::uint32_t>(a_offset), 0, a_type, a_hierarchy, col };
+			const auto vtable = allocate(sizeof(void*) * 4, alignof(void*));
+			*at<const void*>(vtable) = at<CompleteObjectLocator>(col);
+			return at<const void*>(vtable) + 1;
+		}
+
+		// members
+		std::vector<std::byte> _image;
+		std::size_t _used{ 0 };
+		std::vector<std::pair<const void*, const void*>> _classes;  // [ primary, mixin ]
+		std::vector<const TypeDescriptor*> _targets;
+	};
+
+	using cache_t = RE::detail::DynamicCastCache;
+
+	// every subobject of every class, paired with every type it could be cast to
+	struct Cast
+	{
+	public:
+		// members
+		void* from;
+		const SyntheticRTTI::TypeDescriptor* target;
+	};
+
+	[[nodiscard]] std::vector<Cast> make_casts(const SyntheticRTTI& a_rtti, std::vector<SyntheticRTTI::Object>& a_objects)
+	{
+		std::vector<Cast> result;
+		for (auto& object : a_objects) {
+			for (const auto target : a_rtti.targets()) {
+				result.push_back({ std::addressof(object), target });
+				result.push_back({ std::addressof(object.mixin), target });
+			}
+		}
+		return result;
+	}
+}
+
+TEST_CASE("dynamic cast cache")
+{
+	const SyntheticRTTI rtti{ 8, 6 };
+	std::vector<SyntheticRTTI::Object> objects;
+	for (std::size_t i = 0; i < 8; ++i) {
+		objects.push_back(rtti.make_object(i));
+	}
+	const auto casts = make_casts(rtti, objects);
+	const auto source = rtti.targets().back();
+
+	auto cache = std::make_unique<cache_t>();
+	std::size_t slow = 0;
+	const auto cast = [&](const Cast& a_cast) {
+		return cache->cast(a_cast.from, source, a_cast.target, [&](void* a_ptr) {
+			++slow;
+			return rtti.cast(a_ptr, a_cast.target);
+		});
+	};
+
+	SECTION("resolves as the slow path does")
+	{
+		for (const auto& elem : casts) {
+			REQUIRE(cast(elem) == rtti.cast(elem.from, elem.target));
+		}
+		REQUIRE(slow == casts.size());
+		REQUIRE(cache->size() == casts.size());
+
+		// the same vtables on other objects never reach the slow path again, including the casts which fail
+		auto copies = objects;
+		for (const auto& elem : make_casts(rtti, copies)) {
+			REQUIRE(cast(elem) == rtti.cast(elem.from, elem.target));
+		}
+		REQUIRE(slow == casts.size());
+	}
+
+	SECTION("null never reaches the slow path")
+	{
+		REQUIRE(cache->cast(nullptr, source, rtti.targets().front(), [&](void*) { ++slow; return nullptr; }) == nullptr);
+		REQUIRE(slow == 0);
+	}
+
+	SECTION("keys on the source type as well")
+	{
+		const auto& elem = casts.front();
+		const auto result = cast(elem);
+		REQUIRE(!cache->find(*static_cast<void**>(elem.from), rtti.targets().front(), elem.target));
+		REQUIRE(cache->find(*static_cast<void**>(elem.from), source, elem.target) == static_cast<std::byte*>(result) - static_cast<std::byte*>(elem.from));
+	}
+
+	SECTION("stops remembering when full")
+	{
+		std::vector<std::uintptr_t> keys(cache_t::CAPACITY * 2);
+		std::iota(keys.begin(), keys.end(), std::uintptr_t{ 1 });
+		for (const auto key : keys) {
+			cache->insert(reinterpret_cast<const void*>(key), source, source, 0);
+		}
+		REQUIRE(cache->size() <= cache_t::CAPACITY);
+
+		for (const auto& elem : casts) {
+			REQUIRE(cast(elem) == rtti.cast(elem.from, elem.target));
+		}
+	}
+}
+
+TEST_CASE("dynamic cast cache is thread safe")
+{
+	const SyntheticRTTI rtti{ 32, 8 };
+	std::vector<SyntheticRTTI::Object> objects;
+	for (std::size_t i = 0; i < 32; ++i) {
+		objects.push_back(rtti.make_object(i));
+	}
+	const auto casts = make_casts(rtti, objects);
+	const auto source = rtti.targets().back();
+
+	auto cache = std::make_unique<cache_t>();
+	std::atomic_size_t mismatches{ 0 };
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < 8; ++i) {
+		threads.emplace_back([&, i]() {
+			std::mt19937 rng{ static_cast<std::uint32_t>(i) };
+			std::uniform_int_distribution<std::size_t> pick{ 0, casts.size() - 1 };
+			for (std::size_t j = 0; j < 0x4000; ++j) {
+				const auto& elem = casts[pick(rng)];
+				const auto result = cache->cast(elem.from, source, elem.target, [&](void* a_ptr) {
+					return rtti.cast(a_ptr, elem.target);
+				});
+				if (result != rtti.cast(elem.from, elem.target)) {
+					++mismatches;
+				}
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("dynamic cast cache benchmark", "[.][benchmark]")
+{
+	const SyntheticRTTI rtti{ 64, 24 };
+	std::vector<SyntheticRTTI::Object> objects;
+	std::mt19937 rng{ 0xCA57 };
+	for (std::size_t i = 0; i < 0x1000; ++i) {
+		objects.push_back(rtti.make_object(rng() % 64));
+	}
+
+	std::vector<Cast> casts;
+	for (auto& object : objects) {
+		casts.push_back({ std::addressof(object), rtti.targets()[rng() % rtti.targets().size()] });
+	}
+	const auto source = rtti.targets().back();
+	auto cache = std::make_unique<cache_t>();
+
+	BENCHMARK("4096 casts, 24 deep, uncached")
+	{
+		std::size_t result = 0;
+		for (const auto& elem : casts) {
+			result += rtti.cast(elem.from, elem.target) != nullptr;
+		}
+		return result;
+	};
+
+	BENCHMARK("4096 casts, 24 deep, cached")
+	{
+		std::size_t result = 0;
+		for (const auto& elem : casts) {
+			result += cache->cast(elem.from, source, elem.target, [&](void* a_ptr) {
+				return rtti.cast(a_ptr, elem.target);
+			}) != nullptr;
+		}
+		return result;
+	};
+}
@@ -0,0 +1,490 @@
+#include "AddressLibrary.h"
+#include "Demangler.h"
+#include "Dumper.h"
+
+#include <catch2/catch_all.hpp>
+#include <srell.hpp>
+
+namespace
+{
+	// a pe with just enough in it for the dumpers: a .rdata holding complete object locators and the
+	// virtual tables which point at them, and a .data holding type descriptors and NiRTTI records
+	class SyntheticImage
+	{
+	public:
+		static constexpr std::uint64_t BASE = 0x140000000;
+		static constexpr std::uint32_t RDATA = 0x1000;
+		static constexpr std::uint32_t DATA = 0x2000;
+		static constexpr std::uint32_t SIZE = 0x3000;
+
+		SyntheticImage() :
+			_bytes(SIZE)
+		{
+			write<std::uint16_t>(0, PE::DOS_MAGIC);
+			write<std::uint32_t>(0x3C, 0x80);
+			write<std::uint32_t>(0x80, PE::NT_MAGIC);
+
+			PE::FileHeader file{};
+			file.machine = 0x8664;
+			file.numberOfSections = 2;
+			file.sizeOfOptionalHeader = sizeof(PE::OptionalHeader64);
+			write(0x84, file);
+
+			PE::OptionalHeader64 optional{};
+			optional.magic = PE::PE32_PLUS;
+			optional.imageBase = BASE;
+			optional.sectionAlignment = 0x1000;
+			optional.fileAlignment = 0x1000;
+			optional.sizeOfImage = SIZE;
+			optional.sizeOfHeaders = 0x1000;
+			write(0x84 + sizeof(file), optional);
+
+			const auto section = [&](std::size_t a_idx, std::string_view a_name, std::uint32_t a_rva) {
+				PE::SectionHeader header{};
+				std::ranges::copy(a_name, header.name);
+				header.virtualSize = 0x1000;
+				header.virtualAddress = a_rva;
+				header.sizeOfRawData = 0x1000;
+				header.pointerToRawData = a_rva;
+				write(0x84 + sizeof(file) + sizeof(optional) + a_idx * sizeof(header), header);
+			};
+			section(0, ".rdata"sv, RDATA);
+			section(1, ".data"sv, DATA);
+		}
+
+		template <class T>
+		void write(std::size_t a_offset, const T& a_value)
+		{
+			std::memcpy(_bytes.data() + a_offset, std::addressof(a_value), sizeof(T));
+		}
+
+		void write(std::size_t a_offset, std::string_view a_string)
+		{
+			std::ranges::copy(a_string, reinterpret_cast<char*>(_bytes.data()) + a_offset);
+		}
+
+		// a type descriptor is its type_info vtable, a spare pointer, and its mangled name
+		void type_descriptor(std::uint32_t a_rva, std::string_view a_name, std::uint32_t a_typeInfo)
+		{
+			write<std::uint64_t>(a_rva, BASE + a_typeInfo);
+			write(a_rva + 0x10, a_name);
+		}
+
+		// a complete object locator, and the vtable it heads
+		void virtual_table(std::uint32_t a_col, std::uint32_t a_typeDesc, std::uint32_t a_vtable)
+		{
+			write<std::uint32_t>(a_col, 1);
+			write<std::uint32_t>(a_col + 0xC, a_typeDesc);
+			write<std::uint32_t>(a_col + 0x10, RDATA + 0xF00);
+			write<std::uint32_t>(a_col + 0x14, a_col);
+			write<std::uint64_t>(a_vtable - 8, BASE + a_col);
+		}
+
+		void ni_rtti(std::uint32_t a_rva, std::uint32_t a_name, std::uint32_t a_base)
+		{
+			write<std::uint64_t>(a_rva, BASE + a_name);
+			write<std::uint64_t>(a_rva + 8, a_base ? BASE + a_base : 0);
+		}
+
+		[[nodiscard]] std::filesystem::path save(const std::filesystem::path& a_path) const
+		{
+			std::ofstream file{ a_path, std::ios::binary };
+			file.write(reinterpret_cast<const char*>(_bytes.data()), static_cast<std::streamsize>(_bytes.size()));
+			return a_path;
+		}
+
+	private:
+		std::vector<std::byte> _bytes;
+	};
+
+	// the sanitizer as it was first written
+	[[nodiscard]] std::string reference_sanitize(std::string a_name)
+	{
+		static const std::array expressions{
+			std::make_pair(
+				srell::regex{ R"regex((`anonymous namespace'|[ &'*\-`]){1})regex"s, srell::regex::ECMAScript },
+				std::function{ [](std::string& a_name, const srell::ssub_match& a_match) {
+					a_name.erase(a_match.first, a_match.second);
+				} }),
+			std::make_pair(
+				srell::regex{ R"regex(([(),:<>]){1})regex"s, srell::regex::ECMAScript },
+				std::function{ [](std::string& a_name, const srell::ssub_match& a_match) {
+					a_name.replace(a_match.first, a_match.second, "_"sv);
+				} }),
+		};
+
+		srell::smatch matches;
+		for (const auto& [expr, callback] : expressions) {
+			while (srell::regex_search(a_name, matches, expr)) {
+				for (std::size_t i = 1; i < matches.size(); ++i) {
+					callback(a_name, matches[static_cast<int>(i)]);
+				}
+			}
+		}
+
+		return a_name;
+	}
+
+	[[nodiscard]] std::vector<std::string> demangled_names(std::size_t a_count)
+	{
+		constexpr std::array names{
+			"type_info"sv,
+			"BSTEventSink<TESObjectLoadedEvent>"sv,
+			"RE::`anonymous namespace'::Foo"sv,
+			"std::basic_string<char,std::char_traits<char>,std::allocator<char> >"sv,
+			"Func<void (*)(char const *,int)>"sv,
+			"std::_Func_impl_no_alloc<`Foo::Bar'::`2'::<lambda_1>,void,int &&>"sv,
+			"Arr<int,0,-6,16>"sv,
+			"BSTHashMap<BSFixedString,TESForm *>::entry_type"sv,
+		};
+
+		std::mt19937 rng{ 0x5A17 };
+		std::vector<std::string> result;
+		result.reserve(a_count);
+		for (std::size_t i = 0; i < a_count; ++i) {
+			const auto& name = names[i % names.size()];
+			result.push_back(std::string{ name } + "<" + std::to_string(rng()) + ">");
+		}
+		return result;
+	}
+
+	// the rescanning NiRTTI search as it was first written
+	[[nodiscard]] std::vector<std::uint64_t> reference_nirtti(std::uint64_t a_base, const Segment& a_data, std::span<const std::uint64_t> a_seeds)
+	{
+		robin_hood::unordered_flat_set<std::uint64_t> results{ a_seeds.begin(), a_seeds.end() };
+		const auto ptrs = a_data.view<std::uint64_t>();
+		bool found = false;
+		do {
+			found = false;
+			for (std::size_t i = 1; i < ptrs.size(); ++i) {
+				if (results.find(ptrs[i]) != results.end()) {
+					found = results.insert(a_base + a_data.rva + (i - 1) * sizeof(std::uint64_t)).second || found;
+				}
+			}
+		} while (found);
+		return { results.begin(), results.end() };
+	}
+
+	// a data segment full of pointers into itself, with NiRTTI hierarchies a_depth deep hidden in it. children are
+	// laid out before their parents, which is the worst case for rescanning
+	class SyntheticData
+	{
+	public:
+		static constexpr std::uint64_t BASE = 0x140000000;
+		static constexpr std::uint32_t RVA = 0x2000;
+
+		SyntheticData(std::size_t a_size, std::size_t a_roots, std::size_t a_depth) :
+			_ptrs(a_size / sizeof(std::uint64_t))
+		{
+			std::mt19937_64 rng{ 0xDA7A };
+			for (auto& ptr : _ptrs) {
+				ptr = rng() % 4 == 0 ? address(rng() % _ptrs.size()) : rng();
+			}
+
+			// every record gets a pair of slots of its own
+			std::vector<std::size_t> slots(_ptrs.size() / 2);
+			std::iota(slots.begin(), slots.end(), std::size_t{ 0 });
+			std::ranges::shuffle(slots, rng);
+			slots.resize(a_roots * a_depth);
+			std::ranges::sort(slots, std::greater{});
+
+			for (std::size_t i = 0; i < a_roots; ++i) {
+				_roots.push_back(address(slots[i] * 2));
+				_ptrs[slots[i] * 2] = 0;
+				_ptrs[slots[i] * 2 + 1] = 0;
+			}
+			for (std::size_t i = a_roots; i < slots.size(); ++i) {
+				_ptrs[slots[i] * 2] = 0;
+				_ptrs[slots[i] * 2 + 1] = address(slots[i - a_roots] * 2);
+			}
+		}
+
+		[[nodiscard]] Segment segment() const noexcept
+		{
+			return { RVA, std::as_bytes(std::span{ _ptrs }) };
+		}
+
+		[[nodiscard]] std::span<const std::uint64_t> roots() const noexcept { return _roots; }
+
+	private:
+		[[nodiscard]] static std::uint64_t address(std::size_t a_slot) noexcept { return BASE + RVA + a_slot * sizeof(std::uint64_t); }
+
+		// members
+		std::vector<std::uint64_t> _ptrs;
+		std::vector<std::uint64_t> _roots;
+	};
+
+	[[nodiscard]] std::string slurp(const std::filesystem::path& a_path)
+	{
+		std::ifstream file{ a_path, std::ios::binary };
+		return { std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+	}
+}
+
+TEST_CASE("demangle type descriptors")
+{
+	const auto demangle = [](std::string_view a_name) { return Demangler::demangle(a_name).value_or("<failed>"); };
+
+	REQUIRE(demangle(".?AVtype_info@@"sv) == "type_info"sv);
+	REQUIRE(demangle(".M"sv) == "float"sv);
+	REQUIRE(demangle(".I"sv) == "unsigned int"sv);
+	REQUIRE(demangle(".?AW4Kind@Foo@@"sv) == "Foo::Kind"sv);
+	REQUIRE(demangle(".PEAVFoo@@"sv) == "Foo *"sv);
+	REQUIRE(demangle(".?AUFoo@?A0x1a2b3c4d@RE@@"sv) == "RE::`anonymous namespace'::Foo"sv);
+	REQUIRE(demangle(".?AV?$BSTEventSink@UTESObjectLoadedEvent@@@@"sv) == "BSTEventSink<TESObjectLoadedEvent>"sv);
+	REQUIRE(demangle(".?AV?$A@V?$B@H@@@@"sv) == "A<B<int> >"sv);
+	REQUIRE(demangle(".?AV?$Arr@H$0A@$0?5$0BA@@@"sv) == "Arr<int,0,-6,16>"sv);
+	REQUIRE(demangle(".?AV?$Func@P6AXPEBDH@Z@@"sv) == "Func<void (*)(char const *,int)>"sv);
+	REQUIRE(demangle(".?AV?$pair@$$CBVFoo@@VFoo@@@std@@"sv) == "std::pair<Foo const,Foo>"sv);
+
+	// name back references, which template arguments keep a table of their own for
+	REQUIRE(
+		demangle(".?AV?$basic_string@DU?$char_traits@D@std@@V?$allocator@D@2@@std@@"sv) ==
+		"std::basic_string<char,std::char_traits<char>,std::allocator<char> >"sv);
+	REQUIRE(
+		demangle(".?AV?$_Func_impl_no_alloc@V<lambda_1>@?1??Bar@Foo@@QEAAXH@Z@X$$QEAH@std@@"sv) ==
+		"std::_Func_impl_no_alloc<`Foo::Bar'::`2'::<lambda_1>,void,int &&>"sv);
+
+	REQUIRE_FALSE(Demangler::demangle(".?AVFoo@"sv));
+	REQUIRE_FALSE(Demangler::demangle(".?AV?$Foo@$1?bar@@3HA@@"sv));
+}
+
+TEST_CASE("dump synthetic image")
+{
+	using Image = SyntheticImage;
+
+	Image image;
+	const auto typeInfo = Image::DATA + 0x000;
+	const auto foo = Image::DATA + 0x040;
+	const auto sink = Image::DATA + 0x080;
+	const auto baz = Image::DATA + 0x0C0;
+	const auto flt = Image::DATA + 0x100;
+	image.type_descriptor(typeInfo, ".?AVtype_info@@"sv, Image::RDATA + 0x108);
+	image.type_descriptor(foo, ".?AVFoo@@"sv, Image::RDATA + 0x108);
+	image.type_descriptor(sink, ".?AV?$BSTEventSink@UBar@@@@"sv, Image::RDATA + 0x108);
+	image.type_descriptor(baz, ".?AVBaz@@"sv, Image::RDATA + 0x108);
+	image.type_descriptor(flt, ".M"sv, Image::RDATA + 0x108);
+
+	image.virtual_table(Image::RDATA + 0x000, typeInfo, Image::RDATA + 0x108);
+	image.virtual_table(Image::RDATA + 0x020, foo, Image::RDATA + 0x118);
+	image.virtual_table(Image::RDATA + 0x040, sink, Image::RDATA + 0x128);
+	image.virtual_table(Image::RDATA + 0x060, baz, Image::RDATA + 0x148);  // multiple inheritance, and out of order
+	image.virtual_table(Image::RDATA + 0x080, baz, Image::RDATA + 0x138);
+	image.write<std::uint64_t>(Image::RDATA + 0x200, foo);                 // a base class descriptor, not a col
+
+	const auto niObject = Image::DATA + 0x200;
+	const auto niNode = Image::DATA + 0x210;
+	const auto fadeNode = Image::DATA + 0x220;
+	const auto facade = Image::DATA + 0x230;
+	image.ni_rtti(niObject, Image::DATA + 0x400, 0);
+	image.ni_rtti(niNode, Image::DATA + 0x410, niObject);
+	image.ni_rtti(fadeNode, Image::DATA + 0x420, niNode);
+	image.ni_rtti(facade, Image::DATA + 0x430, niObject);
+	image.write(Image::DATA + 0x400, "NiObject"sv);
+	image.write(Image::DATA + 0x410, "NiNode"sv);
+	image.write(Image::DATA + 0x420, "BSFadeNode"sv);
+	image.write(Image::DATA + 0x430, "Misnamed"sv);
+
+	std::vector<AddressLibrary::Pair> mappings{
+		{ 1, typeInfo },
+		{ 2, foo },
+		{ 3, sink },
+		{ 4, baz },
+		{ 25921, flt },
+		{ 10, Image::RDATA + 0x108 },
+		{ 11, Image::RDATA + 0x118 },
+		{ 12, Image::RDATA + 0x128 },
+		{ 13, Image::RDATA + 0x138 },
+		{ 14, Image::RDATA + 0x148 },
+		{ 17735, niObject },
+		{ 20, niNode },
+		{ 21, fadeNode },
+		{ 221529, facade },
+	};
+	// every other seed is also NiObject
+	for (const auto seed : { 1352616, 31936, 1482971, 1123991, 858091, 933986, 56458, 1372534, 495124, 1325961, 182826, 1359461, 34089 }) {
+		mappings.push_back({ static_cast<std::uint64_t>(seed), niObject });
+	}
+	const auto library = std::make_shared<const AddressLibrary>(std::move(mappings));
+
+	const auto directory = std::filesystem::temp_directory_path() / "RTTIDumpTest";
+	std::filesystem::create_directories(directory);
+	const Target target{
+		::Image::load(image.save(directory / "Fallout4.exe")),
+		[=](std::uint64_t a_offset) { return library->id(a_offset); },
+		[=](std::uint64_t a_id) { return library->offset(a_id); },
+		Demangler::demangle,
+	};
+	REQUIRE(target.image.base() == Image::BASE);
+	REQUIRE(target.image.segment(".rdata"sv).rva == Image::RDATA);
+
+	dump_rtti(target, directory);
+	dump_nirtti(target, directory);
+
+	REQUIRE(
+		slurp(directory / "RTTI_IDs.h") ==
+		"#pragma once\n"
+		"\n"
+		"namespace RE\n"
+		"{\n"
+		"\tnamespace RTTI\n"
+		"\t{\n"
+		"\t\tinline constexpr REL::ID BSTEventSink_Bar_{ 3 };\n"
+		"\t\tinline constexpr REL::ID Baz{ 4 };\n"
+		"\t\tinline constexpr REL::ID Foo{ 2 };\n"
+		"\t\tinline constexpr REL::ID type_info{ 1 };\n"
+		"\t}\n"
+		"}\n"sv);
+	REQUIRE(
+		slurp(directory / "VTABLE_IDs.h") ==
+		"#pragma once\n"
+		"\n"
+		"namespace RE\n"
+		"{\n"
+		"\tnamespace VTABLE\n"
+		"\t{\n"
+		"\t\tinline constexpr std::array<REL::ID, 1> BSTEventSink_Bar_{ REL::ID(12) };\n"
+		"\t\tinline constexpr std::array<REL::ID, 2> Baz{ REL::ID(13), REL::ID(14) };\n"
+		"\t\tinline constexpr std::array<REL::ID, 1> Foo{ REL::ID(11) };\n"
+		"\t\tinline constexpr std::array<REL::ID, 1> type_info{ REL::ID(10) };\n"
+		"\t}\n"
+		"}\n"sv);
+	REQUIRE(
+		slurp(directory / "NiRTTI_IDs.h") ==
+		"#pragma once\n"
+		"\n"
+		"namespace RE\n"
+		"{\n"
+		"\tnamespace Ni_RTTI\n"
+		"\t{\n"
+		"\t\tinline constexpr REL::ID BGSStaticCollection__RootFacade{ 221529 };\n"
+		"\t\tinline constexpr REL::ID BSFadeNode{ 21 };\n"
+		"\t\tinline constexpr REL::ID NiNode{ 20 };\n"
+		"\t\tinline constexpr REL::ID NiObject{ 17735 };\n"
+		"\t}\n"
+		"}\n"sv);
+
+	std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("reject malformed images")
+{
+	const auto path = std::filesystem::temp_directory_path() / "RTTIDumpMalformed.exe";
+	{
+		std::ofstream file{ path, std::ios::binary };
+		file << "not an executable"sv;
+	}
+	REQUIRE_THROWS_AS(Image::load(path), std::runtime_error);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("sanitize names as the regexes did")
+{
+	for (const auto& name : demangled_names(0x100)) {
+		REQUIRE(sanitize_name(name) == reference_sanitize(name));
+	}
+
+	// anything built from the interesting pieces, including partial and overlapping anonymous namespaces
+	constexpr std::array pieces{
+		"`anonymous namespace'"sv,
+		"`anonymous"sv,
+		" namespace'"sv,
+		"``"sv,
+		"A"sv,
+		"::"sv,
+		"<>"sv,
+		"(*)"sv,
+		" &"sv,
+		"'"sv,
+		"-"sv,
+		"\xFF"sv,
+	};
+	std::mt19937 rng{ 0xBEEF };
+	std::uniform_int_distribution<std::size_t> piece{ 0, pieces.size() - 1 };
+	for (std::size_t i = 0; i < 0x400; ++i) {
+		std::string name;
+		for (std::size_t j = 0; j < 8; ++j) {
+			name += pieces[piece(rng)];
+		}
+		REQUIRE(sanitize_name(name) == reference_sanitize(name));
+	}
+}
+
+TEST_CASE("header writer")
+{
+	HeaderWriter writer{ "RTTI"sv, 0 };
+	writer << "\t\tinline constexpr REL::ID "sv << "Foo"sv << "{ "sv << std::uint64_t{ 18446744073709551615u } << " };\n"sv;
+
+	const auto path = std::filesystem::temp_directory_path() / "RTTIDumpHeader.h";
+	writer.save(path);
+	REQUIRE(
+		slurp(path) ==
+		"#pragma once\n"
+		"\n"
+		"namespace RE\n"
+		"{\n"
+		"\tnamespace RTTI\n"
+		"\t{\n"
+		"\t\tinline constexpr REL::ID Foo{ 18446744073709551615 };\n"
+		"\t}\n"
+		"}\n"sv);
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("sanitize benchmark", "[.][benchmark]")
+{
+	const auto names = demangled_names(12000);
+
+	BENCHMARK("12k names, regex")
+	{
+		std::size_t result = 0;
+		for (const auto& name : names) {
+			result += reference_sanitize(name).size();
+		}
+		return result;
+	};
+
+	BENCHMARK("12k names, table")
+	{
+		std::size_t result = 0;
+		for (const auto& name : names) {
+			result += sanitize_name(name).size();
+		}
+		return result;
+	};
+
+	BENCHMARK("12k entries, formatted")
+	{
+		HeaderWriter writer{ "RTTI"sv, names.size() * 0x80 };
+		for (std::uint64_t i = 0; i < names.size(); ++i) {
+			writer << "\t\tinline constexpr REL::ID "sv << names[i] << "{ "sv << i << " };\n"sv;
+		}
+		return writer;
+	};
+}
+
+TEST_CASE("find NiRTTI")
+{
+	const SyntheticData data{ 0x10000, 4, 32 };
+	auto expected = reference_nirtti(SyntheticData::BASE, data.segment(), data.roots());
+	auto found = find_nirtti(SyntheticData::BASE, data.segment(), data.roots());
+	std::ranges::sort(expected);
+	std::ranges::sort(found);
+	REQUIRE(found.size() >= 4 * 32);
+	REQUIRE(found == expected);
+}
+
+TEST_CASE("find NiRTTI benchmark", "[.][benchmark]")
+{
+	const SyntheticData data{ 0x400000, 16, 64 };
+
+	BENCHMARK("4MiB, 64 deep, rescanning")
+	{
+		return reference_nirtti(SyntheticData::BASE, data.segment(), data.roots());
+	};
+
+	BENCHMARK("4MiB, 64 deep, indexed")
+	{
+		return find_nirtti(SyntheticData::BASE, data.segment(), data.roots());
+	};
+}
@@ -0,0 +1,529 @@
+#include "Stubs.h"
+
+#include "AddressLibrary.h"
+#include "REL/IDList.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace
+{
+	inline constexpr std::uint64_t DATABASE_SIZE = 500'000;
+
+	// synthetic address library, every id maps to a 4-byte slot in the fake image
+	[[nodiscard]] constexpr std::uint64_t make_offset(std::uint64_t a_id) noexcept
+	{
+		return (a_id * sizeof(std::uint32_t)) % F4SE::WinAPI::detail::IMAGE_SIZE;
+	}
+
+	// ids which were dropped between game versions leave holes in the database
+	[[nodiscard]] constexpr bool has_id(std::uint64_t a_id) noexcept
+	{
+		return a_id % 10 != 9;
+	}
+
+	using mappings_t = std::vector<std::pair<std::uint64_t, std::uint64_t>>;
+
+	[[nodiscard]] mappings_t make_mappings(std::uint64_t a_spread = 1)
+	{
+		mappings_t result;
+		for (std::uint64_t id = 0; id < DATABASE_SIZE; ++id) {
+			if (has_id(id)) {
+				result.emplace_back(id * a_spread, make_offset(id));
+			}
+		}
+		return result;
+	}
+
+	void write_v1(const std::filesystem::path& a_path, const mappings_t& a_mappings)
+	{
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		const auto binary_write = [&](std::uint64_t a_data) {
+			file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+		};
+
+		binary_write(a_mappings.size());
+		for (const auto& [id, offset] : a_mappings) {
+			binary_write(id);
+			binary_write(offset);
+		}
+	}
+
+	void write_v2(const std::filesystem::path& a_path, const mappings_t& a_mappings, bool a_dense)
+	{
+		std::vector<std::uint8_t> packed;
+		const auto write_varint = [&](std::uint64_t a_value) {
+			for (; a_value >= 0x80; a_value >>= 7) {
+				packed.push_back(static_cast<std::uint8_t>(a_value | 0x80));
+			}
+			packed.push_back(static_cast<std::uint8_t>(a_value));
+		};
+
+		auto byOffset = a_mappings;
+		std::ranges::sort(byOffset, {}, [](auto&& a_elem) { return a_elem.second; });
+		std::uint64_t prev = 0;
+		for (const auto& [id, offset] : byOffset) {
+			write_varint(offset - prev);
+			write_varint(id);
+			prev = offset;
+		}
+
+		const std::uint64_t idLimit = a_mappings.back().first + 1;
+		const std::array<std::uint64_t, 5> header{
+			REL::IDDatabase::MAGIC,
+			REL::IDDatabase::FORMAT | (static_cast<std::uint64_t>(a_dense ? 1 : 0) << 32),
+			a_mappings.size(),
+			idLimit,
+			packed.size()
+		};
+
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+		file.write(reinterpret_cast<const char*>(packed.data()), static_cast<std::streamsize>(packed.size()));
+		if (a_dense) {
+			while (file.tellp() % sizeof(std::uint32_t) != 0) {
+				file.put('\0');
+			}
+
+			std::vector<std::uint32_t> dense(idLimit, (std::numeric_limits<std::uint32_t>::max)());
+			for (const auto& [id, offset] : a_mappings) {
+				dense[id] = static_cast<std::uint32_t>(offset);
+			}
+			file.write(reinterpret_cast<const char*>(dense.data()), static_cast<std::streamsize>(dense.size() * sizeof(std::uint32_t)));
+		}
+	}
+
+	// a_source is the database the index claims to have been written from
+	void write_offsets(const std::filesystem::path& a_path, const mappings_t& a_mappings, const std::filesystem::path& a_source)
+	{
+		auto byOffset = a_mappings;
+		std::ranges::sort(byOffset, {}, [](auto&& a_elem) { return std::make_pair(a_elem.second, a_elem.first); });
+
+		std::ifstream in(a_source, std::ios::in | std::ios::binary);
+		const std::vector<char> source{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+
+		std::ofstream file(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		const auto binary_write = [&](std::uint64_t a_data) {
+			file.write(reinterpret_cast<const char*>(std::addressof(a_data)), sizeof(a_data));
+		};
+
+		binary_write(REL::IDDatabase::OFFSETS_MAGIC);
+		binary_write(REL::IDDatabase::OFFSETS_FORMAT);
+		binary_write(byOffset.size());
+		binary_write(source.size());
+		binary_write(REL::IDDatabase::source_hash(std::as_bytes(std::span{ source })));
+		for (const auto& [id, offset] : byOffset) {
+			binary_write(id);
+			binary_write(offset);
+		}
+	}
+
+	// the singleton only looks next to the game, so this is the one database written outside of the temp directory
+	class Database
+	{
+	public:
+		Database()
+		{
+			std::filesystem::create_directories(PATH.parent_path());
+			write_v1(PATH, make_mappings());
+		}
+
+		Database(const Database&) = delete;
+		Database(Database&&) = delete;
+
+		// runs after the singleton, which is constructed later, has unmapped the file
+		~Database()
+		{
+			std::error_code ec;
+			std::filesystem::remove(PATH, ec);
+			for (auto path = PATH.parent_path(); !path.empty(); path = path.parent_path()) {
+				if (!std::filesystem::remove(path, ec)) {  // leave anything which was already there
+					break;
+				}
+			}
+		}
+
+		Database& operator=(const Database&) = delete;
+		Database& operator=(Database&&) = delete;
+
+	private:
+		static inline const std::filesystem::path PATH{ "Data/F4SE/Plugins/version-1-10-163-0.bin"sv };
+	};
+
+	void write_database()
+	{
+		static const Database database;
+	}
+
+	REL::PreloadIDs<0, 8, 42 * 8, 9 * 8> preload;
+
+	// every other id preload should find in a database made with make_mappings(8), with a hole at the end
+	[[nodiscard]] std::vector<std::uint64_t> make_preload_ids()
+	{
+		std::vector<std::uint64_t> result;
+		for (std::uint64_t id = 1; id < DATABASE_SIZE; id += 2) {
+			if (has_id(id)) {
+				result.push_back(id * 8);
+			}
+		}
+		result.push_back(DATABASE_SIZE * 8);
+		std::shuffle(result.begin(), result.end(), std::mt19937_64{ 0x1337 });
+		return result;
+	}
+
+	[[nodiscard]] std::uint32_t read_fresh(std::uint64_t a_id)
+	{
+		REL::Relocation<std::uint32_t*> slot{ REL::ID(a_id) };
+		return *slot;
+	}
+
+	[[nodiscard]] std::uint32_t read_cached()
+	{
+		static REL::Relocation<std::uint32_t*> slot{ REL::ID(DATABASE_SIZE / 3) };
+		return *slot;
+	}
+}
+
+TEST_CASE("id lookup")
+{
+	write_database();
+
+	const auto base = REL::Module::get().base();
+	for (std::uint64_t id = 0; id < DATABASE_SIZE; id += 997) {
+		if (has_id(id)) {
+			REQUIRE(REL::ID(id).offset() == make_offset(id));
+			REQUIRE(REL::ID(id).address() == base + make_offset(id));
+		} else {
+			REQUIRE_THROWS(REL::ID(id).offset());
+		}
+	}
+
+	REQUIRE(REL::Relocation<std::uint32_t*>{ REL::ID(42), 0x8 }.address() == base + make_offset(42) + 0x8);
+	REQUIRE_THROWS(REL::ID(DATABASE_SIZE).offset());
+}
+
+TEST_CASE("id lookup strategies")
+{
+	write_database();
+
+	using Strategy = REL::IDDatabase::Strategy;
+	const auto& iddb = REL::IDDatabase::get();
+	REQUIRE(iddb.strategy() == Strategy::kDense);
+
+	for (std::uint64_t id = 0; id < DATABASE_SIZE + 10; ++id) {
+		if (id < DATABASE_SIZE && has_id(id)) {
+			REQUIRE(iddb.id2offset(id, Strategy::kDense) == make_offset(id));
+			REQUIRE(iddb.id2offset(id, Strategy::kSearch) == make_offset(id));
+		} else {
+			REQUIRE_THROWS(iddb.id2offset(id, Strategy::kDense));
+			REQUIRE_THROWS(iddb.id2offset(id, Strategy::kSearch));
+		}
+	}
+}
+
+TEST_CASE("id lookup strategies benchmark", "[.][benchmark]")
+{
+	write_database();
+
+	using Strategy = REL::IDDatabase::Strategy;
+	const auto& iddb = REL::IDDatabase::get();
+
+	std::vector<std::uint64_t> sequential;
+	for (std::uint64_t id = 0; id < DATABASE_SIZE; ++id) {
+		if (has_id(id)) {
+			sequential.push_back(id);
+		}
+	}
+	sequential.resize(1u << 16);
+
+	auto random = sequential;
+	std::shuffle(random.begin(), random.end(), std::mt19937_64{ 0x1337 });
+
+	const auto sum = [&](std::span<const std::uint64_t> a_ids, Strategy a_strategy) {
+		std::size_t result = 0;
+		for (const auto id : a_ids) {
+			result += iddb.id2offset(id, a_strategy);
+		}
+		return result;
+	};
+
+	BENCHMARK("search, sequential ids") { return sum(sequential, Strategy::kSearch); };
+	BENCHMARK("dense, sequential ids") { return sum(sequential, Strategy::kDense); };
+	BENCHMARK("search, random ids") { return sum(random, Strategy::kSearch); };
+	BENCHMARK("dense, random ids") { return sum(random, Strategy::kDense); };
+}
+
+TEST_CASE("resolve once")
+{
+	write_database();
+
+	REQUIRE(read_fresh(DATABASE_SIZE / 3) == read_cached());
+}
+
+TEST_CASE("resolve once benchmark", "[.][benchmark]")
+{
+	write_database();
+
+	BENCHMARK("per call resolution")
+	{
+		return read_fresh(DATABASE_SIZE / 3);
+	};
+
+	BENCHMARK("resolve once")
+	{
+		return read_cached();
+	};
+}
+
+TEST_CASE("database formats")
+{
+	const auto root = std::filesystem::temp_directory_path() / "RelocationFormats";
+	std::filesystem::create_directories(root);
+
+	const auto dense = make_mappings();
+	const auto sparse = make_mappings(8);
+	write_v1(root / "format-v1.bin"sv, dense);
+	write_v2(root / "format-v2-dense.bin"sv, dense, true);
+	write_v2(root / "format-v2-packed.bin"sv, dense, false);
+	write_v2(root / "format-v2-sparse.bin"sv, sparse, false);
+
+	using Strategy = REL::IDDatabase::Strategy;
+	const auto check = [](const std::filesystem::path& a_path, const mappings_t& a_mappings, std::uint32_t a_format, Strategy a_strategy) {
+		const REL::IDDatabase iddb{ a_path };
+		REQUIRE(iddb.format() == a_format);
+		REQUIRE(iddb.size() == a_mappings.size());
+		REQUIRE(iddb.strategy() == a_strategy);
+		for (const auto& [id, offset] : a_mappings) {
+			REQUIRE(iddb.id2offset(id) == offset);
+			REQUIRE(iddb.id2offset(id, Strategy::kSearch) == offset);
+		}
+
+		WARN(fmt::format("{}: {} bytes", a_path.filename().string(), std::filesystem::file_size(a_path)));
+	};
+
+	check(root / "format-v1.bin"sv, dense, 1, Strategy::kDense);
+	check(root / "format-v2-dense.bin"sv, dense, 2, Strategy::kDense);
+	check(root / "format-v2-packed.bin"sv, dense, 2, Strategy::kSearch);
+	check(root / "format-v2-sparse.bin"sv, sparse, 2, Strategy::kSearch);
+
+	REQUIRE(std::filesystem::file_size(root / "format-v2-packed.bin"sv) * 2 < std::filesystem::file_size(root / "format-v1.bin"sv));
+
+	std::filesystem::remove_all(root);
+}
+
+TEST_CASE("database formats benchmark", "[.][benchmark]")
+{
+	const auto root = std::filesystem::temp_directory_path() / "RelocationFormatsBenchmark";
+	std::filesystem::create_directories(root);
+
+	const auto dense = make_mappings();
+	write_v1(root / "format-v1.bin"sv, dense);
+	write_v2(root / "format-v2-dense.bin"sv, dense, true);
+	write_v2(root / "format-v2-packed.bin"sv, dense, false);
+
+	BENCHMARK("load v1")
+	{
+		return REL::IDDatabase{ root / "format-v1.bin"sv }.id2offset(42);
+	};
+
+	BENCHMARK("load v2, dense")
+	{
+		return REL::IDDatabase{ root / "format-v2-dense.bin"sv }.id2offset(42);
+	};
+
+	BENCHMARK("load v2, packed")
+	{
+		return REL::IDDatabase{ root / "format-v2-packed.bin"sv }.id2offset(42);
+	};
+
+	std::filesystem::remove_all(root);
+}
+
+TEST_CASE("offline reader")
+{
+	const auto root = std::filesystem::temp_directory_path() / "RelocationOffline";
+	std::filesystem::create_directories(root);
+
+	// RTTIDump reads databases without the game, and must agree with the runtime on every layout
+	const auto dense = make_mappings();
+	const auto sparse = make_mappings(8);
+	const std::array files{
+		std::make_pair(root / "offline-v1.bin"sv, dense.back().first),
+		std::make_pair(root / "offline-v2-dense.bin"sv, dense.back().first),
+		std::make_pair(root / "offline-v2-packed.bin"sv, dense.back().first),
+		std::make_pair(root / "offline-v2-sparse.bin"sv, sparse.back().first),
+	};
+	write_v1(files[0].first, dense);
+	write_v2(files[1].first, dense, true);
+	write_v2(files[2].first, dense, false);
+	write_v2(files[3].first, sparse, false);
+
+	for (const auto& [path, last] : files) {
+		const REL::IDDatabase iddb{ path };
+		const REL::IDDatabase::Offset2ID offset2id{ iddb };
+		const auto library = AddressLibrary::load(path);
+
+		std::size_t mismatches = 0;
+		for (std::uint64_t id = 0; id <= last + 1; ++id) {
+			const auto offset = iddb.find(id);
+			mismatches += offset == library.offset(id) ? 0 : 1;
+			if (offset) {
+				mismatches += offset2id.find(*offset) == library.id(*offset) ? 0 : 1;
+			}
+		}
+		REQUIRE(mismatches == 0);
+	}
+
+	// both refuse a dense block which runs past the end of the file
+	const auto truncated = root / "offline-truncated.bin"sv;
+	std::filesystem::copy_file(files[1].first, truncated, std::filesystem::copy_options::overwrite_existing);
+	std::filesystem::resize_file(truncated, std::filesystem::file_size(truncated) - sizeof(std::uint32_t));
+	REQUIRE_THROWS(REL::IDDatabase{ truncated });
+	REQUIRE_THROWS(AddressLibrary::load(truncated));
+
+	std::filesystem::remove_all(root);
+}
+
+TEST_CASE("offset lookup")
+{
+	const auto root = std::filesystem::temp_directory_path() / "RelocationOffsets";
+	std::filesystem::create_directories(root);
+
+	const auto mappings = make_mappings();
+	const auto v1 = root / "offsets-v1.bin"sv;
+	const auto v2 = root / "offsets-v2.bin"sv;
+	const auto stale = root / "offsets-stale.bin"sv;
+	const auto foreign = root / "offsets-foreign.bin"sv;
+	write_v1(v1, mappings);
+	write_v2(v2, mappings, false);
+	write_v1(stale, mappings);
+	write_v1(foreign, mappings);
+	std::filesystem::remove(REL::IDDatabase::offsets_path(v2));
+	write_offsets(REL::IDDatabase::offsets_path(v1), mappings, v1);
+	write_offsets(REL::IDDatabase::offsets_path(stale), mappings_t(mappings.begin(), mappings.begin() + 10), stale);
+
+	// as many mappings as its database, but sorted from another one
+	auto moved = mappings;
+	for (auto& elem : moved) {
+		elem.second += 0x10;
+	}
+	write_offsets(REL::IDDatabase::offsets_path(foreign), moved, v2);
+
+	const auto check = [&](const std::filesystem::path& a_path, bool a_mapped) {
+		const REL::IDDatabase iddb{ a_path };
+		const REL::IDDatabase::Offset2ID offset2id{ iddb };
+		REQUIRE(offset2id.is_mapped() == a_mapped);
+		REQUIRE(offset2id.size() == mappings.size());
+		REQUIRE(std::ranges::is_sorted(offset2id, {}, [](auto&& a_elem) { return a_elem.offset; }));
+
+		for (std::uint64_t id = 0; id < DATABASE_SIZE; ++id) {
+			const auto offset = static_cast<std::size_t>(make_offset(id));
+			if (has_id(id)) {
+				REQUIRE(offset2id(offset) == id);
+				REQUIRE(offset2id.find(offset) == id);
+			} else {
+				REQUIRE_THROWS(offset2id(offset));
+				REQUIRE_FALSE(offset2id.find(offset));
+
+				const auto nearest = offset2id.nearest(offset);
+				REQUIRE(nearest);
+				REQUIRE(nearest->id == id - 1);
+				REQUIRE(nearest->delta == sizeof(std::uint32_t));
+			}
+		}
+
+		const auto inside = offset2id.nearest(static_cast<std::size_t>(make_offset(42)) + 3);
+		REQUIRE(inside);
+		REQUIRE(inside->id == 42);
+		REQUIRE(inside->delta == 3);
+		REQUIRE_FALSE(offset2id.find(static_cast<std::size_t>(make_offset(42)) + 3));
+
+		const auto first = offset2id.nearest(0);
+		REQUIRE(first);
+		REQUIRE(first->id == 0);
+		REQUIRE(first->delta == 0);
+	};
+
+	check(v1, true);
+	check(v2, false);
+	check(stale, false);
+	check(foreign, false);
+
+	std::filesystem::remove_all(root);
+}
+
+TEST_CASE("offset lookup benchmark", "[.][benchmark]")
+{
+	const auto root = std::filesystem::temp_directory_path() / "RelocationOffsetsBenchmark";
+	std::filesystem::create_directories(root);
+
+	const auto mappings = make_mappings();
+	const auto indexed = root / "offsets-indexed.bin"sv;
+	const auto unindexed = root / "offsets-unindexed.bin"sv;
+	write_v1(indexed, mappings);
+	write_v1(unindexed, mappings);
+	write_offsets(REL::IDDatabase::offsets_path(indexed), mappings, indexed);
+	{
+		const REL::IDDatabase iddb{ indexed };
+		const REL::IDDatabase sorted{ unindexed };
+
+		BENCHMARK("sort at runtime")
+		{
+			return REL::IDDatabase::Offset2ID{ sorted }.size();
+		};
+
+		BENCHMARK("map offset index")
+		{
+			return REL::IDDatabase::Offset2ID{ iddb }.size();
+		};
+	}
+
+	std::filesystem::remove_all(root);
+}
+
+TEST_CASE("preload")
+{
+	REQUIRE(std::ranges::adjacent_find(REL::detail::LIBRARY_IDS, std::greater_equal{}) == REL::detail::LIBRARY_IDS.end());
+
+	const auto path = std::filesystem::temp_directory_path() / "RelocationPreload.bin";
+	const auto sparse = make_mappings(8);
+	write_v2(path, sparse, false);
+	{
+		REL::IDDatabase iddb{ path };
+		REQUIRE(iddb.strategy() == REL::IDDatabase::Strategy::kSearch);
+		REQUIRE(iddb.preload({}) == 3);  // 9 * 8 is a hole
+
+		// registered ids are resolved alongside the given ones, even when they overlap
+		const auto ids = make_preload_ids();
+		REQUIRE(iddb.preload(ids) == ids.size() - 1 + 2);
+		for (const auto& [id, offset] : sparse) {
+			REQUIRE(iddb.id2offset(id) == offset);
+		}
+		REQUIRE_FALSE(iddb.find(DATABASE_SIZE * 8));
+	}
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("preload benchmark", "[.][benchmark]")
+{
+	const auto path = std::filesystem::temp_directory_path() / "RelocationPreloadBenchmark.bin";
+	write_v2(path, make_mappings(8), false);
+	{
+		const auto ids = make_preload_ids();
+		const REL::IDDatabase lazy{ path };
+		BENCHMARK("lazy resolution")
+		{
+			std::size_t result = 0;
+			for (const auto id : ids) {
+				result += lazy.find(id).value_or(0);
+			}
+			return result;
+		};
+
+		REL::IDDatabase iddb{ path };
+		BENCHMARK("preload sweep")
+		{
+			return iddb.preload(ids);
+		};
+	}
+	std::filesystem::remove(path);
+}
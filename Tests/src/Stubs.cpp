@@ -0,0 +1,38 @@
+#include "Stubs.h"
+
+namespace F4SE
+{
+	namespace stl
+	{
+		void report_and_fail(std::string_view a_msg)
+		{
+			throw std::runtime_error(std::string(a_msg));
+		}
+	}
+
+	namespace WinAPI
+	{
+		std::uint32_t GetCurrentThreadID() noexcept { return 0; }
+		std::uint32_t GetEnvironmentVariable(const wchar_t*, wchar_t*, std::uint32_t) noexcept { return 0; }
+		bool GetFileVersionInfo(const wchar_t*, std::uint32_t, std::uint32_t, void*) noexcept { return true; }
+		std::uint32_t GetFileVersionInfoSize(const wchar_t*, std::uint32_t*) noexcept { return 1; }
+		void* GetModuleHandle(const wchar_t*) noexcept { return detail::image; }
+
+		bool VerQueryValue(const void*, const wchar_t*, void** a_buffer, unsigned int* a_len) noexcept
+		{
+			*a_buffer = const_cast<wchar_t*>(detail::VERSION.data());
+			*a_len = static_cast<unsigned int>(detail::VERSION.size());
+			return true;
+		}
+
+		bool VirtualFree(void*, std::size_t, std::uint32_t) noexcept { return true; }
+
+		bool VirtualProtect(void*, std::size_t, std::uint32_t, std::uint32_t* a_old) noexcept
+		{
+			*a_old = PAGE_EXECUTE_READWRITE;
+			return true;
+		}
+	}
+}
+
+void REL::Module::load_segments() {}
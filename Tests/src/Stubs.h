@@ -0,0 +1,116 @@
+#pragma once
+
+#include <fmt/format.h>
+#include <mmio/mmio.hpp>
+
+// stands in for the parts of F4SE/Impl/PCH.h which the headers under test lean on. every suite shares this one
+// set, and the definitions live in Stubs.cpp, so the suites can all be linked into the one executable
+namespace F4SE
+{
+	namespace stl
+	{
+		template <class CharT>
+		using basic_zstring = std::basic_string_view<CharT>;
+
+		using zstring = basic_zstring<char>;
+		using zwstring = basic_zstring<wchar_t>;
+
+		namespace nttp
+		{
+			template <class CharT, std::size_t N>
+			struct string
+			{
+				using char_type = CharT;
+
+				consteval string(const CharT* a_string) noexcept { std::copy_n(a_string, N, c); }
+
+				[[nodiscard]] consteval const CharT* data() const noexcept { return c; }
+				[[nodiscard]] consteval std::size_t length() const noexcept { return N; }
+
+				CharT c[N]{};
+			};
+
+			template <class CharT, std::size_t N>
+			string(const CharT (&)[N]) -> string<CharT, N - 1>;
+		}
+
+		// throws, so that tests can expect failures
+		[[noreturn]] void report_and_fail(std::string_view a_msg);
+
+		template <class To, class From>
+		[[nodiscard]] To unrestricted_cast(From a_from)
+		{
+			if constexpr (std::is_same_v<std::remove_cv_t<From>, std::remove_cv_t<To>>) {
+				return To{ a_from };
+			} else if constexpr ((std::is_pointer_v<From> || std::is_integral_v<From>) &&
+								 (std::is_pointer_v<To> || std::is_integral_v<To>)) {
+				return reinterpret_cast<To>(a_from);
+			} else {
+				// member function pointers, which cannot be reinterpreted directly
+				union
+				{
+					std::remove_cv_t<From> from;
+					std::remove_cv_t<To> to;
+				};
+
+				from = a_from;
+				return to;
+			}
+		}
+
+		template <class T>
+		class atomic_ref :
+			public std::atomic_ref<T>
+		{
+		public:
+			explicit atomic_ref(volatile T& a_obj) noexcept :
+				std::atomic_ref<T>(const_cast<T&>(a_obj))
+			{}
+
+			using std::atomic_ref<T>::operator=;
+		};
+
+		template <class T>
+		atomic_ref(volatile T&) -> atomic_ref<T>;
+	}
+
+	namespace WinAPI
+	{
+		inline constexpr auto MEM_RELEASE{ static_cast<std::uint32_t>(0x00008000) };
+		inline constexpr auto PAGE_EXECUTE_READWRITE{ static_cast<std::uint32_t>(0x40) };
+
+		namespace detail
+		{
+			// the module the game would be, which REL::Module finds through GetModuleHandle
+			inline constexpr std::size_t IMAGE_SIZE = 1u << 22;
+			inline constexpr auto VERSION = L"1.10.163.0"sv;
+
+			alignas(0x1000) inline std::byte image[IMAGE_SIZE];
+		}
+
+		[[nodiscard]] std::uint32_t GetCurrentThreadID() noexcept;
+		[[nodiscard]] std::uint32_t GetEnvironmentVariable(const wchar_t* a_name, wchar_t* a_buffer, std::uint32_t a_size) noexcept;
+		[[nodiscard]] bool GetFileVersionInfo(const wchar_t* a_filename, std::uint32_t a_handle, std::uint32_t a_len, void* a_data) noexcept;
+		[[nodiscard]] std::uint32_t GetFileVersionInfoSize(const wchar_t* a_filename, std::uint32_t* a_handle) noexcept;
+		[[nodiscard]] void* GetModuleHandle(const wchar_t* a_moduleName) noexcept;
+		[[nodiscard]] bool VerQueryValue(const void* a_block, const wchar_t* a_subBlock, void** a_buffer, unsigned int* a_len) noexcept;
+		bool VirtualFree(void* a_address, std::size_t a_size, std::uint32_t a_freeType) noexcept;
+
+		// every page is treated as writable already
+		[[nodiscard]] bool VirtualProtect(void* a_address, std::size_t a_size, std::uint32_t a_newProtect, std::uint32_t* a_oldProtect) noexcept;
+	}
+}
+
+namespace REL
+{
+	namespace stl = F4SE::stl;
+	namespace WinAPI = F4SE::WinAPI;
+}
+
+namespace RE
+{
+	namespace stl = F4SE::stl;
+	namespace WinAPI = F4SE::WinAPI;
+}
+
+#include "REL/Relocation.h"
@@ -0,0 +1,213 @@
+// drives the trampoline with pages from mmap, so this suite only runs on linux
+#ifdef __linux__
+
+#	include "Stubs.h"
+
+#	include "F4SE/Trampoline.h"
+
+#	include <sys/mman.h>
+#	include <unistd.h>
+
+#	include <catch2/catch_all.hpp>
+
+void F4SE::Trampoline::log_stats() const {}
+
+namespace
+{
+	inline constexpr std::size_t GIGABYTE = static_cast<std::size_t>(1) << 30;
+
+	// searches outward from the address for free pages, one granule at a time
+	class MappedPageAllocator final :
+		public F4SE::PageAllocator
+	{
+	public:
+		[[nodiscard]] void* allocate(std::uintptr_t a_address, std::size_t a_range, std::size_t a_size) override
+		{
+			const auto step = granularity();
+			const auto base = F4SE::detail::rounddown(a_address, step);
+			for (std::size_t distance = 0; distance <= a_range; distance += step) {
+				for (const auto hint : { base + distance, distance <= base ? base - distance : 0 }) {
+					if (const auto mem = hint != 0 ? map(hint, a_size) : nullptr; mem) {
+						return mem;
+					}
+				}
+			}
+			return nullptr;
+		}
+
+		void deallocate(void* a_mem, std::size_t a_size) noexcept override
+		{
+			::munmap(a_mem, a_size);
+		}
+
+		[[nodiscard]] std::size_t granularity() const noexcept override
+		{
+			return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		}
+
+		[[nodiscard]] static void* map(std::uintptr_t a_address, std::size_t a_size) noexcept
+		{
+			const auto mem = ::mmap(
+				reinterpret_cast<void*>(a_address),
+				a_size,
+				PROT_READ | PROT_WRITE | PROT_EXEC,
+				MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+				-1,
+				0);
+			return mem != MAP_FAILED && reinterpret_cast<std::uintptr_t>(mem) == a_address ? mem : nullptr;
+		}
+	};
+
+	MappedPageAllocator pages;
+
+	// a function which calls through a patchable site, and returns whatever its callee returns
+	class CodeBuffer
+	{
+	public:
+		explicit CodeBuffer(std::uintptr_t a_address)
+		{
+			_data = static_cast<std::uint8_t*>(pages.allocate(a_address, GIGABYTE, SIZE));
+			REQUIRE(_data != nullptr);
+
+			// callee: mov eax, 1; ret
+			constexpr std::array<std::uint8_t, 6> callee{ 0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3 };
+			std::copy(callee.begin(), callee.end(), _data + CALLEE);
+
+			// caller: sub rsp, 8; call callee; add rsp, 8; ret
+			emit_caller(CALL5, { 0xE8 }, CALLEE);
+			// caller: sub rsp, 8; call [rip + disp32]; add rsp, 8; ret
+			emit_caller(CALL6, { 0xFF, 0x15 }, POINTER);
+			const auto callee6 = reinterpret_cast<std::uintptr_t>(_data + CALLEE);
+			std::memcpy(_data + POINTER, std::addressof(callee6), sizeof(callee6));
+		}
+
+		CodeBuffer(const CodeBuffer&) = delete;
+
+		~CodeBuffer() { pages.deallocate(_data, SIZE); }
+
+		CodeBuffer& operator=(const CodeBuffer&) = delete;
+
+		[[nodiscard]] std::uintptr_t call5() const noexcept { return address() + CALL5 + 4; }
+		[[nodiscard]] std::uintptr_t call6() const noexcept { return address() + CALL6 + 4; }
+		[[nodiscard]] std::uintptr_t callee() const noexcept { return address() + CALLEE; }
+		[[nodiscard]] std::uintptr_t pointer() const noexcept { return address() + POINTER; }
+		[[nodiscard]] std::uintptr_t address() const noexcept { return reinterpret_cast<std::uintptr_t>(_data); }
+
+		[[nodiscard]] int run5() const { return reinterpret_cast<int (*)()>(_data + CALL5)(); }
+		[[nodiscard]] int run6() const { return reinterpret_cast<int (*)()>(_data + CALL6)(); }
+
+	private:
+		static constexpr std::size_t SIZE = 0x1000;
+		static constexpr std::size_t CALL5 = 0x00;
+		static constexpr std::size_t CALL6 = 0x20;
+		static constexpr std::size_t CALLEE = 0x40;
+		static constexpr std::size_t POINTER = 0x60;
+
+		void emit_caller(std::size_t a_pos, std::initializer_list<std::uint8_t> a_opcode, std::size_t a_target)
+		{
+			auto it = _data + a_pos;
+			for (const auto byte : { 0x48, 0x83, 0xEC, 0x08 }) {
+				*it++ = static_cast<std::uint8_t>(byte);
+			}
+			it = std::copy(a_opcode.begin(), a_opcode.end(), it);
+			const auto disp = static_cast<std::int32_t>(a_target - (static_cast<std::size_t>(it - _data) + 4));
+			std::memcpy(it, std::addressof(disp), sizeof(disp));
+			it += sizeof(disp);
+			for (const auto byte : { 0x48, 0x83, 0xC4, 0x08, 0xC3 }) {
+				*it++ = static_cast<std::uint8_t>(byte);
+			}
+		}
+
+		std::uint8_t* _data{ nullptr };
+	};
+
+	int hook42() { return 42; }
+	int hook7() { return 7; }
+}
+
+F4SE::PageAllocator& F4SE::PageAllocator::get() noexcept { return pages; }
+
+TEST_CASE("trampoline branches")
+{
+	const CodeBuffer code{ reinterpret_cast<std::uintptr_t>(std::addressof(pages)) };
+	REQUIRE(code.run5() == 1);
+	REQUIRE(code.run6() == 1);
+
+	F4SE::Trampoline trampoline{ "test"sv, pages };
+	trampoline.create(14, reinterpret_cast<void*>(code.address()));
+	REQUIRE(trampoline.region_count() == 1);
+	REQUIRE(trampoline.capacity() == 14);
+
+	REQUIRE(trampoline.write_call<5>(code.call5(), hook42) == code.callee());
+	REQUIRE(code.run5() == 42);
+	REQUIRE(trampoline.hook_size(code.call5()) == 14);
+	REQUIRE(trampoline.utilisation() == 1.0);
+
+	// the same destination shares the branch it already has
+	const auto disp = *reinterpret_cast<const std::int32_t*>(code.call5() + 1);
+	const auto branch = code.call5() + 5 + static_cast<std::uintptr_t>(static_cast<std::intptr_t>(disp));
+	REQUIRE(trampoline.write_call<5>(code.call5(), hook42) == branch);
+	REQUIRE(code.run5() == 42);
+	REQUIRE(trampoline.hooks().size() == 2);
+	REQUIRE(trampoline.hooks().back().size == 0);
+	REQUIRE(trampoline.region_count() == 1);
+
+	// a full trampoline grows instead of failing
+	REQUIRE(trampoline.write_call<6>(code.call6(), hook7) == code.pointer());
+	REQUIRE(code.run6() == 7);
+	REQUIRE(trampoline.region_count() == 2);
+	REQUIRE(trampoline.hook_size(code.call6()) == sizeof(std::uintptr_t));
+	REQUIRE(trampoline.allocated_size() == 14 + sizeof(std::uintptr_t));
+	REQUIRE(trampoline.capacity() == 14 + pages.granularity());
+	REQUIRE(trampoline.utilisation() < 1.0);
+
+	trampoline = F4SE::Trampoline{ "empty"sv, pages };
+	REQUIRE(trampoline.empty());
+}
+
+TEST_CASE("trampoline regions")
+{
+	// two callers further apart than a rel32 can reach
+	const CodeBuffer near{ reinterpret_cast<std::uintptr_t>(std::addressof(pages)) };
+	const CodeBuffer far{ near.address() + 8 * GIGABYTE };
+	REQUIRE(far.address() - near.address() > 4 * GIGABYTE);
+
+	F4SE::Trampoline trampoline{ "test"sv, pages };
+	trampoline.create(0x100, reinterpret_cast<void*>(near.address()));
+
+	REQUIRE(trampoline.write_call<5>(near.call5(), hook42) == near.callee());
+	REQUIRE(trampoline.write_call<5>(far.call5(), hook42) == far.callee());
+	REQUIRE(near.run5() == 42);
+	REQUIRE(far.run5() == 42);
+
+	// the branch near the first caller is out of range of the second, so it gets its own
+	REQUIRE(trampoline.region_count() == 2);
+	REQUIRE(trampoline.hook_size(near.call5()) == 14);
+	REQUIRE(trampoline.hook_size(far.call5()) == 14);
+
+	// later allocations land in whichever region is nearest
+	REQUIRE(trampoline.write_call<6>(far.call6(), hook7) == far.pointer());
+	REQUIRE(trampoline.write_call<6>(near.call6(), hook7) == near.pointer());
+	REQUIRE(far.run6() == 7);
+	REQUIRE(near.run6() == 7);
+	REQUIRE(trampoline.region_count() == 2);
+	REQUIRE(trampoline.hooks().size() == 4);
+
+	// raw allocations are not hooks, so they only show up in the allocated size
+	REQUIRE(trampoline.allocate(0x10) != nullptr);
+	REQUIRE(trampoline.hooks().size() == 4);
+
+	std::size_t total = 0;
+	for (const auto& hook : trampoline.hooks()) {
+		total += hook.size;
+	}
+	REQUIRE(total + 0x10 == trampoline.allocated_size());
+	REQUIRE(trampoline.capacity() == 0x100 + pages.granularity());
+
+	// with no preference an allocation stays in reach of the origin, even though only the far region has room
+	const auto unplaced = reinterpret_cast<std::uintptr_t>(trampoline.allocate(0x100));
+	const auto distance = unplaced < near.address() ? near.address() - unplaced : unplaced - near.address();
+	REQUIRE(distance < 2 * GIGABYTE);
+	REQUIRE(trampoline.region_count() == 3);
+}
+#endif